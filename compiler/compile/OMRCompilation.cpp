@@ -104,6 +104,7 @@
 #include "runtime/CodeCacheExceptions.hpp"
 #include "ilgen/IlGen.hpp"
 #include "env/RegionProfiler.hpp"
+#include "optimizer/OptimizationProfiler.hpp"
 // this ratio defines how full the alias memory region is allowed to become before
 // it is recreated after an optimization finishes
 #define ALIAS_REGION_LOAD_FACTOR 0.75
@@ -276,6 +277,7 @@ OMR::Compilation::Compilation(int32_t id, OMR_VMThread* omrVMThread, TR_FrontEnd
     , _scratchSpaceLimit(TR::Options::_scratchSpaceLimit)
     , _cpuTimeAtStartOfCompilation(-1)
     , _ilVerifier(NULL)
+    , _optimizationProfile(NULL)
     , _gpuPtxList(m)
     , _gpuKernelLineNumberList(m)
     , _gpuPtxCount(0)
@@ -993,6 +995,7 @@ int32_t OMR::Compilation::compile()
                 TR::RegionProfiler rpOpt(self()->trMemory()->heapMemoryRegion(), *self(), "comp/opt");
                 self()->performOptimizations();
             }
+            TR::OptimizationProfiler::reportCompilation(self());
 
             if (printCodegenTime)
                 optTime.stopTiming(self());
@@ -1957,6 +1960,8 @@ void OMR::Compilation::shutdown(TR_FrontEnd* fe)
 
     TR::Recompilation::shutdown();
 
+    TR::OptimizationProfiler::shutdown();
+
     TR::Options::shutdown(fe);
 
 #ifdef J9_PROJECT_SPECIFIC
@@ -133,6 +133,9 @@ namespace TR {
 class Options;
 }
 namespace TR {
+class OptimizationProfile;
+}
+namespace TR {
 class Optimizer;
 }
 namespace TR {
@@ -1072,6 +1075,16 @@ public:
         _ilVerifier = ilVerifier;
     }
 
+    // What the optimization passes cost, if profileOptimizations is set and a pass has been recorded
+    TR::OptimizationProfile* getOptimizationProfile()
+    {
+        return _optimizationProfile;
+    }
+    void setOptimizationProfile(TR::OptimizationProfile* profile)
+    {
+        _optimizationProfile = profile;
+    }
+
     typedef std::pair<const void* const, TR::DebugCounterBase*> DebugCounterEntry;
     typedef TR::typed_allocator<DebugCounterEntry, TR::Allocator> DebugCounterMapAllocator;
     typedef std::map<const void*, TR::DebugCounterBase*, std::less<const void*>, DebugCounterMapAllocator>
@@ -1824,6 +1837,7 @@ private:
     int64_t _cpuTimeAtStartOfCompilation;
 
     TR::IlVerifier* _ilVerifier;
+    TR::OptimizationProfile* _optimizationProfile;
 
     int32_t _gpuBlockDimX;
     void* _gpuParms;
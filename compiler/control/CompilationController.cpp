@@ -31,6 +31,7 @@
 #include "control/Options.hpp"
 #include "control/Options_inlines.hpp"
 #include "control/Recompilation.hpp"
+#include "env/SegmentPool.hpp"
 #include "env/TRMemory.hpp"
 #include "infra/Monitor.hpp"
 #include "infra/ThreadLocal.h"
@@ -67,6 +68,7 @@ bool TR::CompilationController::init(TR::CompilationInfo* compInfo)
     }
 
     tlsAlloc(OMR::compilation);
+    tlsAlloc(OMR::scratchSegmentPool);
 
     return _useController;
 }
@@ -74,6 +76,7 @@ bool TR::CompilationController::init(TR::CompilationInfo* compInfo)
 void TR::CompilationController::shutdown()
 {
     tlsFree(OMR::compilation);
+    tlsFree(OMR::scratchSegmentPool);
     if (!_useController)
         return;
 
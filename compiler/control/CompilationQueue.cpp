@@ -0,0 +1,444 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "control/CompilationQueue.hpp"
+
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/RawAllocator.hpp"
+#include "env/SegmentPool.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "env/VerboseLog.hpp"
+#include "infra/Assert.hpp"
+
+namespace {
+
+/**
+ * Attach the current thread to the thread library for the lifetime of the object if it is not attached yet,
+ * since the queue monitor can only be used by attached threads.
+ * omrthread_self() reads a TLS key that only exists once the library is initialized, so the library is
+ * initialized first.
+ */
+class ThreadAttachment {
+public:
+    ThreadAttachment()
+        : _thread(NULL)
+    {
+        if (0 != omrthread_init_library())
+            return;
+
+        if (NULL == omrthread_self()) {
+            if (J9THREAD_SUCCESS != omrthread_attach_ex(&_thread, J9THREAD_ATTR_DEFAULT)) {
+                _thread = NULL;
+            }
+        }
+    }
+
+    ~ThreadAttachment()
+    {
+        if (NULL != _thread) {
+            omrthread_detach(_thread);
+        }
+    }
+
+    bool isAttached() const
+    {
+        return (0 == omrthread_init_library()) && (NULL != omrthread_self());
+    }
+
+private:
+    omrthread_t _thread;
+};
+
+} // namespace
+
+TR::CompilationRequest::CompilationRequest(const void* key, TR_Hotness hotness, Callback callback, void* userData)
+    : _key(key)
+    , _hotness(hotness)
+    , _callback(callback)
+    , _userData(userData)
+    , _done(false)
+    , _startPC(NULL)
+    , _returnCode(COMPILATION_REQUESTED)
+    , _referenceCount(1)
+    , _queue(NULL)
+    , _next(NULL)
+    , _followers(NULL)
+    , _submitTime(0)
+{}
+
+bool TR::CompilationRequest::isDone() const
+{
+    if (NULL == _queue) {
+        return false;
+    }
+
+    ThreadAttachment attachment;
+    TR_ASSERT_FATAL(attachment.isAttached(), "could not attach to the thread library");
+    omrthread_monitor_enter(_queue->_monitor);
+    bool done = _done;
+    omrthread_monitor_exit(_queue->_monitor);
+    return done;
+}
+
+void TR::CompilationRequest::wait()
+{
+    TR_ASSERT_FATAL(NULL != _queue, "waiting for a compilation request that was not submitted");
+
+    ThreadAttachment attachment;
+    TR_ASSERT_FATAL(attachment.isAttached(), "could not attach to the thread library");
+    omrthread_monitor_enter(_queue->_monitor);
+    while (!_done) {
+        omrthread_monitor_wait(_queue->_monitor);
+    }
+    omrthread_monitor_exit(_queue->_monitor);
+}
+
+void TR::CompilationRequest::release()
+{
+    uint32_t referenceCount = 0;
+    if (NULL == _queue) {
+        /* only the creator knows about a request that was not submitted */
+        referenceCount = --_referenceCount;
+    } else {
+        ThreadAttachment attachment;
+        TR_ASSERT_FATAL(attachment.isAttached(), "could not attach to the thread library");
+        omrthread_monitor_enter(_queue->_monitor);
+        referenceCount = --_referenceCount;
+        omrthread_monitor_exit(_queue->_monitor);
+    }
+
+    if (0 == referenceCount) {
+        TR::RawAllocator allocator = TR::Compiler->rawAllocator;
+        this->~CompilationRequest();
+        allocator.deallocate(this);
+    }
+}
+
+TR::CompilationQueue::CompilationQueue(uint32_t threadCount, uintptr_t stackSize)
+    : _threadCount(threadCount)
+    , _stackSize(stackSize)
+    , _scratchSegmentPoolSize(defaultScratchSegmentPoolSize)
+    , _scratchSegmentPrefaultCount(defaultScratchSegmentPrefaultCount)
+    , _liveThreadCount(0)
+    , _monitor(NULL)
+    , _running(false)
+    , _shuttingDown(false)
+    , _depth(0)
+    , _inProgress(NULL)
+{
+    for (int32_t i = 0; i <= maxHotness; i++) {
+        _head[i] = NULL;
+        _tail[i] = NULL;
+    }
+}
+
+TR::CompilationQueue::~CompilationQueue()
+{
+    if (NULL != _monitor) {
+        shutdown();
+        ThreadAttachment attachment;
+        omrthread_monitor_destroy(_monitor);
+    }
+}
+
+bool TR::CompilationQueue::start()
+{
+    ThreadAttachment attachment;
+    if (_running || !attachment.isAttached()) {
+        return _running;
+    }
+
+    if ((NULL == _monitor)
+        && (0 != omrthread_monitor_init_with_name(&_monitor, 0, "JIT compilation queue monitor"))) {
+        _monitor = NULL;
+        return false;
+    }
+
+    omrthread_attr_t attr;
+    if (J9THREAD_SUCCESS != omrthread_attr_init(&attr)) {
+        return false;
+    }
+    omrthread_attr_set_name(&attr, "JIT Compilation Thread");
+    omrthread_attr_set_stacksize(&attr, _stackSize);
+
+    omrthread_monitor_enter(_monitor);
+    _shuttingDown = false;
+    for (uint32_t i = 0; i < _threadCount; i++) {
+        omrthread_t thread = NULL;
+        if (J9THREAD_SUCCESS != omrthread_create_ex(&thread, &attr, 0, compilationThreadEntry, (void*)this)) {
+            break;
+        }
+        _liveThreadCount += 1;
+    }
+    _running = (0 != _liveThreadCount);
+    omrthread_monitor_exit(_monitor);
+    omrthread_attr_destroy(&attr);
+
+    if (TR::Options::getVerboseOption(TR_VerboseCompilationThreads)) {
+        TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "started %u of %u compilation threads", _liveThreadCount,
+            _threadCount);
+    }
+
+    return _running;
+}
+
+void TR::CompilationQueue::shutdown()
+{
+    if (NULL == _monitor) {
+        return;
+    }
+
+    ThreadAttachment attachment;
+    TR_ASSERT_FATAL(attachment.isAttached(), "could not attach to the thread library");
+    omrthread_monitor_enter(_monitor);
+    _shuttingDown = true;
+    omrthread_monitor_notify_all(_monitor);
+    while (0 != _liveThreadCount) {
+        omrthread_monitor_wait(_monitor);
+    }
+    _running = false;
+    omrthread_monitor_exit(_monitor);
+}
+
+bool TR::CompilationQueue::submit(TR::CompilationRequest* request)
+{
+    ThreadAttachment attachment;
+    if ((NULL == _monitor) || !attachment.isAttached()) {
+        return false;
+    }
+
+    omrthread_monitor_enter(_monitor);
+    if (!_running || _shuttingDown) {
+        omrthread_monitor_exit(_monitor);
+        return false;
+    }
+
+    TR_ASSERT_FATAL(NULL == request->_queue, "a compilation request can only be submitted once");
+    request->_referenceCount += 1;
+    request->_queue = this;
+    request->_submitTime = TR::Compiler->vm.getUSecClock();
+
+    TR::CompilationRequest* original = findRequest(request->key());
+    if (NULL != original) {
+        /* compile once and let the duplicate complete with the result of the original */
+        request->_next = original->_followers;
+        original->_followers = request;
+
+        bool queued = true;
+        for (TR::CompilationRequest* cursor = _inProgress; queued && (NULL != cursor); cursor = cursor->_next) {
+            queued = (cursor != original);
+        }
+        if (queued && (priority(request->hotness()) > priority(original->hotness()))) {
+            /* move the original up to the hotness of the duplicate */
+            int32_t level = priority(original->hotness());
+            TR::CompilationRequest* previous = NULL;
+            TR::CompilationRequest* cursor = _head[level];
+            while (cursor != original) {
+                previous = cursor;
+                cursor = cursor->_next;
+            }
+            if (NULL == previous) {
+                _head[level] = original->_next;
+            } else {
+                previous->_next = original->_next;
+            }
+            if (_tail[level] == original) {
+                _tail[level] = previous;
+            }
+            original->_hotness = request->hotness();
+            enqueue(original);
+        }
+    } else {
+        enqueue(request);
+        _depth += 1;
+        omrthread_monitor_notify(_monitor);
+    }
+
+    if (TR::Options::getVerboseOption(TR_VerboseCompileRequest)) {
+        TR_VerboseLog::writeLineLocked(TR_Vlog_CR, "queued %s (%s) depth=%u%s", request->signature(),
+            TR::Compilation::getHotnessName(request->hotness()), _depth, (NULL != original) ? " duplicate" : "");
+    }
+    omrthread_monitor_exit(_monitor);
+    return true;
+}
+
+int32_t TR::CompilationQueue::priority(TR_Hotness hotness)
+{
+    /* hotness levels past maxHotness are not optimization levels */
+    return (hotness > maxHotness) ? warm : hotness;
+}
+
+TR::CompilationRequest* TR::CompilationQueue::findRequest(const void* key)
+{
+    for (TR::CompilationRequest* cursor = _inProgress; NULL != cursor; cursor = cursor->_next) {
+        if (cursor->key() == key) {
+            return cursor;
+        }
+    }
+    for (int32_t level = maxHotness; level >= minHotness; level--) {
+        for (TR::CompilationRequest* cursor = _head[level]; NULL != cursor; cursor = cursor->_next) {
+            if (cursor->key() == key) {
+                return cursor;
+            }
+        }
+    }
+    return NULL;
+}
+
+void TR::CompilationQueue::enqueue(TR::CompilationRequest* request)
+{
+    int32_t level = priority(request->hotness());
+    request->_next = NULL;
+    if (NULL == _tail[level]) {
+        _head[level] = request;
+    } else {
+        _tail[level]->_next = request;
+    }
+    _tail[level] = request;
+}
+
+TR::CompilationRequest* TR::CompilationQueue::dequeue()
+{
+    for (int32_t level = maxHotness; level >= minHotness; level--) {
+        TR::CompilationRequest* request = _head[level];
+        if (NULL != request) {
+            _head[level] = request->_next;
+            if (NULL == _head[level]) {
+                _tail[level] = NULL;
+            }
+            _depth -= 1;
+            request->_next = _inProgress;
+            _inProgress = request;
+            return request;
+        }
+    }
+    return NULL;
+}
+
+void TR::CompilationQueue::unlinkInProgress(TR::CompilationRequest* request)
+{
+    TR::CompilationRequest** cursor = &_inProgress;
+    while (*cursor != request) {
+        cursor = &(*cursor)->_next;
+    }
+    *cursor = request->_next;
+    request->_next = NULL;
+}
+
+void TR::CompilationQueue::complete(TR::CompilationRequest* request, uint8_t* startPC, int32_t rc)
+{
+    request->_startPC = startPC;
+    request->_returnCode = rc;
+    if (NULL != request->_callback) {
+        request->_callback(request, request->_userData);
+    }
+}
+
+int J9THREAD_PROC TR::CompilationQueue::compilationThreadEntry(void* queue)
+{
+    TR::CompilationQueue* self = static_cast<TR::CompilationQueue*>(queue);
+    {
+        /* the scratch memory of the compilations on this thread stays mapped from one compilation to the next */
+        TR::RawAllocator rawAllocator;
+        TR::SystemSegmentProvider systemSegmentProvider(1 << 16, rawAllocator);
+        TR::SegmentPool scratchSegmentPool(systemSegmentProvider, self->_scratchSegmentPoolSize, rawAllocator);
+        scratchSegmentPool.prefault(self->_scratchSegmentPrefaultCount);
+        tlsSet(OMR::scratchSegmentPool, &scratchSegmentPool);
+
+        self->compilationThreadLoop(scratchSegmentPool);
+
+        tlsSet(OMR::scratchSegmentPool, NULL);
+    }
+    self->_liveThreadCount -= 1;
+    omrthread_monitor_notify_all(self->_monitor);
+    omrthread_exit(self->_monitor);
+    return 0;
+}
+
+void TR::CompilationQueue::compilationThreadLoop(TR::SegmentPool& scratchSegmentPool)
+{
+    omrthread_monitor_enter(_monitor);
+    while (true) {
+        TR::CompilationRequest* request = dequeue();
+        if (NULL == request) {
+            if (_shuttingDown) {
+                break;
+            }
+            omrthread_monitor_wait(_monitor);
+            continue;
+        }
+        uint32_t depth = _depth;
+        omrthread_monitor_exit(_monitor);
+
+        uint64_t startTime = TR::Compiler->vm.getUSecClock();
+        int32_t rc = COMPILATION_FAILED;
+        uint8_t* startPC = request->compile(request->hotness(), rc);
+        uint64_t endTime = TR::Compiler->vm.getUSecClock();
+        scratchSegmentPool.trim();
+
+        omrthread_monitor_enter(_monitor);
+        unlinkInProgress(request);
+        TR::CompilationRequest* followers = request->_followers;
+        request->_followers = NULL;
+        omrthread_monitor_exit(_monitor);
+
+        uint32_t followerCount = 0;
+        for (TR::CompilationRequest* follower = followers; NULL != follower; follower = follower->_next) {
+            followerCount += 1;
+        }
+        if (TR::Options::isAnyVerboseOptionSet(TR_VerboseCompileRequest, TR_VerbosePerformance)) {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_CR,
+                "compiled %s (%s) rc=%d depth=%u wait=%lluus compile=%lluus duplicates=%u", request->signature(),
+                TR::Compilation::getHotnessName(request->hotness()), rc, depth,
+                static_cast<unsigned long long>(startTime - request->_submitTime),
+                static_cast<unsigned long long>(endTime - startTime), followerCount);
+        }
+
+        /* the requests are only marked done once the log and the callbacks are through with them, since a waiter
+         * may free what signature() and the user data refer to as soon as wait() returns. The callbacks run without
+         * the monitor so they may submit further requests.
+         */
+        complete(request, startPC, rc);
+        for (TR::CompilationRequest* follower = followers; NULL != follower; follower = follower->_next) {
+            complete(follower, startPC, rc);
+        }
+
+        omrthread_monitor_enter(_monitor);
+        request->_done = true;
+        for (TR::CompilationRequest* follower = followers; NULL != follower; follower = follower->_next) {
+            follower->_done = true;
+        }
+        omrthread_monitor_notify_all(_monitor);
+        omrthread_monitor_exit(_monitor);
+
+        request->release();
+        while (NULL != followers) {
+            TR::CompilationRequest* follower = followers;
+            followers = follower->_next;
+            follower->release();
+        }
+
+        omrthread_monitor_enter(_monitor);
+    }
+}
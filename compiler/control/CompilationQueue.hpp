@@ -0,0 +1,210 @@
+/*******************************************************************************
+ * Copyright (c) 2000, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef COMPILATIONQUEUE_INCL
+#define COMPILATIONQUEUE_INCL
+
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/CompilationTypes.hpp"
+#include "omrthread.h"
+
+namespace TR {
+class CompilationQueue;
+}
+namespace TR {
+class SegmentPool;
+}
+
+namespace TR {
+
+/**
+ * A request to compile one method in the background.
+ *
+ * A request is reference counted: it is created with one reference, which belongs to its creator,
+ * and the queue holds another one from submission until completion. It must be allocated with
+ * TR::Compiler->rawAllocator since the last release frees it there. The reference count and the
+ * result are guarded by the monitor of the queue, which must outlive the requests submitted to it.
+ *
+ * Completion is reported both ways: the callback, if any, is invoked on the compilation thread once
+ * the result is known, and the request can be polled with isDone() or waited on with wait(). The
+ * callback runs before the request is done, so the user data only has to outlive wait(), and the
+ * callback must not wait for its own request.
+ */
+class CompilationRequest {
+public:
+    typedef void (*Callback)(TR::CompilationRequest* request, void* userData);
+
+    /**
+     * @param key identifies the method; requests with the same key are compiled once
+     * @param hotness the optimization level requested
+     */
+    CompilationRequest(const void* key, TR_Hotness hotness, Callback callback = NULL, void* userData = NULL);
+
+    const void* key() const
+    {
+        return _key;
+    }
+    TR_Hotness hotness() const
+    {
+        return _hotness;
+    }
+
+    /** True once startPC() and returnCode() hold the result of the compilation. */
+    bool isDone() const;
+
+    /** Block the calling thread until the request is done. The request must have been submitted. */
+    void wait();
+
+    /** The result, valid once isDone() returned true or wait() returned. */
+    uint8_t* startPC() const
+    {
+        return _startPC;
+    }
+    int32_t returnCode() const
+    {
+        return _returnCode;
+    }
+
+    /** Drop the reference of the creator. */
+    void release();
+
+protected:
+    virtual ~CompilationRequest() {}
+
+    /** Compile the method on the current (compilation) thread. */
+    virtual uint8_t* compile(TR_Hotness hotness, int32_t& rc) = 0;
+
+    /** The name of the method in the verbose log. */
+    virtual const char* signature()
+    {
+        return "(unknown)";
+    }
+
+private:
+    friend class TR::CompilationQueue;
+
+    const void* _key;
+    TR_Hotness _hotness;
+    Callback _callback;
+    void* _userData;
+    bool _done;
+    uint8_t* _startPC;
+    int32_t _returnCode;
+    uint32_t _referenceCount;
+    TR::CompilationQueue* _queue;
+    TR::CompilationRequest* _next; /**< next request of the same hotness, or of the requests being compiled */
+    TR::CompilationRequest* _followers; /**< duplicates completed with the result of this request */
+    uint64_t _submitTime;
+};
+
+/**
+ * A priority queue of compilation requests served by a pool of omrthread compilation threads.
+ *
+ * Requests are served hottest first and in submission order within a hotness level. A request
+ * for a method that is already queued or being compiled does not cause another compilation: it
+ * completes with the result of the earlier request, which is moved up if the duplicate asked for
+ * a higher hotness while it was still queued.
+ *
+ * The compiler is not thread safe for all front ends, so the default pool has a single thread and
+ * compilations must not be requested synchronously while the queue has work. JitBuilder methods
+ * that do not share a TypeDictionary can be compiled by a larger pool, see MethodBuilder::CompileBatch.
+ *
+ * Each compilation thread serves the scratch memory of its compilations from its own TR::SegmentPool,
+ * so the memory stays mapped from one compilation to the next.
+ */
+class CompilationQueue {
+public:
+    /** The compiler recurses over trees, so the default stack size of the thread library is too small. */
+    static const uintptr_t defaultStackSize = 4 * 1024 * 1024;
+
+    /** Each compilation thread keeps up to this many 64KB scratch segments between compilations. */
+    static const size_t defaultScratchSegmentPoolSize = 256;
+    /** The scratch segments a compilation thread maps and touches before its first compilation. */
+    static const size_t defaultScratchSegmentPrefaultCount = 32;
+
+    CompilationQueue(uint32_t threadCount = 1, uintptr_t stackSize = defaultStackSize);
+    ~CompilationQueue();
+
+    /**
+     * Size the scratch segment pools of the compilation threads. Takes effect for the threads created
+     * by the next call to start().
+     */
+    void setScratchSegmentPoolSize(size_t poolSize, size_t prefaultCount)
+    {
+        _scratchSegmentPoolSize = poolSize;
+        _scratchSegmentPrefaultCount = prefaultCount;
+    }
+
+    /**
+     * Create the compilation threads.
+     * @return true if at least one compilation thread was created
+     */
+    bool start();
+
+    /** Compile the requests left in the queue and stop the compilation threads. */
+    void shutdown();
+
+    /**
+     * Queue a request. Returns without waiting for the compilation. Threads that are not attached to
+     * the thread library are attached for the duration of the call, as they are in wait().
+     * @return false if the queue is not running, in which case the request is not retained
+     */
+    bool submit(TR::CompilationRequest* request);
+
+    /** The number of requests waiting for a compilation thread. */
+    uint32_t depth() const
+    {
+        return _depth;
+    }
+
+private:
+    static int J9THREAD_PROC compilationThreadEntry(void* queue);
+    /** Compile requests until the queue shuts down. Entered and left holding the monitor. */
+    void compilationThreadLoop(TR::SegmentPool& scratchSegmentPool);
+
+    TR::CompilationRequest* findRequest(const void* key);
+    void enqueue(TR::CompilationRequest* request);
+    TR::CompilationRequest* dequeue();
+    void unlinkInProgress(TR::CompilationRequest* request);
+    /** Store the result of a request and run its callback. Called without the monitor, before the request is done. */
+    void complete(TR::CompilationRequest* request, uint8_t* startPC, int32_t rc);
+    static int32_t priority(TR_Hotness hotness);
+
+    friend class TR::CompilationRequest;
+
+    uint32_t _threadCount;
+    uintptr_t _stackSize;
+    size_t _scratchSegmentPoolSize;
+    size_t _scratchSegmentPrefaultCount;
+    uint32_t _liveThreadCount; /**< compilation threads that have not exited yet */
+    omrthread_monitor_t _monitor; /**< guards the queue and the state of the requests */
+    bool _running;
+    bool _shuttingDown;
+    uint32_t _depth;
+    TR::CompilationRequest* _head[maxHotness + 1]; /**< one FIFO list per hotness level */
+    TR::CompilationRequest* _tail[maxHotness + 1];
+    TR::CompilationRequest* _inProgress;
+};
+
+} // namespace TR
+
+#endif
@@ -53,9 +53,11 @@
 #include "ilgen/IlGenRequest.hpp"
 #include "ilgen/IlGeneratorMethodDetails.hpp"
 #include "infra/Assert.hpp"
+#include "optimizer/OptimizationProfiler.hpp"
 #include "ras/Debug.hpp"
 #include "env/SystemSegmentProvider.hpp"
 #include "env/DebugSegmentProvider.hpp"
+#include "env/SegmentPool.hpp"
 #include "omrformatconsts.h"
 #include "runtime/CodeCacheManager.hpp"
 
@@ -146,6 +148,7 @@ int32_t commonJitInit(OMR::FrontEnd& fe, char* cmdLineOptions)
     TR::Options::setCanJITCompile(true);
     TR::Options::getCmdLineOptions()->setOption(TR_NoRecompile);
     TR::CompilationController::init(NULL);
+    TR::OptimizationProfiler::initialize();
 
     void* pseudoTOC = NULL;
 #if defined(TR_TARGET_POWER)
@@ -261,10 +264,14 @@ uint8_t* compileMethodFromDetails(
     TR::RawAllocator rawAllocator;
     TR::SystemSegmentProvider defaultSegmentProvider(1 << 16, rawAllocator);
     TR::DebugSegmentProvider debugSegmentProvider(1 << 16, rawAllocator);
-    TR::SegmentAllocator& scratchSegmentProvider
+    TR::SegmentPool* scratchSegmentPool = tlsGet(OMR::scratchSegmentPool, TR::SegmentPool*);
+    TR::SegmentProvider& scratchSegmentProvider
         = TR::Options::getCmdLineOptions()->getOption(TR_EnableScratchMemoryDebugging)
-        ? static_cast<TR::SegmentAllocator&>(debugSegmentProvider)
-        : static_cast<TR::SegmentAllocator&>(defaultSegmentProvider);
+        ? static_cast<TR::SegmentProvider&>(debugSegmentProvider)
+        : (NULL != scratchSegmentPool) ? static_cast<TR::SegmentProvider&>(*scratchSegmentPool)
+                                       : static_cast<TR::SegmentProvider&>(defaultSegmentProvider);
+    size_t initialSegmentRequests = scratchSegmentProvider.segmentRequests();
+    size_t initialSegmentReuses = scratchSegmentProvider.segmentReuses();
     TR::Region dispatchRegion(scratchSegmentProvider, rawAllocator);
     TR_Memory trMemory(*fe.persistentMemory(), dispatchRegion);
     TR_ResolvedMethod& compilee = *((TR_ResolvedMethod*)details.getMethod());
@@ -358,6 +365,13 @@ uint8_t* compileMethodFromDetails(
                 if (TR::Options::getVerboseOption(TR_VerbosePerformance)) {
                     TR_VerboseLog::write(" time=%llu mem=%lluKB", translationTime,
                         static_cast<unsigned long long>(scratchSegmentProvider.bytesAllocated()) / 1024);
+                    size_t segmentRequests = scratchSegmentProvider.segmentRequests() - initialSegmentRequests;
+                    size_t segmentReuses = scratchSegmentProvider.segmentReuses() - initialSegmentReuses;
+                    if (segmentRequests > 0) {
+                        TR_VerboseLog::write(" segmentsReused=%llu/%llu",
+                            static_cast<unsigned long long>(segmentReuses),
+                            static_cast<unsigned long long>(segmentRequests));
+                    }
                 }
 
                 TR_VerboseLog::vlogRelease();
@@ -1632,6 +1632,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
         offsetof(OMR::Options, _optLevel), veryHot, "P" },
     { "optLevel=warm", "O\tcompile all methods at warm level", TR::Options::set32BitValue,
         offsetof(OMR::Options, _optLevel), warm, "P" },
+    { "optProfileFile=", "I<filename>\twrite the records of profileOptimizations to filename instead of stderr",
+        TR::Options::setStaticString, (intptrj_t)(&OMR::Options::_optProfileFileName), 0, "F%s", NOT_IN_SUBSET },
     { "orderCompiles", "C\tcompile methods in limitfile order", SET_OPTION_BIT(TR_OrderCompiles), "P", NOT_IN_SUBSET },
     { "packedTest=", "D{regex}\tforce particular code paths to test Java Packed Object", TR::Options::setRegex,
         offsetof(OMR::Options, _packedTest), 0, "P" },
@@ -1660,6 +1662,8 @@ TR::OptionTable OMR::Options::_jitOptions[] = {
         SET_OPTION_BIT(TR_CompileTimeProfiler), "F" },
     { "profileMemoryRegions", "I\tenable the collection of scratch memory profiling data",
         SET_OPTION_BIT(TR_ProfileMemoryRegions), "F" },
+    { "profileOptimizations", "I\trecord the time, scratch memory and node count change of each optimization pass",
+        SET_OPTION_BIT(TR_ProfileOptimizations), "F" },
     { "profilingCompNodecountThreshold=",
         "M<nnn>\tthreshold for doubling the method to do a profiling compile is considered expensive",
         TR::Options::setStaticNumeric, (intptrj_t)&OMR::Options::_profilingCompNodecountThreshold, 0, "F%d",
@@ -2448,6 +2452,7 @@ bool OMR::Options::_sharedClassCache = false;
 
 TR::OptionSet* OMR::Options::_currentOptionSet = NULL;
 char* OMR::Options::_compilationStrategyName = "default";
+char* OMR::Options::_optProfileFileName = NULL;
 
 bool OMR::Options::_optionsTablesValidated = false;
 
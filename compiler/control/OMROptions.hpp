@@ -738,7 +738,7 @@ enum TR_CompilationOptions {
     TR_ProfileMemoryRegions = 0x00800000 + 21,
     TR_DisableConverterReducer = 0x01000000 + 21,
     TR_CompileTimeProfiler = 0x02000000 + 21,
-    // Available                                       = 0x04000000 + 21,
+    TR_ProfileOptimizations = 0x04000000 + 21,
     // Available                                       = 0x08000000 + 21,
     // Available                                       = 0x10000000 + 21,
     TR_PerformLookaheadAtWarmCold = 0x20000000 + 21,
@@ -2635,6 +2635,10 @@ public:
     {
         return _compilationStrategyName;
     }
+    static char* getOptProfileFileName()
+    {
+        return _optProfileFileName;
+    }
 
     /**   \brief Returns a threshold on the profiling method invocations to trip recompilation
      */
@@ -2994,6 +2998,7 @@ protected:
     char* _startOptions;
     char* _envOptions;
     static char* _compilationStrategyName;
+    static char* _optProfileFileName;
 
     static TR::OptionFunctionPtr _processingMethod[];
     static TR::OptionFunctionPtr _negateProcessingMethod[];
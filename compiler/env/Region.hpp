@@ -36,6 +36,7 @@ namespace TR {
 
 class SegmentProvider;
 class RegionProfiler;
+class OptimizationProfiler;
 
 class Region {
 
@@ -141,6 +142,7 @@ public:
 
 private:
     friend class TR::RegionProfiler;
+    friend class TR::OptimizationProfiler;
 
     size_t round(size_t bytes);
 
@@ -39,8 +39,10 @@ namespace TR {
  * This class makes use of the compiler's debug counter facility to record the
  * difference in memory usage for a region and its segment provider between the
  * two points of execution determined by the invocation of its constructor and
- * the invocation of its destructor. The lifetime of the region tracked by the
- * profiler object must comprehend the lifetime of the profiler itself. The
+ * the invocation of its destructor, along with how many segments the segment
+ * provider handed out and how many of those reused memory it had kept. The
+ * lifetime of the region tracked by the profiler object must comprehend the
+ * lifetime of the profiler itself. The
  * implementation requires a compilation object in order to determine whether
  * or not the facility is active.
  */
@@ -51,6 +53,8 @@ public:
         : _region(region)
         , _initialRegionSize(_region.bytesAllocated())
         , _initialSegmentProviderSize(_region._segmentProvider.bytesAllocated())
+        , _initialSegmentRequests(_region._segmentProvider.segmentRequests())
+        , _initialSegmentReuses(_region._segmentProvider.segmentReuses())
         , _compilation(compilation)
     {
         if (_compilation.getOption(TR_ProfileMemoryRegions)) {
@@ -73,6 +77,17 @@ public:
             TR::DebugCounter::incStaticDebugCounter(&_compilation,
                 TR::DebugCounter::debugCounterName(&_compilation, "segmentAllocation.details/%s", _identifier),
                 (_region._segmentProvider.bytesAllocated() - _initialSegmentProviderSize) / 1024);
+
+            size_t segmentRequests = _region._segmentProvider.segmentRequests() - _initialSegmentRequests;
+            if (segmentRequests > 0) {
+                // the reuse rate is segmentReuses / segmentRequests
+                TR::DebugCounter::incStaticDebugCounter(&_compilation,
+                    TR::DebugCounter::debugCounterName(&_compilation, "segmentRequests.details/%s", _identifier),
+                    segmentRequests);
+                TR::DebugCounter::incStaticDebugCounter(&_compilation,
+                    TR::DebugCounter::debugCounterName(&_compilation, "segmentReuses.details/%s", _identifier),
+                    _region._segmentProvider.segmentReuses() - _initialSegmentReuses);
+            }
         }
     }
 
@@ -80,6 +95,8 @@ private:
     TR::Region& _region;
     size_t const _initialRegionSize;
     size_t const _initialSegmentProviderSize;
+    size_t const _initialSegmentRequests;
+    size_t const _initialSegmentReuses;
     TR::Compilation& _compilation;
     char _identifier[256];
 };
@@ -22,10 +22,27 @@
 #include "env/SegmentPool.hpp"
 #include "env/MemorySegment.hpp"
 
+namespace OMR {
+tlsDefine(TR::SegmentPool*, scratchSegmentPool);
+}
+
+/* The smallest page size of the supported platforms */
+#define PREFAULT_STRIDE 4096
+
 TR::SegmentPool::SegmentPool(TR::SegmentProvider& backingProvider, size_t poolSize, TR::RawAllocator rawAllocator)
     : SegmentProvider(backingProvider.defaultSegmentSize())
     , _poolSize(poolSize)
     , _storedSegments(0)
+    , _segmentsInUse(0)
+    , _peakSegmentsInUse(0)
+    , _baseSegmentsInUse(0)
+    , _retainedSegments(0)
+    , _bytesInUse(0)
+    , _peakBytesInUse(0)
+    , _baseBytesInUse(0)
+    , _measuredPeakBytesInUse(0)
+    , _segmentRequests(0)
+    , _segmentReuses(0)
     , _backingProvider(backingProvider)
     , _segmentStack(StackContainer(DequeAllocator(rawAllocator)))
 {}
@@ -44,19 +61,37 @@ TR::SegmentPool::~SegmentPool() throw()
 
 TR::MemorySegment& TR::SegmentPool::request(size_t requiredSize)
 {
+    ++_segmentRequests;
+    TR::MemorySegment* segment = NULL;
     if (requiredSize <= defaultSegmentSize() && !_segmentStack.empty()) {
         --_storedSegments;
         TR_ASSERT(0 <= _storedSegments, "We lost a segment");
         TR::MemorySegment& recycledSegment = _segmentStack.top().get();
         _segmentStack.pop();
         recycledSegment.reset();
-        return recycledSegment;
+        ++_segmentReuses;
+        segment = &recycledSegment;
+    } else {
+        segment = &_backingProvider.request(requiredSize);
     }
-    return _backingProvider.request(requiredSize);
+
+    if (segment->size() == defaultSegmentSize()) {
+        ++_segmentsInUse;
+        _peakSegmentsInUse = _segmentsInUse > _peakSegmentsInUse ? _segmentsInUse : _peakSegmentsInUse;
+    }
+    _bytesInUse += segment->size();
+    _peakBytesInUse = _bytesInUse > _peakBytesInUse ? _bytesInUse : _peakBytesInUse;
+    _measuredPeakBytesInUse = _bytesInUse > _measuredPeakBytesInUse ? _bytesInUse : _measuredPeakBytesInUse;
+    return *segment;
 }
 
 void TR::SegmentPool::release(TR::MemorySegment& segment) throw()
 {
+    _bytesInUse -= segment.size();
+    if (segment.size() == defaultSegmentSize()) {
+        --_segmentsInUse;
+    }
+
     if (segment.size() == defaultSegmentSize() && _storedSegments < _poolSize) {
         try {
             _segmentStack.push(TR::ref(segment));
@@ -68,3 +103,51 @@ void TR::SegmentPool::release(TR::MemorySegment& segment) throw()
         _backingProvider.release(segment);
     }
 }
+
+size_t TR::SegmentPool::bytesAllocated() const throw()
+{
+    return _peakBytesInUse - _baseBytesInUse;
+}
+
+void TR::SegmentPool::prefault(size_t segmentCount)
+{
+    segmentCount = segmentCount < _poolSize ? segmentCount : _poolSize;
+    try {
+        while (_storedSegments < segmentCount) {
+            TR::MemorySegment& segment = _backingProvider.request(defaultSegmentSize());
+            for (size_t offset = 0; offset < segment.size(); offset += PREFAULT_STRIDE) {
+                static_cast<volatile char*>(segment.base())[offset] = 0;
+            }
+            try {
+                _segmentStack.push(TR::ref(segment));
+                ++_storedSegments;
+            } catch (...) {
+                _backingProvider.release(segment);
+                throw;
+            }
+        }
+    } catch (...) {
+        /* the pool is only warmed up as far as memory allows */
+    }
+    _retainedSegments = _storedSegments > _retainedSegments ? _storedSegments : _retainedSegments;
+}
+
+void TR::SegmentPool::trim() throw()
+{
+    /*
+     * Keep what the work that just finished needed, or the earlier allowance with its excess halved if that
+     * is more, so that a single small piece of work does not throw away the segments a large one needs again.
+     */
+    size_t neededSegments = _peakSegmentsInUse - _baseSegmentsInUse;
+    size_t decayedAllowance = (_retainedSegments + neededSegments) / 2;
+    _retainedSegments = neededSegments > decayedAllowance ? neededSegments : decayedAllowance;
+    _peakSegmentsInUse = _baseSegmentsInUse = _segmentsInUse;
+    _peakBytesInUse = _baseBytesInUse = _bytesInUse;
+
+    while (_storedSegments > _retainedSegments) {
+        TR::MemorySegment& topSegment = _segmentStack.top().get();
+        _segmentStack.pop();
+        _backingProvider.release(topSegment);
+        --_storedSegments;
+    }
+}
@@ -30,11 +30,29 @@
 #include "infra/ReferenceWrapper.hpp"
 #include "env/SegmentProvider.hpp"
 #include "env/RawAllocator.hpp"
+#include "infra/ThreadLocal.h"
+
+namespace TR {
+class SegmentPool;
+}
+
+namespace OMR {
+/**
+ * @brief The pool providing scratch memory to the compilations of the current thread, or NULL if each
+ * compilation gets its memory from the system.
+ */
+tlsDeclare(TR::SegmentPool*, scratchSegmentPool);
+} // namespace OMR
 
 namespace TR {
 
 /**
  * @brief The SegmentPool class maintains a pool of memory segments.
+ *
+ * Segments of the default size are kept when they are released so that the next user of the pool
+ * gets memory that is already mapped. The owner of the pool calls trim() each time a piece of work
+ * using it (e.g. a compilation) is done: the pool then keeps as many segments as the busiest recent
+ * piece of work needed, where the excess allowed for an earlier peak halves each time.
  */
 
 class SegmentPool : public TR::SegmentProvider {
@@ -45,9 +63,62 @@ public:
     virtual TR::MemorySegment& request(size_t requiredSize);
     virtual void release(TR::MemorySegment&) throw();
 
+    /**
+     * @brief The most bytes handed out at once since the last trim, beyond those still in use then.
+     */
+    virtual size_t bytesAllocated() const throw();
+
+    virtual size_t segmentRequests() const throw()
+    {
+        return _segmentRequests;
+    }
+    virtual size_t segmentReuses() const throw()
+    {
+        return _segmentReuses;
+    }
+
+    virtual bool tracksBytesInUse() const throw()
+    {
+        return true;
+    }
+    virtual size_t bytesInUse() const throw()
+    {
+        return _bytesInUse;
+    }
+    virtual size_t peakBytesInUse() const throw()
+    {
+        return _measuredPeakBytesInUse;
+    }
+    virtual void setPeakBytesInUse(size_t peak) throw()
+    {
+        _measuredPeakBytesInUse = peak > _bytesInUse ? peak : _bytesInUse;
+    }
+
+    /**
+     * @brief Fill the pool with up to segmentCount segments of the default size, touching each page
+     * so that the first users of the pool do not take page faults.
+     */
+    void prefault(size_t segmentCount);
+
+    /**
+     * @brief Return the segments kept beyond what recent work needed to the backing provider.
+     */
+    void trim() throw();
+
 private:
+
     size_t const _poolSize;
     size_t _storedSegments;
+    size_t _segmentsInUse; /**< segments of the default size handed out */
+    size_t _peakSegmentsInUse; /**< since the last trim */
+    size_t _baseSegmentsInUse; /**< in use at the last trim */
+    size_t _retainedSegments; /**< the number of segments kept when trimming */
+    size_t _bytesInUse;
+    size_t _peakBytesInUse; /**< since the last trim */
+    size_t _baseBytesInUse; /**< in use at the last trim */
+    size_t _measuredPeakBytesInUse; /**< since the last setPeakBytesInUse */
+    size_t _segmentRequests;
+    size_t _segmentReuses;
     TR::SegmentProvider& _backingProvider;
 
     typedef TR::typed_allocator<TR::reference_wrapper<TR::MemorySegment>, TR::RawAllocator> DequeAllocator;
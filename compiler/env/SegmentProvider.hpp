@@ -41,6 +41,42 @@ public:
     }
     virtual size_t bytesAllocated() const throw() = 0;
 
+    /*
+     * The number of segments requested so far, and how many of them reused memory kept from
+     * earlier requests; providers that keep no memory reuse none
+     */
+    virtual size_t segmentRequests() const throw()
+    {
+        return 0;
+    }
+    virtual size_t segmentReuses() const throw()
+    {
+        return 0;
+    }
+
+    /*
+     * The bytes in segments handed out and not yet released, and the most there have been since the
+     * peak was last set; providers that do not track their usage report 0 and return false from
+     * tracksBytesInUse
+     */
+    virtual bool tracksBytesInUse() const throw()
+    {
+        return false;
+    }
+    virtual size_t bytesInUse() const throw()
+    {
+        return 0;
+    }
+    virtual size_t peakBytesInUse() const throw()
+    {
+        return 0;
+    }
+
+    /*
+     * Restart the peak at peak, or at the bytes in use now if that is more
+     */
+    virtual void setPeakBytesInUse(size_t peak) throw() {}
+
 protected:
     explicit SegmentProvider(size_t defaultSegmentSize)
         : _defaultSegmentSize(defaultSegmentSize)
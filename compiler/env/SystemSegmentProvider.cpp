@@ -27,6 +27,7 @@ OMR::SystemSegmentProvider::SystemSegmentProvider(size_t segmentSize, TR::RawAll
     , _rawAllocator(rawAllocator)
     , _currentBytesAllocated(0)
     , _highWaterMark(0)
+    , _measuredPeakBytesInUse(0)
     , _segments(std::less<TR::MemorySegment>(), SegmentSetAllocator(rawAllocator))
 {}
 
@@ -42,6 +43,8 @@ TR::MemorySegment& OMR::SystemSegmentProvider::request(size_t requiredSize)
         TR_ASSERT(result.second, "Insertion failed");
         _currentBytesAllocated += adjustedSize;
         _highWaterMark = _currentBytesAllocated > _highWaterMark ? _currentBytesAllocated : _highWaterMark;
+        _measuredPeakBytesInUse
+            = _currentBytesAllocated > _measuredPeakBytesInUse ? _currentBytesAllocated : _measuredPeakBytesInUse;
         return const_cast<TR::MemorySegment&>(*(result.first));
     } catch (...) {
         _rawAllocator.deallocate(newSegmentArea);
@@ -73,6 +76,26 @@ size_t OMR::SystemSegmentProvider::systemBytesAllocated() const throw()
     return _highWaterMark;
 }
 
+bool OMR::SystemSegmentProvider::tracksBytesInUse() const throw()
+{
+    return true;
+}
+
+size_t OMR::SystemSegmentProvider::bytesInUse() const throw()
+{
+    return _currentBytesAllocated;
+}
+
+size_t OMR::SystemSegmentProvider::peakBytesInUse() const throw()
+{
+    return _measuredPeakBytesInUse;
+}
+
+void OMR::SystemSegmentProvider::setPeakBytesInUse(size_t peak) throw()
+{
+    _measuredPeakBytesInUse = peak > _currentBytesAllocated ? peak : _currentBytesAllocated;
+}
+
 size_t OMR::SystemSegmentProvider::allocationLimit() const throw()
 {
     return static_cast<size_t>(-1);
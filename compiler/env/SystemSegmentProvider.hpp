@@ -54,11 +54,16 @@ public:
     size_t systemBytesAllocated() const throw();
     size_t allocationLimit() const throw();
     void setAllocationLimit(size_t);
+    virtual bool tracksBytesInUse() const throw();
+    virtual size_t bytesInUse() const throw();
+    virtual size_t peakBytesInUse() const throw();
+    virtual void setPeakBytesInUse(size_t peak) throw();
 
 private:
     TR::RawAllocator _rawAllocator;
     size_t _currentBytesAllocated;
     size_t _highWaterMark;
+    size_t _measuredPeakBytesInUse;
     typedef TR::typed_allocator<TR::MemorySegment, TR::RawAllocator> SegmentSetAllocator;
 
     std::set<TR::MemorySegment, std::less<TR::MemorySegment>, SegmentSetAllocator> _segments;
@@ -37,6 +37,7 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/Compilation.hpp"
 #include "compile/SymbolReferenceTable.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
 #include "control/Recompilation.hpp"
 #include "infra/Assert.hpp"
@@ -131,6 +132,7 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary* types, TR::VirtualMachineS
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _compilationRequest(NULL)
 {
     _definingLine[0] = '\0';
 }
@@ -163,6 +165,7 @@ OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder* callerMB, TR::VirtualMachin
     , _nextInlineSiteIndex(0)
     , _returnBuilder(NULL)
     , _returnSymbolName(NULL)
+    , _compilationRequest(NULL)
 {
     _definingLine[0] = '\0';
     initialize(callerMB->_details, callerMB->_methodSymbol, callerMB->_fe, callerMB->_symRefTab);
@@ -179,6 +182,12 @@ OMR::MethodBuilder::~MethodBuilder()
     _symbolIsArray.clear();
     _memoryLocations.clear();
     _functions.clear();
+
+    // the compilation cannot be cancelled, and it uses this MethodBuilder
+    if (NULL != _compilationRequest) {
+        _compilationRequest->wait();
+        _compilationRequest->release();
+    }
 }
 
 TR::MethodBuilder* OMR::MethodBuilder::asMethodBuilder()
@@ -645,6 +654,122 @@ int32_t OMR::MethodBuilder::Compile(void** entry)
     return rc;
 }
 
+namespace {
+
+/**
+ * Compiles a MethodBuilder on a compilation thread the way MethodBuilder::Compile does.
+ */
+class MethodBuilderCompilationRequest : public TR::CompilationRequest {
+public:
+    MethodBuilderCompilationRequest(
+        TR::MethodBuilder* methodBuilder, TR_Hotness hotness, Callback callback, void* userData)
+        : TR::CompilationRequest(methodBuilder, hotness, callback, userData)
+        , _methodBuilder(methodBuilder)
+    {}
+
+protected:
+    virtual uint8_t* compile(TR_Hotness hotness, int32_t& rc)
+    {
+        TR::ResolvedMethod resolvedMethod(_methodBuilder);
+        TR::IlGeneratorMethodDetails details(&resolvedMethod);
+
+        uint8_t* startPC = compileMethodFromDetails(NULL, details, hotness, rc);
+        _methodBuilder->typeDictionary()->NotifyCompilationDone();
+        return startPC;
+    }
+
+    virtual const char* signature()
+    {
+        return _methodBuilder->GetMethodName();
+    }
+
+private:
+    TR::MethodBuilder* _methodBuilder;
+};
+
+} // namespace
+
+TR::CompilationRequest* OMR::MethodBuilder::CompileAsync(TR::CompilationQueue* queue, TR_Hotness hotness,
+    void (*callback)(TR::CompilationRequest* request, void* userData), void* userData)
+{
+    TR::CompilationRequest* request = new (TR::Compiler->rawAllocator)
+        MethodBuilderCompilationRequest(static_cast<TR::MethodBuilder*>(this), hotness, callback, userData);
+    if (!queue->submit(request)) {
+        request->release();
+        return NULL;
+    }
+    return request;
+}
+
+int32_t OMR::MethodBuilder::CompileBatch(TR::CompilationQueue* queue, int32_t count,
+    TR::MethodBuilder** methodBuilders, void** entries, int32_t* returnCodes, TR_Hotness hotness)
+{
+    // nothing to compile, and no request array to allocate
+    if (count <= 0)
+        return 0;
+
+    TR::RawAllocator allocator = TR::Compiler->rawAllocator;
+    TR::CompilationRequest** requests
+        = static_cast<TR::CompilationRequest**>(allocator.allocate(count * sizeof(TR::CompilationRequest*)));
+
+    // queue every method first so the compilation threads can work on them concurrently
+    for (int32_t i = 0; i < count; i++)
+        requests[i] = methodBuilders[i]->CompileAsync(queue, hotness);
+
+    int32_t failures = 0;
+    for (int32_t i = 0; i < count; i++) {
+        int32_t rc = COMPILATION_FAILED;
+        entries[i] = NULL;
+        if (NULL != requests[i]) {
+            requests[i]->wait();
+            entries[i] = requests[i]->startPC();
+            rc = requests[i]->returnCode();
+            requests[i]->release();
+        }
+        if (NULL != returnCodes)
+            returnCodes[i] = rc;
+        if (NULL == entries[i])
+            failures++;
+    }
+
+    allocator.deallocate(requests);
+    return failures;
+}
+
+bool OMR::MethodBuilder::CompileAsync()
+{
+    if ((NULL != _compilationRequest) || (NULL == _compilationQueue))
+        return false;
+
+    _compilationRequest = CompileAsync(_compilationQueue);
+    return NULL != _compilationRequest;
+}
+
+int32_t OMR::MethodBuilder::WaitForCompile(void** entry)
+{
+    *entry = NULL;
+    if (NULL == _compilationRequest)
+        return COMPILATION_FAILED;
+
+    _compilationRequest->wait();
+    *entry = _compilationRequest->startPC();
+    int32_t rc = _compilationRequest->returnCode();
+    _compilationRequest->release();
+    _compilationRequest = NULL;
+    return rc;
+}
+
+int32_t OMR::MethodBuilder::CompileBatch(uint32_t count, TR::MethodBuilder** methodBuilders, void** entries)
+{
+    if (NULL == _compilationQueue) {
+        for (uint32_t i = 0; i < count; i++)
+            entries[i] = NULL;
+        return static_cast<int32_t>(count);
+    }
+
+    return CompileBatch(_compilationQueue, static_cast<int32_t>(count), methodBuilders, entries);
+}
+
 void* OMR::MethodBuilder::client()
 {
     if (_client == NULL && _clientAllocator != NULL)
@@ -654,3 +779,4 @@ void* OMR::MethodBuilder::client()
 
 ClientAllocator OMR::MethodBuilder::_clientAllocator = NULL;
 ClientAllocator OMR::MethodBuilder::_getImpl = NULL;
+TR::CompilationQueue* OMR::MethodBuilder::_compilationQueue = NULL;
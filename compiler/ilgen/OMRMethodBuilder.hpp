@@ -25,6 +25,7 @@
 #include <map>
 #include <set>
 #include <fstream>
+#include "compile/CompilationTypes.hpp"
 #include "env/TRMemory.hpp"
 #include "ilgen/IlBuilder.hpp"
 #include "env/TypedAllocator.hpp"
@@ -37,6 +38,12 @@ namespace TR {
 class BytecodeBuilder;
 }
 namespace TR {
+class CompilationQueue;
+}
+namespace TR {
+class CompilationRequest;
+}
+namespace TR {
 class ResolvedMethod;
 }
 namespace TR {
@@ -182,6 +189,63 @@ public:
 
     int32_t Compile(void** entry);
 
+    /**
+     * @brief queue the compilation of this method and return without waiting for it
+     * @param queue the compilation queue, which must have been started
+     * @param hotness the optimization level requested
+     * @param callback if not NULL, invoked on the compilation thread once the compilation is done
+     * @param userData passed to the callback
+     * @returns the request, which the caller must release, or NULL if the queue is not running
+     */
+    TR::CompilationRequest* CompileAsync(TR::CompilationQueue* queue, TR_Hotness hotness = warm,
+        void (*callback)(TR::CompilationRequest* request, void* userData) = NULL, void* userData = NULL);
+
+    /**
+     * @brief compile several methods on the compilation threads of a queue and wait for all of them
+     * @details The methods are compiled concurrently when the queue has more than one thread. They must not
+     *          share a TypeDictionary, since a compilation caches symbol references in the dictionary of
+     *          its method.
+     * @param queue the compilation queue, which must have been started
+     * @param count the number of methods; nothing is compiled if it is not positive
+     * @param methodBuilders the methods to compile
+     * @param entries receives the entry point of each method, or NULL if its compilation failed
+     * @param returnCodes if not NULL, receives the return code of each compilation
+     * @param hotness the optimization level requested
+     * @returns the number of methods that could not be compiled
+     */
+    static int32_t CompileBatch(TR::CompilationQueue* queue, int32_t count, TR::MethodBuilder** methodBuilders,
+        void** entries, int32_t* returnCodes = NULL, TR_Hotness hotness = warm);
+
+    /**
+     * @brief queue the compilation of this method on the compilation queue set with setCompilationQueue()
+     * @details The result is collected with WaitForCompile(), which must be called before the queue is
+     *          destroyed. A method has at most one such compilation in flight.
+     * @returns true if the compilation was queued
+     */
+    bool CompileAsync();
+
+    /**
+     * @brief wait for the compilation queued by CompileAsync()
+     * @param entry receives the entry point of the method, or NULL if it could not be compiled
+     * @returns the return code of the compilation
+     */
+    int32_t WaitForCompile(void** entry);
+
+    /**
+     * @brief compile several methods on the compilation queue set with setCompilationQueue()
+     * @see CompileBatch(TR::CompilationQueue*, int32_t, TR::MethodBuilder**, void**, int32_t*, TR_Hotness)
+     */
+    static int32_t CompileBatch(uint32_t count, TR::MethodBuilder** methodBuilders, void** entries);
+
+    /**
+     * @brief set the compilation queue used by CompileAsync() and CompileBatch() when none is given
+     * @param queue the compilation queue, which must have been started, or NULL
+     */
+    static void setCompilationQueue(TR::CompilationQueue* queue)
+    {
+        _compilationQueue = queue;
+    }
+
     /**
      * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
      *        mechanism for MethodBuilder subclasses to provide method lookup on demand rather than all up
@@ -418,9 +482,13 @@ private:
     TR::IlBuilder* _returnBuilder;
     const char* _returnSymbolName;
 
+    /** The compilation queued by CompileAsync() and not yet collected by WaitForCompile(). */
+    TR::CompilationRequest* _compilationRequest;
+
 private:
     static ClientAllocator _clientAllocator;
     static ImplGetter _getImpl;
+    static TR::CompilationQueue* _compilationQueue;
 };
 
 } // namespace OMR
@@ -24,8 +24,15 @@
 #include <stdint.h>
 #include <stdio.h>
 #include "compile/Compilation.hpp"
+#include "env/FrontEnd.hpp"
+#include "infra/Bit.hpp"
 #include "ras/Debug.hpp"
 
+#if defined(TR_HOST_X86) && defined(TR_HOST_64BIT) && defined(__GNUC__)
+#define TR_BITVECTOR_X86_VECTOR
+#include <immintrin.h>
+#endif
+
 // Number of bits set in a byte containing the index value
 //
 static int8_t bitsInByte[] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1, 2, 2, 3, 2, 3, 3, 4, 2, 3, 3, 4, 3, 4,
@@ -38,6 +45,8 @@ static int8_t bitsInByte[] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 1
 
 int32_t TR_BitVector::elementCount()
 {
+    if (_isSparse)
+        return _numElements;
     int32_t count = 0;
     for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++) {
         if (_chunks[i]) {
@@ -61,6 +70,15 @@ int32_t TR_BitVector::commonElementCount(TR_BitVector& v2)
 {
     if (v2._lastChunkWithNonZero < _firstChunkWithNonZero || v2._firstChunkWithNonZero > _lastChunkWithNonZero)
         return false; // No intersection
+    if (_isSparse || v2._isSparse) {
+        TR_BitVector& sparse = _isSparse ? *this : v2;
+        TR_BitVector& other = _isSparse ? v2 : *this;
+        int32_t count = 0;
+        for (int32_t i = 0; i < sparse._numElements; i++)
+            if (other.get(sparse._elements[i]))
+                count++;
+        return count;
+    }
     int32_t low
         = _firstChunkWithNonZero >= v2._firstChunkWithNonZero ? _firstChunkWithNonZero : v2._firstChunkWithNonZero;
     int32_t high = _lastChunkWithNonZero <= v2._lastChunkWithNonZero ? _lastChunkWithNonZero : v2._lastChunkWithNonZero;
@@ -86,6 +104,8 @@ int32_t TR_BitVector::commonElementCount(TR_BitVector& v2)
 
 bool TR_BitVector::hasMoreThanOneElement()
 {
+    if (_isSparse)
+        return _numElements > 1;
     if (_firstChunkWithNonZero < _lastChunkWithNonZero)
         return true;
     if (_lastChunkWithNonZero < 0)
@@ -110,6 +130,21 @@ void TR_BitVector::setChunkSize(int32_t chunkSize)
 {
     if (chunkSize == _numChunks)
         return;
+    if (_isSparse) {
+        // Only the size changes; the chunks are allocated at the new size if the vector becomes dense
+        if (chunkSize < _numChunks)
+            _numElements = findElement(getBitIndex(chunkSize));
+        TR_ASSERT(_growable == growable, "Bit vector is not growable");
+        _chunks = NULL;
+        _numChunks = chunkSize;
+        resetSparseLowAndHighChunks();
+        if (!canBeSparse())
+            densify();
+#if BV_SANITY_CHECK
+        sanityCheck("setChunkSize");
+#endif
+        return;
+    }
     if (chunkSize == 0) {
         if (_chunks && _region == NULL)
             jitPersistentFree(_chunks);
@@ -175,12 +210,542 @@ const char* TR_BitVector::getHexString()
     _memoryUsed += _numChunks * chunk_hexlen + 1;
 #endif
     for (int32_t i = _numChunks - 1; i >= 0; i--) {
-        sprintf(pos, "%0*lX", chunk_hexlen, _chunks[i]);
+        sprintf(pos, "%0*lX", chunk_hexlen, getChunk(i));
         pos += chunk_hexlen;
     }
     return buf;
 }
 
+chunk_t TR_BitVector::getChunk(int32_t chunkIndex)
+{
+    if (!_isSparse)
+        return _chunks[chunkIndex];
+    chunk_t chunk = 0;
+    for (int32_t i = findElement(getBitIndex(chunkIndex)); i < _numElements && getChunkIndex(_elements[i]) == chunkIndex;
+         i++)
+        chunk |= getBitMask(_elements[i]);
+    return chunk;
+}
+
+void TR_BitVector::resetSparseLowAndHighChunks()
+{
+    if (_numElements == 0) {
+        _firstChunkWithNonZero = _numChunks;
+        _lastChunkWithNonZero = -1;
+    } else {
+        _firstChunkWithNonZero = getChunkIndex(_elements[0]);
+        _lastChunkWithNonZero = getChunkIndex(_elements[_numElements - 1]);
+    }
+}
+
+void TR_BitVector::ensureElementCapacity(int32_t capacity)
+{
+    if (capacity <= _elementCapacity)
+        return;
+    // Sparse vectors live in a region, so the old array is released with it
+    int32_t newCapacity = _elementCapacity ? _elementCapacity * 2 : 4;
+    if (newCapacity < capacity)
+        newCapacity = capacity;
+    int32_t* newElements = (int32_t*)_region->allocate(newCapacity * sizeof(int32_t));
+#ifdef TRACK_TRBITVECTOR_MEMORY
+    _memoryUsed += newCapacity * sizeof(int32_t);
+#endif
+    if (_numElements)
+        memcpy(newElements, _elements, _numElements * sizeof(int32_t));
+    _elements = newElements;
+    _elementCapacity = newCapacity;
+}
+
+void TR_BitVector::addElement(int32_t n)
+{
+    int32_t i = findElement(n);
+    if (i < _numElements && _elements[i] == n)
+        return;
+    if (_numElements >= sparseElementLimit()) {
+        densify();
+        set(n);
+        return;
+    }
+    ensureElementCapacity(_numElements + 1);
+    memmove(_elements + i + 1, _elements + i, (_numElements - i) * sizeof(int32_t));
+    _elements[i] = n;
+    _numElements++;
+    int32_t chunkIndex = getChunkIndex(n);
+    if (chunkIndex < _firstChunkWithNonZero)
+        _firstChunkWithNonZero = chunkIndex;
+    if (chunkIndex > _lastChunkWithNonZero)
+        _lastChunkWithNonZero = chunkIndex;
+#if BV_SANITY_CHECK
+    sanityCheck("addElement");
+#endif
+}
+
+void TR_BitVector::removeElement(int32_t n)
+{
+    int32_t i = findElement(n);
+    if (i == _numElements || _elements[i] != n)
+        return;
+    _numElements--;
+    memmove(_elements + i, _elements + i + 1, (_numElements - i) * sizeof(int32_t));
+    resetSparseLowAndHighChunks();
+#if BV_SANITY_CHECK
+    sanityCheck("removeElement");
+#endif
+}
+
+void TR_BitVector::removeElements(int64_t m, int64_t n)
+{
+    int32_t first = findElement(m);
+    int32_t last = findElement(n + 1);
+    if (first < last) {
+        memmove(_elements + first, _elements + last, (_numElements - last) * sizeof(int32_t));
+        _numElements -= last - first;
+        resetSparseLowAndHighChunks();
+    }
+#if BV_SANITY_CHECK
+    sanityCheck("removeElements");
+#endif
+}
+
+// Switch to the dense representation. The bits stay the same.
+//
+void TR_BitVector::densify()
+{
+    if (_chunks == NULL && _numChunks) {
+        _chunks = (chunk_t*)_region->allocate(_numChunks * sizeof(chunk_t));
+        memset(_chunks, 0, _numChunks * sizeof(chunk_t));
+#ifdef TRACK_TRBITVECTOR_MEMORY
+        _memoryUsed += _numChunks * sizeof(chunk_t);
+#endif
+    }
+    for (int32_t i = 0; i < _numElements; i++)
+        _chunks[getChunkIndex(_elements[i])] |= getBitMask(_elements[i]);
+    _numElements = 0;
+    _isSparse = false;
+#if BV_SANITY_CHECK
+    sanityCheck("densify");
+#endif
+}
+
+// Switch a dense vector to the sparse representation if it holds at most half as many bits as a sparse
+// vector of its size may, so that a vector near the limit does not keep changing representation.
+//
+void TR_BitVector::sparsify()
+{
+    int32_t limit = sparseElementLimit() / 2;
+    int32_t count = 0;
+    for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++) {
+        if (_chunks[i]) {
+            count += populationCount(_chunks[i]);
+            if (count > limit)
+                return;
+        }
+    }
+
+    ensureElementCapacity(count);
+    int32_t numElements = 0;
+    for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++) {
+        chunk_t chunk = _chunks[i];
+        while (chunk) {
+#if defined(BITVECTOR_BIT_NUMBERING_MSB)
+            int32_t bit = leadingZeroes(chunk);
+#else
+            int32_t bit = trailingZeroes(chunk);
+#endif
+            _elements[numElements++] = (int32_t)getBitIndex(i) + bit;
+            chunk &= ~getBitMask(bit);
+        }
+        _chunks[i] = 0;
+    }
+    _numElements = numElements;
+    _isSparse = true;
+#if BV_SANITY_CHECK
+    sanityCheck("sparsify");
+#endif
+}
+
+void TR_BitVector::assignSparse(const TR_BitVector& v2)
+{
+    if (_numChunks < v2._numChunks)
+        setChunkSize(v2._numChunks);
+
+    if (!v2._isSparse) {
+        densify();
+        *this = v2;
+        return;
+    }
+
+    if (!_isSparse && canBeSparse()) {
+        empty();
+        _isSparse = true;
+    }
+    if (_isSparse && v2._numElements <= sparseElementLimit()) {
+        ensureElementCapacity(v2._numElements);
+        memcpy(_elements, v2._elements, v2._numElements * sizeof(int32_t));
+        _numElements = v2._numElements;
+        resetSparseLowAndHighChunks();
+    } else {
+        if (_isSparse)
+            densify();
+        empty();
+        for (int32_t i = 0; i < v2._numElements; i++)
+            _chunks[getChunkIndex(v2._elements[i])] |= getBitMask(v2._elements[i]);
+        _firstChunkWithNonZero = v2._firstChunkWithNonZero;
+        _lastChunkWithNonZero = v2._lastChunkWithNonZero;
+    }
+#if BV_SANITY_CHECK
+    sanityCheck("assignSparse");
+#endif
+}
+
+void TR_BitVector::orSparse(TR_BitVector& v2)
+{
+    if (_numChunks < v2._numChunks)
+        setChunkSize(v2._numChunks);
+
+    if (_isSparse && v2._isSparse) {
+        // Count the union first, so the elements can be merged in place from the end
+        int32_t count = _numElements + v2._numElements;
+        for (int32_t i = 0, j = 0; i < _numElements && j < v2._numElements;) {
+            if (_elements[i] < v2._elements[j])
+                i++;
+            else if (_elements[i] > v2._elements[j])
+                j++;
+            else {
+                count--;
+                i++;
+                j++;
+            }
+        }
+        if (count <= sparseElementLimit()) {
+            ensureElementCapacity(count);
+            int32_t i = _numElements - 1;
+            int32_t j = v2._numElements - 1;
+            for (int32_t k = count - 1; k >= 0; k--) {
+                if (j < 0 || (i >= 0 && _elements[i] > v2._elements[j]))
+                    _elements[k] = _elements[i--];
+                else {
+                    if (i >= 0 && _elements[i] == v2._elements[j])
+                        i--;
+                    _elements[k] = v2._elements[j--];
+                }
+            }
+            _numElements = count;
+            resetSparseLowAndHighChunks();
+#if BV_SANITY_CHECK
+            sanityCheck("orSparse");
+#endif
+            return;
+        }
+    }
+
+    if (_isSparse)
+        densify();
+    if (!v2._isSparse) {
+        *this |= v2;
+        return;
+    }
+    for (int32_t i = 0; i < v2._numElements; i++)
+        _chunks[getChunkIndex(v2._elements[i])] |= getBitMask(v2._elements[i]);
+    if (_firstChunkWithNonZero > v2._firstChunkWithNonZero)
+        _firstChunkWithNonZero = v2._firstChunkWithNonZero;
+    if (_lastChunkWithNonZero < v2._lastChunkWithNonZero)
+        _lastChunkWithNonZero = v2._lastChunkWithNonZero;
+#if BV_SANITY_CHECK
+    sanityCheck("orSparse");
+#endif
+}
+
+void TR_BitVector::andSparse(TR_BitVector& v2)
+{
+    if (_isSparse) {
+        int32_t count = 0;
+        for (int32_t i = 0; i < _numElements; i++)
+            if (v2.get(_elements[i]))
+                _elements[count++] = _elements[i];
+        _numElements = count;
+        resetSparseLowAndHighChunks();
+#if BV_SANITY_CHECK
+        sanityCheck("andSparse");
+#endif
+        return;
+    }
+
+    // The result holds at most the bits of the sparse vector
+    int32_t count = 0;
+    for (int32_t i = 0; i < v2._numElements; i++)
+        if (get(v2._elements[i]))
+            count++;
+    if (canBeSparse() && count <= sparseElementLimit()) {
+        ensureElementCapacity(count);
+        int32_t numElements = 0;
+        for (int32_t i = 0; i < v2._numElements; i++)
+            if (get(v2._elements[i]))
+                _elements[numElements++] = v2._elements[i];
+        empty();
+        _numElements = numElements;
+        _isSparse = true;
+        resetSparseLowAndHighChunks();
+    } else {
+        int32_t j = 0;
+        for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++) {
+            chunk_t mask = 0;
+            for (; j < v2._numElements && getChunkIndex(v2._elements[j]) <= i; j++)
+                if (getChunkIndex(v2._elements[j]) == i)
+                    mask |= getBitMask(v2._elements[j]);
+            _chunks[i] &= mask;
+        }
+        resetLowAndHighChunks(_firstChunkWithNonZero, _lastChunkWithNonZero);
+    }
+#if BV_SANITY_CHECK
+    sanityCheck("andSparse");
+#endif
+}
+
+void TR_BitVector::subtractSparse(TR_BitVector& v2)
+{
+    if (_isSparse) {
+        int32_t count = 0;
+        for (int32_t i = 0; i < _numElements; i++)
+            if (!v2.get(_elements[i]))
+                _elements[count++] = _elements[i];
+        _numElements = count;
+        resetSparseLowAndHighChunks();
+    } else {
+        for (int32_t i = 0; i < v2._numElements; i++) {
+            int32_t chunkIndex = getChunkIndex(v2._elements[i]);
+            if (chunkIndex >= _firstChunkWithNonZero && chunkIndex <= _lastChunkWithNonZero)
+                _chunks[chunkIndex] &= ~getBitMask(v2._elements[i]);
+        }
+        resetLowAndHighChunks(_firstChunkWithNonZero, _lastChunkWithNonZero);
+        considerSparse();
+    }
+#if BV_SANITY_CHECK
+    sanityCheck("subtractSparse");
+#endif
+}
+
+bool TR_BitVector::intersectsSparse(TR_BitVector& v2)
+{
+    TR_BitVector& sparse = _isSparse ? *this : v2;
+    TR_BitVector& other = _isSparse ? v2 : *this;
+    for (int32_t i = 0; i < sparse._numElements; i++)
+        if (other.get(sparse._elements[i]))
+            return true;
+    return false;
+}
+
+bool TR_BitVector::equalsSparse(TR_BitVector& v2)
+{
+    if (_isSparse && v2._isSparse)
+        return _numElements == v2._numElements
+            && memcmp(_elements, v2._elements, _numElements * sizeof(int32_t)) == 0;
+    TR_BitVector& sparse = _isSparse ? *this : v2;
+    TR_BitVector& dense = _isSparse ? v2 : *this;
+    if (dense.elementCount() != sparse._numElements)
+        return false;
+    for (int32_t i = 0; i < sparse._numElements; i++)
+        if (!dense.get(sparse._elements[i]))
+            return false;
+    return true;
+}
+
+#if defined(TR_BITVECTOR_X86_VECTOR)
+// SSE2 is part of the x86-64 baseline; the AVX2 variants are selected at startup if the processor has it
+//
+static void orChunksSSE2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    for (; i + sizeof(__m128i) <= bytes; i += sizeof(__m128i))
+        _mm_storeu_si128((__m128i*)(t + i),
+            _mm_or_si128(_mm_loadu_si128((const __m128i*)(t + i)), _mm_loadu_si128((const __m128i*)(s + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] |= source[j];
+}
+
+static void andChunksSSE2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    for (; i + sizeof(__m128i) <= bytes; i += sizeof(__m128i))
+        _mm_storeu_si128((__m128i*)(t + i),
+            _mm_and_si128(_mm_loadu_si128((const __m128i*)(t + i)), _mm_loadu_si128((const __m128i*)(s + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] &= source[j];
+}
+
+static void andNotChunksSSE2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    // _mm_andnot_si128 complements its first operand
+    for (; i + sizeof(__m128i) <= bytes; i += sizeof(__m128i))
+        _mm_storeu_si128((__m128i*)(t + i),
+            _mm_andnot_si128(_mm_loadu_si128((const __m128i*)(s + i)), _mm_loadu_si128((const __m128i*)(t + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] &= ~source[j];
+}
+
+__attribute__((target("avx2"))) static void orChunksAVX2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    for (; i + sizeof(__m256i) <= bytes; i += sizeof(__m256i))
+        _mm256_storeu_si256((__m256i*)(t + i),
+            _mm256_or_si256(
+                _mm256_loadu_si256((const __m256i*)(t + i)), _mm256_loadu_si256((const __m256i*)(s + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] |= source[j];
+}
+
+__attribute__((target("avx2"))) static void andChunksAVX2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    for (; i + sizeof(__m256i) <= bytes; i += sizeof(__m256i))
+        _mm256_storeu_si256((__m256i*)(t + i),
+            _mm256_and_si256(
+                _mm256_loadu_si256((const __m256i*)(t + i)), _mm256_loadu_si256((const __m256i*)(s + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] &= source[j];
+}
+
+__attribute__((target("avx2"))) static void andNotChunksAVX2(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    uint8_t* t = (uint8_t*)target;
+    const uint8_t* s = (const uint8_t*)source;
+    size_t bytes = count * sizeof(chunk_t);
+    size_t i = 0;
+    for (; i + sizeof(__m256i) <= bytes; i += sizeof(__m256i))
+        _mm256_storeu_si256((__m256i*)(t + i),
+            _mm256_andnot_si256(
+                _mm256_loadu_si256((const __m256i*)(s + i)), _mm256_loadu_si256((const __m256i*)(t + i))));
+    for (int32_t j = i / sizeof(chunk_t); j < count; j++)
+        target[j] &= ~source[j];
+}
+#endif
+
+static void orChunksScalar(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+        target[i] |= source[i];
+}
+
+static void andChunksScalar(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+        target[i] &= source[i];
+}
+
+static void andNotChunksScalar(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+        target[i] &= ~source[i];
+}
+
+struct ChunkOperationTable {
+    TR_BitVector::ChunkOperations kind;
+    void (*orChunks)(chunk_t* target, const chunk_t* source, int32_t count);
+    void (*andChunks)(chunk_t* target, const chunk_t* source, int32_t count);
+    void (*andNotChunks)(chunk_t* target, const chunk_t* source, int32_t count);
+};
+
+static const ChunkOperationTable scalarChunkOperationTable
+    = { TR_BitVector::scalarChunkOperations, orChunksScalar, andChunksScalar, andNotChunksScalar };
+#if defined(TR_BITVECTOR_X86_VECTOR)
+static const ChunkOperationTable sse2ChunkOperationTable
+    = { TR_BitVector::sse2ChunkOperations, orChunksSSE2, andChunksSSE2, andNotChunksSSE2 };
+static const ChunkOperationTable avx2ChunkOperationTable
+    = { TR_BitVector::avx2ChunkOperations, orChunksAVX2, andChunksAVX2, andNotChunksAVX2 };
+#endif
+
+// The table for the given implementation, or NULL if the host does not support it
+//
+static const ChunkOperationTable* findChunkOperationTable(TR_BitVector::ChunkOperations operations)
+{
+    switch (operations) {
+    case TR_BitVector::scalarChunkOperations:
+        return &scalarChunkOperationTable;
+#if defined(TR_BITVECTOR_X86_VECTOR)
+    case TR_BitVector::sse2ChunkOperations:
+        return &sse2ChunkOperationTable;
+    case TR_BitVector::avx2ChunkOperations:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? &avx2ChunkOperationTable : NULL;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static const ChunkOperationTable* selectBestChunkOperationTable()
+{
+    const ChunkOperationTable* table = findChunkOperationTable(TR_BitVector::avx2ChunkOperations);
+    if (table == NULL)
+        table = findChunkOperationTable(TR_BitVector::sse2ChunkOperations);
+    if (table == NULL)
+        table = &scalarChunkOperationTable;
+    return table;
+}
+
+// Selected while the library is loaded, before any compilation can use it
+static const ChunkOperationTable* chunkOperationTable = selectBestChunkOperationTable();
+
+bool TR_BitVector::selectChunkOperations(ChunkOperations operations)
+{
+    const ChunkOperationTable* table = findChunkOperationTable(operations);
+    if (table == NULL)
+        return false;
+    chunkOperationTable = table;
+    return true;
+}
+
+TR_BitVector::ChunkOperations TR_BitVector::selectedChunkOperations()
+{
+    return chunkOperationTable->kind;
+}
+
+void TR_BitVector::bulkOrChunks(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    chunkOperationTable->orChunks(target, source, count);
+}
+
+void TR_BitVector::bulkAndChunks(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    chunkOperationTable->andChunks(target, source, count);
+}
+
+void TR_BitVector::bulkAndNotChunks(chunk_t* target, const chunk_t* source, int32_t count)
+{
+    chunkOperationTable->andNotChunks(target, source, count);
+}
+
+// -1 until the environment has been read
+static int32_t sparseRepresentation = -1;
+
+bool TR_BitVector::sparseRepresentationEnabled()
+{
+    if (sparseRepresentation < 0)
+        sparseRepresentation = feGetEnv("TR_EnableSparseBitVectors") != NULL ? 1 : 0;
+    return sparseRepresentation != 0;
+}
+
+void TR_BitVector::enableSparseRepresentation(bool enabled)
+{
+    sparseRepresentation = enabled ? 1 : 0;
+}
+
 void TR_BitVector::print(TR::Compilation* comp, TR::FILE* file)
 {
     if (comp->getDebug()) {
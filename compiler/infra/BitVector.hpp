@@ -258,6 +258,10 @@ public:
         , _lastChunkWithNonZero(-1)
         , _growable(growable)
         , _region(0)
+        , _elements(NULL)
+        , _numElements(0)
+        , _elementCapacity(0)
+        , _isSparse(false)
     {}
     TR_BitVector(TR::Region& region)
         : _numChunks(0)
@@ -266,6 +270,10 @@ public:
         , _lastChunkWithNonZero(-1)
         , _growable(growable)
         , _region(&region)
+        , _elements(NULL)
+        , _numElements(0)
+        , _elementCapacity(0)
+        , _isSparse(false)
     {}
 
     // Construct a bit vector with a certain number of bits pre-allocated.
@@ -279,6 +287,10 @@ public:
         _firstChunkWithNonZero = _numChunks;
         _lastChunkWithNonZero = -1;
         _region = NULL;
+        _elements = NULL;
+        _numElements = 0;
+        _elementCapacity = 0;
+        _isSparse = false;
         switch (allocKind) {
         case heapAlloc:
             _region = &(m->heapMemoryRegion());
@@ -295,7 +307,10 @@ public:
 #ifdef TRACK_TRBITVECTOR_MEMORY
         _memoryUsed = sizeof(TR_BitVector);
 #endif
-        if (_numChunks) {
+        if (canBeSparse()) {
+            // the chunks are only allocated if the vector fills up
+            _isSparse = true;
+        } else if (_numChunks) {
             if (_region) {
                 _chunks = (chunk_t*)_region->allocate(_numChunks * sizeof(chunk_t));
             } else {
@@ -319,10 +334,17 @@ public:
         _firstChunkWithNonZero = _numChunks;
         _lastChunkWithNonZero = -1;
         _region = &region;
+        _elements = NULL;
+        _numElements = 0;
+        _elementCapacity = 0;
+        _isSparse = false;
 #ifdef TRACK_TRBITVECTOR_MEMORY
         _memoryUsed = sizeof(TR_BitVector);
 #endif
-        if (_numChunks) {
+        if (canBeSparse()) {
+            // the chunks are only allocated if the vector fills up
+            _isSparse = true;
+        } else if (_numChunks) {
             _chunks = (chunk_t*)_region->allocate(_numChunks * sizeof(chunk_t));
             memset(_chunks, 0, _numChunks * sizeof(chunk_t));
 #ifdef TRACK_TRBITVECTOR_MEMORY
@@ -346,6 +368,10 @@ public:
         , _lastChunkWithNonZero(-1)
         , _chunks(NULL)
         , _growable(growable)
+        , _elements(NULL)
+        , _numElements(0)
+        , _elementCapacity(0)
+        , _isSparse(false)
     {
         _region = v2._region;
         *this = v2;
@@ -396,6 +422,10 @@ public:
         _numChunks = 0;
         _firstChunkWithNonZero = 0;
         _lastChunkWithNonZero = -1;
+        _elements = NULL;
+        _numElements = 0;
+        _elementCapacity = 0;
+        _isSparse = _region != NULL;
         setChunkSize(getChunkIndex(initBits - 1) + 1);
         _growable = growableOrNot;
     }
@@ -410,6 +440,10 @@ public:
         _numChunks = 0;
         _firstChunkWithNonZero = 0;
         _lastChunkWithNonZero = -1;
+        _elements = NULL;
+        _numElements = 0;
+        _elementCapacity = 0;
+        _isSparse = _region != NULL;
         setChunkSize(getChunkIndex(initBits - 1) + 1);
         _growable = growableOrNot;
     }
@@ -434,6 +468,8 @@ public:
         int32_t chunkIndex = getChunkIndex(n);
         if (chunkIndex > _lastChunkWithNonZero)
             return 0;
+        if (_isSparse)
+            return hasElement(n);
         return (_chunks[chunkIndex] & getBitMask(n)) != 0;
     }
 
@@ -450,6 +486,10 @@ public:
         int32_t chunkIndex = getChunkIndex(n);
         if (chunkIndex >= _numChunks)
             setChunkSize(chunkIndex + 1);
+        if (_isSparse) {
+            addElement(n);
+            return;
+        }
         if (chunkIndex < _firstChunkWithNonZero)
             _firstChunkWithNonZero = chunkIndex;
         if (chunkIndex > _lastChunkWithNonZero)
@@ -472,6 +512,8 @@ public:
     {
         if (_lastChunkWithNonZero < 0)
             return 0;
+        if (_isSparse)
+            return _elements[_numElements - 1];
         int chunkIndex = _lastChunkWithNonZero;
         for (int bitIndex = BITS_IN_CHUNK - 1; bitIndex >= 0; bitIndex--)
             if (_chunks[chunkIndex] & getBitMask(bitIndex))
@@ -487,6 +529,10 @@ public:
         int32_t i;
         if (chunkIndex > _lastChunkWithNonZero || chunkIndex < _firstChunkWithNonZero)
             return;
+        if (_isSparse) {
+            removeElement(n);
+            return;
+        }
         if (_chunks[chunkIndex]) {
             _chunks[chunkIndex] &= ~getBitMask(n);
             if (updateLowHigh && _chunks[chunkIndex] == 0)
@@ -515,6 +561,11 @@ public:
     //
     void operator=(const TR_BitVector& v2)
     {
+        if (_isSparse || v2._isSparse) {
+            assignSparse(v2);
+            return;
+        }
+
         int32_t i;
         int32_t v2Used = v2._numChunks;
 
@@ -550,6 +601,10 @@ public:
     {
         if (v2._lastChunkWithNonZero < 0)
             return; // other is empty
+        if (_isSparse || v2._isSparse) {
+            orSparse(v2);
+            return;
+        }
 
         // Grow the this vector if smaller than the 2nd vector
         int32_t v2Used = v2._numChunks;
@@ -557,8 +612,8 @@ public:
             setChunkSize(v2Used);
 
         // OR in all of the words from the 2nd vector
-        for (int32_t i = v2._firstChunkWithNonZero; i <= v2._lastChunkWithNonZero; i++)
-            _chunks[i] |= v2._chunks[i];
+        int32_t low = v2._firstChunkWithNonZero;
+        orChunks(_chunks + low, v2._chunks + low, v2._lastChunkWithNonZero - low + 1);
         if (_firstChunkWithNonZero > v2._firstChunkWithNonZero)
             _firstChunkWithNonZero = v2._firstChunkWithNonZero;
         if (_lastChunkWithNonZero < v2._lastChunkWithNonZero)
@@ -593,6 +648,10 @@ public:
 #endif
             return;
         }
+        if (_isSparse || v2._isSparse) {
+            andSparse(v2);
+            return;
+        }
 
         // Clear all the chunks before and after those set in the other vector
         int32_t i;
@@ -610,11 +669,11 @@ public:
         }
 
         // AND in all of the words from the 2nd vector
-        for (i = low; i <= high; i++)
-            _chunks[i] &= v2._chunks[i];
+        andChunks(_chunks + low, v2._chunks + low, high - low + 1);
 
         // Reset first and last chunks with non-zero
         resetLowAndHighChunks(low, high);
+        considerSparse();
 #if BV_SANITY_CHECK
         sanityCheck("operator&=");
 #endif
@@ -630,6 +689,8 @@ public:
         int32_t high = v2._lastChunkWithNonZero;
         if (high < _firstChunkWithNonZero || low > _lastChunkWithNonZero)
             return false; // No intersection
+        if (_isSparse || v2._isSparse)
+            return intersectsSparse(v2);
 
         // AND in all of the words from the 2nd vector
         if (low < _firstChunkWithNonZero)
@@ -653,17 +714,21 @@ public:
         int32_t high = v2._lastChunkWithNonZero;
         if (high < _firstChunkWithNonZero || low > _lastChunkWithNonZero)
             return; // No intersection
+        if (_isSparse || v2._isSparse) {
+            subtractSparse(v2);
+            return;
+        }
 
         // AND in the logical NOT of all of the words from the 2nd vector
         if (low < _firstChunkWithNonZero)
             low = _firstChunkWithNonZero;
         if (high > _lastChunkWithNonZero)
             high = _lastChunkWithNonZero;
-        for (int32_t i = low; i <= high; i++)
-            _chunks[i] &= ~v2._chunks[i];
+        andNotChunks(_chunks + low, v2._chunks + low, high - low + 1);
 
         // Reset first and last chunks with non-zero
         resetLowAndHighChunks(_firstChunkWithNonZero, _lastChunkWithNonZero);
+        considerSparse();
 #if BV_SANITY_CHECK
         sanityCheck("operator-=");
 #endif
@@ -700,6 +765,8 @@ public:
             return false;
         if (_lastChunkWithNonZero != v2._lastChunkWithNonZero)
             return false;
+        if (_isSparse || v2._isSparse)
+            return equalsSparse(v2);
         for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++)
             if (_chunks[i] != v2._chunks[i])
                 return false;
@@ -717,6 +784,8 @@ public:
     {
         if (n <= 0)
             return;
+        if (_isSparse)
+            densify();
         int32_t i;
         int32_t chunkIndex = getChunkIndex(n - 1);
         if (chunkIndex >= _numChunks)
@@ -737,6 +806,8 @@ public:
     //
     void setAll(int64_t m, int64_t n)
     {
+        if (_isSparse)
+            densify();
         int32_t firstChunk = getChunkIndex(m);
         int32_t lastChunk = getChunkIndex(n);
         if (lastChunk >= _numChunks) {
@@ -795,8 +866,12 @@ public:
     //
     void empty()
     {
-        for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++)
-            _chunks[i] = 0;
+        if (_isSparse)
+            _numElements = 0;
+        else {
+            for (int32_t i = _firstChunkWithNonZero; i <= _lastChunkWithNonZero; i++)
+                _chunks[i] = 0;
+        }
         _firstChunkWithNonZero = _numChunks;
         _lastChunkWithNonZero = -1;
 #if BV_SANITY_CHECK
@@ -813,6 +888,10 @@ public:
         int32_t lastChunk = getChunkIndex(n);
         if (_lastChunkWithNonZero < firstChunk || _firstChunkWithNonZero > lastChunk)
             return; // All relevant bits are already reset
+        if (_isSparse) {
+            removeElements(m, n);
+            return;
+        }
         if (lastChunk >= _numChunks) {
             setChunkSize(getChunkIndex(n));
         }
@@ -907,6 +986,34 @@ public:
         return sizeof(chunk_t);
     }
 
+    // True while the vector holds its bits in a sorted array rather than in chunks
+    //
+    bool isSparse()
+    {
+        return _isSparse;
+    }
+
+    // Vectors are dense unless the environment variable TR_EnableSparseBitVectors is set, since no
+    // compile time or memory gain has been measured for the sparse representation yet
+    //
+    static bool sparseRepresentationEnabled();
+
+    // Override the environment variable, for instance to test the sparse representation, as long as no
+    // compilation is running
+    //
+    static void enableSparseRepresentation(bool enabled);
+
+    // The implementations of the bulk |=, &= and -= operations over many chunks
+    //
+    enum ChunkOperations { scalarChunkOperations, sse2ChunkOperations, avx2ChunkOperations };
+
+    // The best implementation the host supports is selected at startup. Another one can be selected, for
+    // instance to test it, as long as no compilation is running. Returns false if the host does not
+    // support the given implementation.
+    //
+    static bool selectChunkOperations(ChunkOperations operations);
+    static ChunkOperations selectedChunkOperations();
+
 #ifdef TRACK_TRBITVECTOR_MEMORY
     uint32_t MemoryUsage()
     {
@@ -930,9 +1037,117 @@ private:
     int32_t _lastChunkWithNonZero; // == -1 if empty
     TR_BitVectorGrowable _growable;
 
+    // A large vector allocated in a region that holds few bits keeps them as a sorted array of bit
+    // indices instead. _numChunks is still the size of the vector, and _firstChunkWithNonZero and
+    // _lastChunkWithNonZero are maintained from the elements. _chunks is either NULL or all zero,
+    // and it is allocated or reused once the vector becomes dense again.
+    int32_t* _elements;
+    int32_t _numElements;
+    int32_t _elementCapacity;
+    bool _isSparse;
+
+    // Vectors smaller than this many chunks are always dense
+    static const int32_t sparseMinimumChunks = 8;
+    // A sparse vector becomes dense when it would hold more elements than this
+    static const int32_t sparseMaximumElements = 256;
+    // Bulk operations over at least this many chunks use the vector instructions of the host, if any
+    static const int32_t bulkOperationChunks = 8;
+
     friend class TR_BitVectorIterator;
     friend class CS2_TR_BitVector;
 
+    bool canBeSparse()
+    {
+        return sparseRepresentationEnabled() && _region != NULL && _numChunks >= sparseMinimumChunks
+            && _numChunks <= (0x7fffffff >> SHIFT);
+    }
+
+    int32_t sparseElementLimit()
+    {
+        return _numChunks / 2 < sparseMaximumElements ? _numChunks / 2 : sparseMaximumElements;
+    }
+
+    // The index of the first element that is not less than n
+    //
+    int32_t findElement(int64_t n)
+    {
+        int32_t low = 0;
+        int32_t high = _numElements;
+        while (low < high) {
+            int32_t middle = (low + high) >> 1;
+            if (_elements[middle] < n)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        return low;
+    }
+
+    bool hasElement(int64_t n)
+    {
+        int32_t i = findElement(n);
+        return i < _numElements && _elements[i] == n;
+    }
+
+    // Switch a dense vector that holds few bits to the sparse representation
+    //
+    void considerSparse()
+    {
+        if (_lastChunkWithNonZero >= 0 && canBeSparse())
+            sparsify();
+    }
+
+    chunk_t getChunk(int32_t chunkIndex);
+    void addElement(int32_t n);
+    void removeElement(int32_t n);
+    void removeElements(int64_t m, int64_t n);
+    void ensureElementCapacity(int32_t capacity);
+    void resetSparseLowAndHighChunks();
+    void densify();
+    void sparsify();
+
+    // Operations where at least one of the vectors is sparse
+    void assignSparse(const TR_BitVector& v2);
+    void orSparse(TR_BitVector& v2);
+    void andSparse(TR_BitVector& v2);
+    void subtractSparse(TR_BitVector& v2);
+    bool intersectsSparse(TR_BitVector& v2);
+    bool equalsSparse(TR_BitVector& v2);
+
+    static void orChunks(chunk_t* target, const chunk_t* source, int32_t count)
+    {
+        if (count >= bulkOperationChunks) {
+            bulkOrChunks(target, source, count);
+            return;
+        }
+        for (int32_t i = 0; i < count; i++)
+            target[i] |= source[i];
+    }
+
+    static void andChunks(chunk_t* target, const chunk_t* source, int32_t count)
+    {
+        if (count >= bulkOperationChunks) {
+            bulkAndChunks(target, source, count);
+            return;
+        }
+        for (int32_t i = 0; i < count; i++)
+            target[i] &= source[i];
+    }
+
+    static void andNotChunks(chunk_t* target, const chunk_t* source, int32_t count)
+    {
+        if (count >= bulkOperationChunks) {
+            bulkAndNotChunks(target, source, count);
+            return;
+        }
+        for (int32_t i = 0; i < count; i++)
+            target[i] &= ~source[i];
+    }
+
+    static void bulkOrChunks(chunk_t* target, const chunk_t* source, int32_t count);
+    static void bulkAndChunks(chunk_t* target, const chunk_t* source, int32_t count);
+    static void bulkAndNotChunks(chunk_t* target, const chunk_t* source, int32_t count);
+
     // Re-calculate the first and last chunks with non-zero
     void resetLowAndHighChunks(int32_t low, int32_t high)
     {
@@ -959,7 +1174,12 @@ private:
         // and check them against the stored values
         int32_t low, high;
         int32_t i;
-        if (!_chunks) {
+        if (_isSparse) {
+            for (i = 1; i < _numElements; i++)
+                TR_ASSERT(_elements[i - 1] < _elements[i], "TR_BitVector sparse elements out of order");
+            low = _numElements ? getChunkIndex(_elements[0]) : _numChunks;
+            high = _numElements ? getChunkIndex(_elements[_numElements - 1]) : -1;
+        } else if (!_chunks) {
             low = 0;
             high = -1;
         } else {
@@ -1113,6 +1333,14 @@ protected:
     void getNextBit()
     {
         _curIndex++;
+        if (_bitVector->_isSparse) {
+            int32_t i = _bitVector->findElement(_curIndex);
+            if (i < _bitVector->_numElements)
+                _curIndex = _bitVector->_elements[i];
+            else
+                _curIndex = _bitVector->_numChunks << SHIFT;
+            return;
+        }
         int32_t curChunk = TR_BitVector::getChunkIndex(_curIndex);
         if (curChunk > _bitVector->_lastChunkWithNonZero) {
             // No more chunks with non-zero bits
@@ -1351,7 +1579,7 @@ public:
     {
         if (wordIndex >= bv._numChunks)
             return 0;
-        return bv._chunks[wordIndex];
+        return bv.getChunk(wordIndex);
     }
 
     bool IsZero() const
@@ -1495,7 +1723,8 @@ inline TR_BitVector& TR_BitVector::operator-=(const BitVector& sparse)
     for (bi.SetToFirstOne(); bi.Valid() && bi <= highBit; bi.SetToNextOne()) {
         reset(bi, false);
     }
-    resetLowAndHighChunks(_firstChunkWithNonZero, _lastChunkWithNonZero);
+    if (!_isSparse)
+        resetLowAndHighChunks(_firstChunkWithNonZero, _lastChunkWithNonZero);
 #if BV_SANITY_CHECK
     sanityCheck("operator-=(sparse)");
 #endif
@@ -1513,6 +1742,8 @@ inline TR_BitVector& TR_BitVector::operator&=(const BitVector& sparse)
         empty();
         return *this;
     }
+    if (_isSparse)
+        densify();
 
     // AND the common chunks
     uint32_t low = _firstChunkWithNonZero;
@@ -1566,6 +1797,8 @@ inline TR_BitVector& TR_BitVector::operator|=(const BitVector& sparse)
     uint32_t last = sparse.LastOne();
 
     ensureBits(last);
+    if (_isSparse)
+        densify();
     typename BitVector::Cursor bi(sparse);
     for (bi.SetToFirstOne(); bi.Valid(); bi.SetToNextOne()) {
         _chunks[getChunkIndex(bi)] |= getBitMask(bi);
@@ -69,6 +69,17 @@ struct OptimizationStrategy;
 
 typedef TR::Optimization* (*OptimizationFactory)(TR::OptimizationManager* m);
 
+/**
+ * Describes how to create the manager of an optimization or of an optimization group. This does not depend on
+ * the compilation, so front ends keep their descriptors in static const tables shared by all compilations.
+ * A table ends with an entry for OMR::endOpts.
+ */
+struct OptimizationManagerDescriptor {
+    OMR::Optimizations _num;
+    OptimizationFactory _factory; /**< NULL for groups */
+    const OptimizationStrategy* _groupOfOpts; /**< the optimizations of a group, NULL for optimizations */
+};
+
 namespace OMR {
 
 class OMR_EXTENSIBLE OptimizationManager {
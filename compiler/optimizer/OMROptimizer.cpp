@@ -112,6 +112,7 @@
 #include "optimizer/RecognizedCallTransformer.hpp"
 #include "optimizer/SwitchAnalyzer.hpp"
 #include "env/RegionProfiler.hpp"
+#include "optimizer/OptimizationProfiler.hpp"
 
 #if defined(_MSC_VER) && _MSC_VER < 1900
 #define snprintf _snprintf
@@ -638,6 +639,113 @@ TR::Optimizer* OMR::Optimizer::createOptimizer(
     return optimizer;
 }
 
+#if !defined(TR_OVERRIDE_OPTIMIZATION_INITIALIZATION)
+/*
+ * The managers of the OMR optimizations and optimization groups. Downstream projects can define
+ * TR_OVERRIDE_OPTIMIZATION_INITIALIZATION to take full control over this process. This can be an advantage
+ * if they don't use all of the optimizations listed here as they can avoid getting linked in to the binary
+ * in their entirety.
+ */
+static const OptimizationManagerDescriptor omrOptimizationManagers[] = {
+    // OMR optimizations
+    { OMR::andSimplification, TR_SimplifyAnds::create },
+    { OMR::arraysetStoreElimination, TR_ArraysetStoreElimination::create },
+    { OMR::asyncCheckInsertion, TR_AsyncCheckInsertion::create },
+    { OMR::basicBlockExtension, TR_ExtendBasicBlocks::create },
+    { OMR::basicBlockHoisting, TR_HoistBlocks::create },
+    { OMR::basicBlockOrdering, TR_OrderBlocks::create },
+    { OMR::basicBlockPeepHole, TR_PeepHoleBasicBlocks::create },
+    { OMR::blockShuffling, TR_BlockShuffling::create },
+    { OMR::blockSplitter, TR_BlockSplitter::create },
+    { OMR::catchBlockRemoval, TR_CatchBlockRemover::create },
+    { OMR::CFGSimplification, TR::CFGSimplifier::create },
+    { OMR::checkcastAndProfiledGuardCoalescer, TR_CheckcastAndProfiledGuardCoalescer::create },
+    { OMR::coldBlockMarker, TR_ColdBlockMarker::create },
+    { OMR::coldBlockOutlining, TR_ColdBlockOutlining::create },
+    { OMR::compactLocals, TR_CompactLocals::create },
+    { OMR::compactNullChecks, TR_CompactNullChecks::create },
+    { OMR::deadTreesElimination, TR::DeadTreesElimination::create },
+    { OMR::expressionsSimplification, TR_ExpressionsSimplification::create },
+    { OMR::generalLoopUnroller, TR_GeneralLoopUnroller::create },
+    { OMR::globalCopyPropagation, TR_CopyPropagation::create },
+    { OMR::globalDeadStoreElimination, TR_DeadStoreElimination::create },
+    { OMR::inlining, TR_TrivialInliner::create },
+    { OMR::innerPreexistence, TR_InnerPreexistence::create },
+    { OMR::invariantArgumentPreexistence, TR_InvariantArgumentPreexistence::create },
+    { OMR::loadExtensions, TR_LoadExtensions::create },
+    { OMR::localCSE, TR::LocalCSE::create },
+    { OMR::localDeadStoreElimination, TR::LocalDeadStoreElimination::create },
+    { OMR::localLiveRangeReduction, TR_LocalLiveRangeReduction::create },
+    { OMR::localReordering, TR_LocalReordering::create },
+    { OMR::loopCanonicalization, TR_LoopCanonicalizer::create },
+    { OMR::loopVersioner, TR_LoopVersioner::create },
+    { OMR::loopReduction, TR_LoopReducer::create },
+    { OMR::loopReplicator, TR_LoopReplicator::create },
+    { OMR::profiledNodeVersioning, TR_ProfiledNodeVersioning::create },
+    { OMR::redundantAsyncCheckRemoval, TR_RedundantAsyncCheckRemoval::create },
+    { OMR::redundantGotoElimination, TR_EliminateRedundantGotos::create },
+    { OMR::rematerialization, TR_Rematerialization::create },
+    { OMR::treesCleansing, TR_CleanseTrees::create },
+    { OMR::treeSimplification, TR::Simplifier::create },
+    { OMR::trivialBlockExtension, TR_TrivialBlockExtension::create },
+    { OMR::trivialDeadTreeRemoval, TR_TrivialDeadTreeRemoval::create },
+    { OMR::virtualGuardHeadMerger, TR_VirtualGuardHeadMerger::create },
+    { OMR::virtualGuardTailSplitter, TR_VirtualGuardTailSplitter::create },
+    { OMR::generalStoreSinking, TR_GeneralSinkStores::create },
+    { OMR::globalValuePropagation, TR::GlobalValuePropagation::create },
+    { OMR::localValuePropagation, TR::LocalValuePropagation::create },
+    { OMR::redundantInductionVarElimination, TR_RedundantInductionVarElimination::create },
+    { OMR::partialRedundancyElimination, TR_PartialRedundancy::create },
+    { OMR::loopInversion, TR_LoopInverter::create },
+    { OMR::inductionVariableAnalysis, TR_InductionVariableAnalysis::create },
+    { OMR::osrExceptionEdgeRemoval, TR_OSRExceptionEdgeRemoval::create },
+    { OMR::regDepCopyRemoval, TR::RegDepCopyRemoval::create },
+    { OMR::prefetchInsertion, TR_PrefetchInsertion::create },
+    { OMR::stripMining, TR_StripMiner::create },
+    { OMR::fieldPrivatization, TR_FieldPrivatizer::create },
+    { OMR::reorderArrayIndexExpr, TR_IndexExprManipulator::create },
+    { OMR::loopStrider, TR_LoopStrider::create },
+    { OMR::osrDefAnalysis, TR_OSRDefAnalysis::create },
+    { OMR::osrLiveRangeAnalysis, TR_OSRLiveRangeAnalysis::create },
+    { OMR::tacticalGlobalRegisterAllocator, TR_GlobalRegisterAllocator::create },
+    { OMR::liveRangeSplitter, TR_LiveRangeSplitter::create },
+    { OMR::loopSpecializer, TR_LoopSpecializer::create },
+    { OMR::recognizedCallTransformer, TR::RecognizedCallTransformer::create },
+    { OMR::switchAnalyzer, TR::SwitchAnalyzer::create },
+
+    // NOTE: Please add new OMR optimizations here!
+
+    // OMR optimization groups
+    { OMR::globalDeadStoreGroup, NULL, globalDeadStoreOpts },
+    { OMR::loopCanonicalizationGroup, NULL, loopCanonicalizationOpts },
+    { OMR::loopVersionerGroup, NULL, loopVersionerOpts },
+    { OMR::lastLoopVersionerGroup, NULL, lastLoopVersionerOpts },
+    { OMR::methodHandleInvokeInliningGroup, NULL, methodHandleInvokeInliningOpts },
+    { OMR::earlyGlobalGroup, NULL, earlyGlobalOpts },
+    { OMR::earlyLocalGroup, NULL, earlyLocalOpts },
+    { OMR::stripMiningGroup, NULL, stripMiningOpts },
+    { OMR::arrayPrivatizationGroup, NULL, arrayPrivatizationOpts },
+    { OMR::veryCheapGlobalValuePropagationGroup, NULL, veryCheapGlobalValuePropagationOpts },
+    { OMR::eachExpensiveGlobalValuePropagationGroup, NULL, eachExpensiveGlobalValuePropagationOpts },
+    { OMR::veryExpensiveGlobalValuePropagationGroup, NULL, veryExpensiveGlobalValuePropagationOpts },
+    { OMR::loopSpecializerGroup, NULL, loopSpecializerOpts },
+    { OMR::prefetchInsertionGroup, NULL, prefetchInsertionOpts },
+    { OMR::lateLocalGroup, NULL, lateLocalOpts },
+    { OMR::eachLocalAnalysisPassGroup, NULL, eachLocalAnalysisPassOpts },
+    { OMR::tacticalGlobalRegisterAllocatorGroup, NULL, tacticalGlobalRegisterAllocatorOpts },
+    { OMR::partialRedundancyEliminationGroup, NULL, partialRedundancyEliminationOpts },
+    { OMR::reorderArrayExprGroup, NULL, reorderArrayIndexOpts },
+    { OMR::blockManipulationGroup, NULL, blockManipulationOpts },
+    { OMR::localValuePropagationGroup, NULL, localValuePropagationOpts },
+    { OMR::finalGlobalGroup, NULL, finalGlobalOpts },
+
+    // NOTE: Please add new OMR optimization groups here!
+
+    { OMR::endOpts },
+};
+#endif
+
+
 // ************************************************************************
 //
 // Implementation of TR::Optimizer
@@ -674,200 +782,25 @@ OMR::Optimizer::Optimizer(TR::Compilation* comp, TR::ResolvedMethodSymbol* metho
     , _stackedOptimizer(false)
     , _firstTimeStructureIsBuilt(true)
     , _disableLoopOptsThatCanCreateLoops(false)
+    , _optDepth(1)
 {
     // zero opts table
     memset(_opts, 0, sizeof(_opts));
 
-/*
- * Allow downstream projects to disable the default initialization of optimizations
- * and allow them to take full control over this process.  This can be an advantage
- * if they don't use all of the optimizations initialized here as they can avoid
- * getting linked in to the binary in their entirety.
- */
 #if !defined(TR_OVERRIDE_OPTIMIZATION_INITIALIZATION)
-    // initialize OMR optimizations
-
-    _opts[OMR::andSimplification]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_SimplifyAnds::create, OMR::andSimplification);
-    _opts[OMR::arraysetStoreElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ArraysetStoreElimination::create, OMR::arraysetStoreElimination);
-    _opts[OMR::asyncCheckInsertion] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_AsyncCheckInsertion::create, OMR::asyncCheckInsertion);
-    _opts[OMR::basicBlockExtension] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ExtendBasicBlocks::create, OMR::basicBlockExtension);
-    _opts[OMR::basicBlockHoisting]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_HoistBlocks::create, OMR::basicBlockHoisting);
-    _opts[OMR::basicBlockOrdering]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_OrderBlocks::create, OMR::basicBlockOrdering);
-    _opts[OMR::basicBlockPeepHole] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_PeepHoleBasicBlocks::create, OMR::basicBlockPeepHole);
-    _opts[OMR::blockShuffling]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_BlockShuffling::create, OMR::blockShuffling);
-    _opts[OMR::blockSplitter]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_BlockSplitter::create, OMR::blockSplitter);
-    _opts[OMR::catchBlockRemoval]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_CatchBlockRemover::create, OMR::catchBlockRemoval);
-    _opts[OMR::CFGSimplification]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR::CFGSimplifier::create, OMR::CFGSimplification);
-    _opts[OMR::checkcastAndProfiledGuardCoalescer] = new (comp->allocator()) TR::OptimizationManager(
-        self(), TR_CheckcastAndProfiledGuardCoalescer::create, OMR::checkcastAndProfiledGuardCoalescer);
-    _opts[OMR::coldBlockMarker]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_ColdBlockMarker::create, OMR::coldBlockMarker);
-    _opts[OMR::coldBlockOutlining] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ColdBlockOutlining::create, OMR::coldBlockOutlining);
-    _opts[OMR::compactLocals]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_CompactLocals::create, OMR::compactLocals);
-    _opts[OMR::compactNullChecks]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_CompactNullChecks::create, OMR::compactNullChecks);
-    _opts[OMR::deadTreesElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::DeadTreesElimination::create, OMR::deadTreesElimination);
-    _opts[OMR::expressionsSimplification] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ExpressionsSimplification::create, OMR::expressionsSimplification);
-    _opts[OMR::generalLoopUnroller] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_GeneralLoopUnroller::create, OMR::generalLoopUnroller);
-    _opts[OMR::globalCopyPropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_CopyPropagation::create, OMR::globalCopyPropagation);
-    _opts[OMR::globalDeadStoreElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_DeadStoreElimination::create, OMR::globalDeadStoreElimination);
-    _opts[OMR::inlining]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_TrivialInliner::create, OMR::inlining);
-    _opts[OMR::innerPreexistence]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_InnerPreexistence::create, OMR::innerPreexistence);
-    _opts[OMR::invariantArgumentPreexistence] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_InvariantArgumentPreexistence::create, OMR::invariantArgumentPreexistence);
-    _opts[OMR::loadExtensions]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoadExtensions::create, OMR::loadExtensions);
-    _opts[OMR::localCSE] = new (comp->allocator()) TR::OptimizationManager(self(), TR::LocalCSE::create, OMR::localCSE);
-    _opts[OMR::localDeadStoreElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::LocalDeadStoreElimination::create, OMR::localDeadStoreElimination);
-    _opts[OMR::localLiveRangeReduction] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_LocalLiveRangeReduction::create, OMR::localLiveRangeReduction);
-    _opts[OMR::localReordering]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LocalReordering::create, OMR::localReordering);
-    _opts[OMR::loopCanonicalization] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
-    _opts[OMR::loopVersioner]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVersioner::create, OMR::loopVersioner);
-    _opts[OMR::loopReduction]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReducer::create, OMR::loopReduction);
-    _opts[OMR::loopReplicator]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopReplicator::create, OMR::loopReplicator);
-    _opts[OMR::profiledNodeVersioning] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ProfiledNodeVersioning::create, OMR::profiledNodeVersioning);
-    _opts[OMR::redundantAsyncCheckRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_RedundantAsyncCheckRemoval::create, OMR::redundantAsyncCheckRemoval);
-    _opts[OMR::redundantGotoElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_EliminateRedundantGotos::create, OMR::redundantGotoElimination);
-    _opts[OMR::rematerialization]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_Rematerialization::create, OMR::rematerialization);
-    _opts[OMR::treesCleansing]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_CleanseTrees::create, OMR::treesCleansing);
-    _opts[OMR::treeSimplification]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR::Simplifier::create, OMR::treeSimplification);
-    _opts[OMR::trivialBlockExtension] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_TrivialBlockExtension::create, OMR::trivialBlockExtension);
-    _opts[OMR::trivialDeadTreeRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_TrivialDeadTreeRemoval::create, OMR::trivialDeadTreeRemoval);
-    _opts[OMR::virtualGuardHeadMerger] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_VirtualGuardHeadMerger::create, OMR::virtualGuardHeadMerger);
-    _opts[OMR::virtualGuardTailSplitter] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_VirtualGuardTailSplitter::create, OMR::virtualGuardTailSplitter);
-    _opts[OMR::generalStoreSinking] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_GeneralSinkStores::create, OMR::generalStoreSinking);
-    _opts[OMR::globalValuePropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::GlobalValuePropagation::create, OMR::globalValuePropagation);
-    _opts[OMR::localValuePropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::LocalValuePropagation::create, OMR::localValuePropagation);
-    _opts[OMR::redundantInductionVarElimination] = new (comp->allocator()) TR::OptimizationManager(
-        self(), TR_RedundantInductionVarElimination::create, OMR::redundantInductionVarElimination);
-    _opts[OMR::partialRedundancyElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_PartialRedundancy::create, OMR::partialRedundancyElimination);
-    _opts[OMR::loopInversion]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopInverter::create, OMR::loopInversion);
-    _opts[OMR::inductionVariableAnalysis] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis);
-    _opts[OMR::osrExceptionEdgeRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_OSRExceptionEdgeRemoval::create, OMR::osrExceptionEdgeRemoval);
-    _opts[OMR::regDepCopyRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::RegDepCopyRemoval::create, OMR::regDepCopyRemoval);
-    _opts[OMR::prefetchInsertion]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_PrefetchInsertion::create, OMR::prefetchInsertion);
-    _opts[OMR::stripMining]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_StripMiner::create, OMR::stripMining);
-    _opts[OMR::fieldPrivatization]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_FieldPrivatizer::create, OMR::fieldPrivatization);
-    _opts[OMR::reorderArrayIndexExpr] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_IndexExprManipulator::create, OMR::reorderArrayIndexExpr);
-    _opts[OMR::loopStrider]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopStrider::create, OMR::loopStrider);
-    _opts[OMR::osrDefAnalysis]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_OSRDefAnalysis::create, OMR::osrDefAnalysis);
-    _opts[OMR::osrLiveRangeAnalysis] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_OSRLiveRangeAnalysis::create, OMR::osrLiveRangeAnalysis);
-    _opts[OMR::tacticalGlobalRegisterAllocator] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
-    _opts[OMR::liveRangeSplitter]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LiveRangeSplitter::create, OMR::liveRangeSplitter);
-    _opts[OMR::loopSpecializer]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopSpecializer::create, OMR::loopSpecializer);
-    _opts[OMR::recognizedCallTransformer] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::RecognizedCallTransformer::create, OMR::recognizedCallTransformer);
-    _opts[OMR::switchAnalyzer]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
-
-    // NOTE: Please add new OMR optimizations here!
-
-    // initialize OMR optimization groups
-
-    _opts[OMR::globalDeadStoreGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::globalDeadStoreGroup, globalDeadStoreOpts);
-    _opts[OMR::loopCanonicalizationGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::loopCanonicalizationGroup, loopCanonicalizationOpts);
-    _opts[OMR::loopVersionerGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::loopVersionerGroup, loopVersionerOpts);
-    _opts[OMR::lastLoopVersionerGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::lastLoopVersionerGroup, lastLoopVersionerOpts);
-    _opts[OMR::methodHandleInvokeInliningGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::methodHandleInvokeInliningGroup, methodHandleInvokeInliningOpts);
-    _opts[OMR::earlyGlobalGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::earlyGlobalGroup, earlyGlobalOpts);
-    _opts[OMR::earlyLocalGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::earlyLocalGroup, earlyLocalOpts);
-    _opts[OMR::stripMiningGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::stripMiningGroup, stripMiningOpts);
-    _opts[OMR::arrayPrivatizationGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::arrayPrivatizationGroup, arrayPrivatizationOpts);
-    _opts[OMR::veryCheapGlobalValuePropagationGroup] = new (comp->allocator()) TR::OptimizationManager(
-        self(), NULL, OMR::veryCheapGlobalValuePropagationGroup, veryCheapGlobalValuePropagationOpts);
-    _opts[OMR::eachExpensiveGlobalValuePropagationGroup] = new (comp->allocator()) TR::OptimizationManager(
-        self(), NULL, OMR::eachExpensiveGlobalValuePropagationGroup, eachExpensiveGlobalValuePropagationOpts);
-    _opts[OMR::veryExpensiveGlobalValuePropagationGroup] = new (comp->allocator()) TR::OptimizationManager(
-        self(), NULL, OMR::veryExpensiveGlobalValuePropagationGroup, veryExpensiveGlobalValuePropagationOpts);
-    _opts[OMR::loopSpecializerGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::loopSpecializerGroup, loopSpecializerOpts);
-    _opts[OMR::prefetchInsertionGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::prefetchInsertionGroup, prefetchInsertionOpts);
-    _opts[OMR::lateLocalGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::lateLocalGroup, lateLocalOpts);
-    _opts[OMR::eachLocalAnalysisPassGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::eachLocalAnalysisPassGroup, eachLocalAnalysisPassOpts);
-    _opts[OMR::tacticalGlobalRegisterAllocatorGroup] = new (comp->allocator()) TR::OptimizationManager(
-        self(), NULL, OMR::tacticalGlobalRegisterAllocatorGroup, tacticalGlobalRegisterAllocatorOpts);
-    _opts[OMR::partialRedundancyEliminationGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::partialRedundancyEliminationGroup, partialRedundancyEliminationOpts);
-    _opts[OMR::reorderArrayExprGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::reorderArrayExprGroup, reorderArrayIndexOpts);
-    _opts[OMR::blockManipulationGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::blockManipulationGroup, blockManipulationOpts);
-    _opts[OMR::localValuePropagationGroup] = new (comp->allocator())
-        TR::OptimizationManager(self(), NULL, OMR::localValuePropagationGroup, localValuePropagationOpts);
-    _opts[OMR::finalGlobalGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::finalGlobalGroup, finalGlobalOpts);
-
-    // NOTE: Please add new OMR optimization groups here!
+    createOptimizationManagers(omrOptimizationManagers);
 #endif
 }
 
+void OMR::Optimizer::createOptimizationManagers(const OptimizationManagerDescriptor* descriptors)
+{
+    TR::Compilation* comp = self()->comp();
+    for (const OptimizationManagerDescriptor* d = descriptors; d->_num != OMR::endOpts; d++) {
+        _opts[d->_num]
+            = new (comp->allocator()) TR::OptimizationManager(self(), d->_factory, d->_num, d->_groupOfOpts);
+    }
+}
+
 // Note: optimizer_name array needs to match Optimizations enum defined
 // in compiler/optimizer/Optimizations.hpp
 static const char* optimizer_name[] = {
@@ -1108,9 +1041,8 @@ void OMR::Optimizer::dumpPostOptTrees()
         comp()->dumpMethodTrees("Post Optimization Trees");
 }
 
-void dumpName(TR::Optimizer* op, TR_FrontEnd* fe, TR::Compilation* comp, OMR::Optimizations optNum)
+void dumpName(TR::Optimizer* op, TR_FrontEnd* fe, TR::Compilation* comp, OMR::Optimizations optNum, int level = 1)
 {
-    static int level = 1;
     TR::OptimizationManager* manager = op->getOptimization(optNum);
 
     if (level > 6)
@@ -1119,17 +1051,13 @@ void dumpName(TR::Optimizer* op, TR_FrontEnd* fe, TR::Compilation* comp, OMR::Op
     if (optNum > endGroup && optNum < OMR::numGroups) {
         trfprintf(comp->getOutFile(), "%*s<%s>\n", level * 6, " ", manager->name());
 
-        level++;
-
         const OptimizationStrategy* subGroup = ((TR::OptimizationManager*)manager)->groupOfOpts();
 
         while (subGroup->_num != endOpts && subGroup->_num != endGroup) {
-            dumpName(op, fe, comp, subGroup->_num);
+            dumpName(op, fe, comp, subGroup->_num, level + 1);
             subGroup++;
         }
 
-        level--;
-
         trfprintf(comp->getOutFile(), "%*s</%s>", level * 6, " ", manager->name());
     } else if (optNum > endOpts && optNum < OMR::numOpts)
         trfprintf(comp->getOutFile(), "%*s%s", level * 6, " ", manager->name());
@@ -1457,7 +1385,6 @@ int32_t OMR::Optimizer::performOptimization(
         doThisOptimization = false;
 
     int32_t actualCost = 0;
-    static int32_t optDepth = 1;
 
     TR_FrontEnd* fe = comp()->fe();
 
@@ -1468,10 +1395,10 @@ int32_t OMR::Optimizer::performOptimization(
         if (comp()->getOption(TR_TraceOptDetails) || comp()->getOption(TR_TraceOptTrees)
             || comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                traceMsg(comp(), "%*s<optgroup name=%s>\n", optDepth * 3, " ", manager->name());
+                traceMsg(comp(), "%*s<optgroup name=%s>\n", _optDepth * 3, " ", manager->name());
         }
 
-        optDepth++;
+        _optDepth++;
 
         // Find the subgroup. It is either referenced directly from this
         // optimization or picked up from the table of groups using the
@@ -1518,12 +1445,12 @@ int32_t OMR::Optimizer::performOptimization(
                 break;
         }
 
-        optDepth--;
+        _optDepth--;
 
         if (comp()->getOption(TR_TraceOptDetails) || comp()->getOption(TR_TraceOptTrees)
             || comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                traceMsg(comp(), "%*s</optgroup>\n", optDepth * 3, " ");
+                traceMsg(comp(), "%*s</optgroup>\n", _optDepth * 3, " ");
         }
 
         return actualCost;
@@ -1581,9 +1508,11 @@ int32_t OMR::Optimizer::performOptimization(
 
         if (comp()->getOption(TR_TraceOpts)) {
             if (comp()->isOutermostMethod())
-                traceMsg(comp(), "%*s%s\n", optDepth * 3, " ", manager->name());
+                traceMsg(comp(), "%*s%s\n", _optDepth * 3, " ", manager->name());
         }
 
+        TR::OptimizationProfiler profiler(comp(), getMethodSymbol(), optNum, optIndex);
+
         if (!_aliasSetsAreValid && !manager->getDoesNotRequireAliasSets()) {
             TR::Compilation::CompilationPhaseScope buildingAliases(comp());
             comp()->reportAnalysisPhase(BUILDING_ALIASES);
@@ -1958,6 +1887,8 @@ int32_t OMR::Optimizer::performOptimization(
         if (comp()->getFlowGraph()->getMightHaveUnreachableBlocks())
             comp()->getFlowGraph()->removeUnreachableBlocks();
 
+        profiler.stop();
+
 #ifdef OPT_TIMING
         if (doTiming) {
             myTimer.stopTiming(comp());
@@ -70,6 +70,7 @@ class Optimizer;
 namespace TR {
 class ResolvedMethodSymbol;
 }
+struct OptimizationManagerDescriptor;
 struct OptimizationStrategy;
 class OMR_InlinerPolicy;
 class OMR_InlinerUtil;
@@ -214,6 +215,11 @@ public:
         _mockStrategy = strategy;
     };
 
+    static const OptimizationStrategy* mockStrategy()
+    {
+        return _mockStrategy;
+    }
+
     static ValueNumberInfoBuildType valueNumberInfoBuildType();
 
     void enableAllLocalOpts();
@@ -478,6 +484,12 @@ public:
     } AnalysisPhases;
 
 protected:
+    /**
+     * Create a manager for each optimization and group of a table. Entries replace the managers already
+     * created for the same optimization.
+     */
+    void createOptimizationManagers(const OptimizationManagerDescriptor* descriptors);
+
     TR::OptimizationManager* _opts[OMR::numGroups];
 
 private:
@@ -541,6 +553,8 @@ private:
     bool _firstTimeStructureIsBuilt;
     bool _disableLoopOptsThatCanCreateLoops;
 
+    int32_t _optDepth; /**< nesting of optimization groups, for indenting the trace */
+
     TR_BitVector* _seenBlocksGRA; // used during the GRA as a global
     TR_BitVector* _resetExitsGRA; // used during the GRA as a global
     TR_BitVector* _successorBitsGRA; // used during the GRA as a global
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "optimizer/OptimizationProfiler.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "compile/Compilation.hpp"
+#include "env/CompilerEnv.hpp"
+#include "env/Region.hpp"
+#include "env/SegmentProvider.hpp"
+#include "il/ResolvedMethodSymbol.hpp"
+#include "infra/Monitor.hpp"
+#include "optimizer/Optimizer.hpp"
+
+TR::Monitor* TR::OptimizationProfiler::_monitor = NULL;
+
+namespace {
+
+// What the passes of an optimization cost over the run
+struct OptimizationTotal {
+    uint64_t _passes;
+    uint64_t _micros;
+    size_t _maxScratchBytes;
+    uint64_t _scratchBytesTrackedPasses;
+    int64_t _nodeDelta;
+};
+
+OptimizationTotal optimizationTotals[OMR::numOpts];
+FILE* profileFile = NULL;
+
+FILE* getProfileFile()
+{
+    if (profileFile == NULL) {
+        char* fileName = TR::Options::getOptProfileFileName();
+        if (fileName != NULL)
+            profileFile = fopen(fileName, "w");
+        if (profileFile == NULL)
+            profileFile = stderr;
+    }
+    return profileFile;
+}
+
+void writeString(FILE* file, const char* string)
+{
+    fputc('"', file);
+    for (const char* c = string; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            fprintf(file, "\\%c", *c);
+        else if ((unsigned char)*c < 0x20)
+            fprintf(file, "\\u%04x", (unsigned char)*c);
+        else
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+// Scratch memory is null where the segment provider could not measure it, rather than a misleading 0
+void writeBytes(FILE* file, size_t bytes, bool tracked)
+{
+    if (tracked)
+        fprintf(file, "%llu", (unsigned long long)bytes);
+    else
+        fprintf(file, "null");
+}
+
+bool slowerOptimization(int32_t a, int32_t b)
+{
+    return optimizationTotals[a]._micros > optimizationTotals[b]._micros;
+}
+
+} // namespace
+
+void TR::OptimizationProfiler::initialize()
+{
+    if (_monitor == NULL)
+        _monitor = TR::Monitor::create("JIT-OptimizationProfilerMonitor");
+}
+
+void TR::OptimizationProfiler::start()
+{
+    _initialNodeCount = _methodSymbol->generateAccurateNodeCount();
+
+    TR::SegmentProvider& segmentProvider = _comp->trMemory()->heapMemoryRegion()._segmentProvider;
+    _initialBytesInUse = segmentProvider.bytesInUse();
+    _enclosingPeakBytesInUse = segmentProvider.peakBytesInUse();
+    segmentProvider.setPeakBytesInUse(0);
+
+    _startTime = TR::Compiler->vm.getUSecClock();
+}
+
+void TR::OptimizationProfiler::record()
+{
+    uint64_t micros = TR::Compiler->vm.getUSecClock() - _startTime;
+
+    TR::SegmentProvider& segmentProvider = _comp->trMemory()->heapMemoryRegion()._segmentProvider;
+    size_t peakBytesInUse = segmentProvider.peakBytesInUse();
+    segmentProvider.setPeakBytesInUse(
+        peakBytesInUse > _enclosingPeakBytesInUse ? peakBytesInUse : _enclosingPeakBytesInUse);
+
+    TR::OptimizationProfile* profile = _comp->getOptimizationProfile();
+    if (profile == NULL) {
+        profile = new (_comp->trHeapMemory()) TR::OptimizationProfile(_comp->trMemory()->heapMemoryRegion());
+        _comp->setOptimizationProfile(profile);
+    }
+
+    TR::OptimizationProfile::Record record;
+    record._optNum = _optNum;
+    record._optIndex = _optIndex;
+    record._micros = micros;
+    record._scratchBytes = peakBytesInUse > _initialBytesInUse ? peakBytesInUse - _initialBytesInUse : 0;
+    record._scratchBytesTracked = segmentProvider.tracksBytesInUse();
+    record._nodeDelta = (int32_t)_methodSymbol->generateAccurateNodeCount() - _initialNodeCount;
+    profile->_records.push_back(record);
+}
+
+void TR::OptimizationProfiler::reportCompilation(TR::Compilation* comp)
+{
+    TR::OptimizationProfile* profile = comp->getOptimizationProfile();
+    if (profile == NULL || _monitor == NULL)
+        return;
+
+    _monitor->enter();
+    FILE* file = getProfileFile();
+    fprintf(file, "{\"method\":");
+    writeString(file, comp->signature());
+    fprintf(file, ",\"hotness\":\"%s\",\"optimizations\":[", comp->getHotnessName(comp->getMethodHotness()));
+    for (size_t i = 0; i < profile->_records.size(); i++) {
+        TR::OptimizationProfile::Record& record = profile->_records[i];
+        fprintf(file, "%s{\"name\":\"%s\",\"index\":%d,\"micros\":%llu,\"scratchBytes\":", i ? "," : "",
+            TR::Optimizer::getOptimizationName(record._optNum), record._optIndex,
+            (unsigned long long)record._micros);
+        writeBytes(file, record._scratchBytes, record._scratchBytesTracked);
+        fprintf(file, ",\"nodes\":%d}", record._nodeDelta);
+
+        OptimizationTotal& total = optimizationTotals[record._optNum];
+        total._passes++;
+        total._micros += record._micros;
+        if (record._scratchBytesTracked) {
+            total._scratchBytesTrackedPasses++;
+            if (record._scratchBytes > total._maxScratchBytes)
+                total._maxScratchBytes = record._scratchBytes;
+        }
+        total._nodeDelta += record._nodeDelta;
+    }
+    fprintf(file, "]}\n");
+    fflush(file);
+    _monitor->exit();
+
+    comp->setOptimizationProfile(NULL);
+}
+
+void TR::OptimizationProfiler::shutdown()
+{
+    if (_monitor == NULL)
+        return;
+
+    _monitor->enter();
+    int32_t order[OMR::numOpts];
+    int32_t numOptimizations = 0;
+    for (int32_t i = 0; i < OMR::numOpts; i++)
+        if (optimizationTotals[i]._passes > 0)
+            order[numOptimizations++] = i;
+
+    if (numOptimizations > 0) {
+        std::sort(order, order + numOptimizations, slowerOptimization);
+
+        FILE* file = getProfileFile();
+        fprintf(file, "{\"totals\":[");
+        for (int32_t i = 0; i < numOptimizations; i++) {
+            OptimizationTotal& total = optimizationTotals[order[i]];
+            fprintf(file, "%s{\"name\":\"%s\",\"passes\":%llu,\"micros\":%llu,\"maxScratchBytes\":", i ? "," : "",
+                TR::Optimizer::getOptimizationName((OMR::Optimizations)order[i]), (unsigned long long)total._passes,
+                (unsigned long long)total._micros);
+            writeBytes(file, total._maxScratchBytes, total._scratchBytesTrackedPasses > 0);
+            fprintf(file, ",\"nodes\":%lld}", (long long)total._nodeDelta);
+        }
+        fprintf(file, "]}\n");
+        fflush(file);
+    }
+
+    memset(optimizationTotals, 0, sizeof(optimizationTotals));
+    if (profileFile != NULL && profileFile != stderr)
+        fclose(profileFile);
+    profileFile = NULL;
+    _monitor->exit();
+}
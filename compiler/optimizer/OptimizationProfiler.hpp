@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef OMR_OPTIMIZATION_PROFILER_HPP
+#define OMR_OPTIMIZATION_PROFILER_HPP
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "compile/Compilation.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/TRMemory.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimizations.hpp"
+
+namespace TR {
+class Monitor;
+class ResolvedMethodSymbol;
+}
+
+namespace TR {
+
+/**
+ * @class
+ * @brief The OptimizationProfile class holds what each optimization pass of a compilation cost, in the
+ * order the passes ran.
+ */
+class OptimizationProfile {
+public:
+    TR_ALLOC(TR_Memory::Optimizer)
+
+    struct Record {
+        OMR::Optimizations _optNum;
+        int32_t _optIndex;
+        uint64_t _micros; /**< wall time of the pass, including the analyses it needed */
+        size_t _scratchBytes; /**< scratch memory in use at the peak of the pass, beyond what was in use before it */
+        bool _scratchBytesTracked; /**< false if the scratch segment provider does not track its usage */
+        int32_t _nodeDelta; /**< change in the number of nodes in the trees of the method */
+    };
+
+    OptimizationProfile(TR::Region& region)
+        : _records(region)
+    {}
+
+    TR::vector<Record, TR::Region&> _records;
+};
+
+/**
+ * @class
+ * @brief The OptimizationProfiler class measures a pass of an optimization on the outermost method of a
+ * compilation, when the profileOptimizations option is set.
+ *
+ * The measurement starts when the profiler is constructed and ends when stop() is called; a pass that
+ * fails the compilation is not recorded. Scratch memory is measured in segments of the scratch segment
+ * provider. The peak of the provider is restarted for the pass and restored afterwards, so whoever
+ * measures around the pass still sees it; providers that do not track their usage are written as null.
+ * The nodes are counted outside the timed part, so counting does not show up in the times.
+ *
+ * At the end of the optimizer, reportCompilation() writes the passes of the compilation as one JSON
+ * object per line, using the names of OMROptimizations.enum, to the file named by optProfileFile= or
+ * to stderr, and adds them to the totals for the run. shutdown() writes the totals, slowest pass first.
+ * Front ends that want the profile call initialize() before compiling and shutdown() after.
+ *
+ * When the option is off, the profiler only tests it.
+ */
+class OptimizationProfiler {
+public:
+    OptimizationProfiler(TR::Compilation* comp, TR::ResolvedMethodSymbol* methodSymbol, OMR::Optimizations optNum,
+        int32_t optIndex)
+        : _comp(comp)
+        , _methodSymbol(methodSymbol)
+        , _optNum(optNum)
+        , _optIndex(optIndex)
+        , _active(comp->getOption(TR_ProfileOptimizations) && comp->isOutermostMethod())
+    {
+        if (_active)
+            start();
+    }
+
+    void stop()
+    {
+        if (_active)
+            record();
+    }
+
+    static void initialize();
+
+    /**
+     * @brief Write the passes recorded for comp, if any, and add them to the totals.
+     */
+    static void reportCompilation(TR::Compilation* comp);
+
+    /**
+     * @brief Write the totals of the run and start new ones.
+     */
+    static void shutdown();
+
+private:
+    void start();
+    void record();
+
+    TR::Compilation* _comp;
+    TR::ResolvedMethodSymbol* _methodSymbol;
+    OMR::Optimizations _optNum;
+    int32_t _optIndex;
+    bool _active;
+    int32_t _initialNodeCount;
+    size_t _initialBytesInUse;
+    size_t _enclosingPeakBytesInUse;
+    uint64_t _startTime;
+
+    static TR::Monitor* _monitor;
+};
+
+} // namespace TR
+
+#endif
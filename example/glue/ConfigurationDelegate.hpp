@@ -40,6 +40,9 @@ class MM_ConfigurationDelegate {
      */
 private:
     const MM_GCPolicy _gcPolicy;
+#if defined(OMR_GC_SEGREGATED_HEAP)
+    OMR_SizeClasses _sizeClasses; /**< storage for the size classes, which MM_SizeClasses fills in */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 protected:
 public:
@@ -130,7 +133,8 @@ public:
 #if defined(OMR_GC_SEGREGATED_HEAP)
     OMR_SizeClasses* getSegregatedSizeClasses(MM_EnvironmentBase* env)
     {
-        return NULL;
+        /* the example uses the default cell sizes of MM_SizeClasses, it only has to provide the storage */
+        return &_sizeClasses;
     }
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
@@ -51,6 +51,21 @@ void MM_MarkingDelegate::scanRoots(MM_EnvironmentBase* env)
     }
 }
 
+GC_ObjectScanner* MM_MarkingDelegate::getSplitObjectScanner(
+    MM_EnvironmentBase* env, omrobjectptr_t objectPtr, void* scannerSpace, uintptr_t slotCount, uintptr_t* sizeToDo)
+{
+    uintptr_t startSlot = 0;
+    uintptr_t slotsToScan = _markingScheme->claimArraySplit(env, objectPtr, slotCount, &startSlot);
+    GC_MixedObjectScanner* objectScanner
+        = GC_MixedObjectScanner::newInstance(env, objectPtr, scannerSpace, 0, startSlot, slotsToScan);
+    *sizeToDo = sizeof(fomrobject_t) * slotsToScan;
+    if (0 == startSlot) {
+        /* the header is accounted to the first part */
+        *sizeToDo += sizeof(fomrobject_t);
+    }
+    return objectScanner;
+}
+
 void MM_MarkingDelegate::masterCleanupAfterGC(MM_EnvironmentBase* env)
 {
     OMRPORT_ACCESS_FROM_OMRVM(env->getOmrVM());
@@ -150,6 +150,21 @@ public:
      */
     void scanRoots(MM_EnvironmentBase* env);
 
+    /**
+     * Get a scanner for the part of a large object popped from a work packet that the calling thread should scan.
+     * All slots of an example object are reference slots, so large objects are split like pointer arrays.
+     *
+     * @param env The environment for the calling thread
+     * @param objectPtr Points to the heap object to be scanned
+     * @param slotCount The number of slots of the object
+     * @param sizeToDo Set to the number of bytes which will be scanned
+     * @return An object scanner for the part of the object to be scanned
+     *
+     * @see MM_MarkingScheme::claimArraySplit()
+     */
+    GC_ObjectScanner* getSplitObjectScanner(MM_EnvironmentBase* env, omrobjectptr_t objectPtr, void* scannerSpace,
+        uintptr_t slotCount, uintptr_t* sizeToDo);
+
     /**
      * This method is called for every live object discovered during marking. It must return an object scanner instance
      * that is appropriate for the type of object to be scanned.
@@ -167,6 +182,13 @@ public:
     MMINLINE GC_ObjectScanner* getObjectScanner(MM_EnvironmentBase* env, omrobjectptr_t objectPtr, void* scannerSpace,
         MM_MarkingSchemeScanReason reason, uintptr_t* sizeToDo)
     {
+        if (SCAN_REASON_PACKET == reason) {
+            uintptr_t slotCount
+                = (_objectModel->getConsumedSizeInBytesWithHeader(objectPtr) / sizeof(fomrobject_t)) - 1;
+            if (slotCount > env->getExtensions()->markingArraySplitMinimumAmount) {
+                return getSplitObjectScanner(env, objectPtr, scannerSpace, slotCount, sizeToDo);
+            }
+        }
         GC_MixedObjectScanner* objectScanner = GC_MixedObjectScanner::newInstance(env, objectPtr, scannerSpace, 0);
         *sizeToDo = sizeof(fomrobject_t) + objectScanner->getBytesRemaining();
         return objectScanner;
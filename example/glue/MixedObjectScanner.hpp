@@ -52,6 +52,22 @@ protected:
         _typeId = __FUNCTION__;
     }
 
+    /**
+     * @param[in] env The scanning thread environment
+     * @param[in] objectPtr the object to be processed
+     * @param[in] startSlot index of the first slot to scan
+     * @param[in] slotCount number of slots to scan
+     * @param[in] flags Scanning context flags
+     */
+    MMINLINE GC_MixedObjectScanner(
+        MM_EnvironmentBase* env, omrobjectptr_t objectPtr, uintptr_t startSlot, uintptr_t slotCount, uintptr_t flags)
+        : GC_ObjectScanner(env, (fomrobject_t*)objectPtr + 1 + startSlot, 0, flags)
+        , _endPtr(_scanPtr + slotCount)
+        , _mapPtr(_scanPtr)
+    {
+        _typeId = __FUNCTION__;
+    }
+
     /**
      * Subclasses must call this method to set up the instance description bits and description pointer.
      * @param[in] env The scanning thread environment
@@ -95,6 +111,29 @@ public:
         return objectScanner;
     }
 
+    /**
+     * In-place instantiation and initialization for a mixed object scanner which scans a range of the slots of
+     * an object.
+     * @param[in] env The scanning thread environment
+     * @param[in] objectPtr The object to scan
+     * @param[in] allocSpace Pointer to space for in-place instantiation (at least sizeof(GC_MixedObjectScanner) bytes)
+     * @param[in] flags Scanning context flags
+     * @param[in] startSlot Index of the first slot to scan
+     * @param[in] slotCount Number of slots to scan
+     * @return Pointer to GC_MixedObjectScanner instance in allocSpace
+     */
+    MMINLINE static GC_MixedObjectScanner* newInstance(MM_EnvironmentBase* env, omrobjectptr_t objectPtr,
+        void* allocSpace, uintptr_t flags, uintptr_t startSlot, uintptr_t slotCount)
+    {
+        GC_MixedObjectScanner* objectScanner = NULL;
+        if (NULL != allocSpace) {
+            new (allocSpace) GC_MixedObjectScanner(env, objectPtr, startSlot, slotCount, flags);
+            objectScanner = (GC_MixedObjectScanner*)allocSpace;
+            objectScanner->initialize(env);
+        }
+        return objectScanner;
+    }
+
     MMINLINE uintptr_t getBytesRemaining()
     {
         return sizeof(fomrobject_t) * (_endPtr - _scanPtr);
@@ -58,7 +58,7 @@
 
 void MM_ScavengerDelegate::masterSetupForGC(MM_EnvironmentBase* env)
 {
-    /* Do nothing for now */
+    _clearedObjectEntries = 0;
 }
 
 void MM_ScavengerDelegate::workerSetupForGC_clearEnvironmentLangStats(MM_EnvironmentBase* env)
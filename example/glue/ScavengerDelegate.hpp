@@ -30,6 +30,7 @@
 #include "modronbase.h"
 #include "objectdescription.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -45,6 +46,7 @@ class MM_MemorySubSpaceSemiSpace;
 class MM_ScavengerDelegate : public MM_BaseVirtual {
 private:
     MM_GCExtensionsBase* _extensions;
+    volatile uintptr_t _clearedObjectEntries; /**< Object table entries of objects which died in the current scavenge */
 
 protected:
 public:
@@ -76,6 +78,24 @@ public:
      */
     void masterSetupForGC(MM_EnvironmentBase* env);
 
+    /**
+     * Count object table entries cleared by a GC thread during the clearable scan.
+     *
+     * @param[in] count The number of entries the calling thread cleared.
+     */
+    void addClearedObjectEntries(uintptr_t count)
+    {
+        MM_AtomicOperations::add(&_clearedObjectEntries, count);
+    }
+
+    /**
+     * @return The number of object table entries cleared in the current scavenge.
+     */
+    uintptr_t getClearedObjectEntries()
+    {
+        return _clearedObjectEntries;
+    }
+
     /**
      * This method is called on each GC worker thread when a scavenge cycle is started. Implementations of
      * this method may clear any thread-specific client-side stats or metadata relating to scavenge cycles
@@ -263,6 +283,7 @@ public:
     MM_ScavengerDelegate(MM_EnvironmentBase* env)
         : MM_BaseVirtual()
         , _extensions(env->getExtensions())
+        , _clearedObjectEntries(0)
     {
         _typeId = __FUNCTION__;
     }
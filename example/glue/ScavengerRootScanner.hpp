@@ -35,6 +35,9 @@
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
+/* Number of hash table buckets in a work unit of parallel root and clearable scanning */
+#define HASH_TABLE_BUCKETS_PER_WORK_UNIT 64
+
 class MM_ScavengerRootScanner : public MM_Base {
     /*
      * Member data and types
@@ -67,22 +70,39 @@ public:
 
     void scanRoots(MM_EnvironmentBase* env)
     {
+        OMRPORT_ACCESS_FROM_OMRVM(env->getOmrVM());
         OMR_VM_Example* omrVM = (OMR_VM_Example*)env->getOmrVM()->_language_vm;
-        if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
-            J9HashTableState state;
-            MM_EnvironmentStandard* envStd = MM_EnvironmentStandard::getEnvironment(env);
-            if (NULL != omrVM->rootTable) {
-                RootEntry* rootEntry = (RootEntry*)hashTableStartDo(omrVM->rootTable, &state);
-                while (NULL != rootEntry) {
-                    if (NULL != rootEntry->rootPtr) {
-                        _scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t*)&rootEntry->rootPtr);
+        MM_EnvironmentStandard* envStd = MM_EnvironmentStandard::getEnvironment(env);
+
+        /* The root table stands in for the global references of a VM. Its buckets are split into work units, so each
+         * thread only walks the entries of the units it claims.
+         */
+        if (NULL != omrVM->rootTable) {
+            uint64_t startTime = omrtime_hires_clock();
+            J9HashTable* rootTable = omrVM->rootTable;
+            for (uint32_t bucket = 0; bucket < rootTable->tableSize; bucket += HASH_TABLE_BUCKETS_PER_WORK_UNIT) {
+                if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+                    uint32_t endBucket = OMR_MIN(bucket + HASH_TABLE_BUCKETS_PER_WORK_UNIT, rootTable->tableSize);
+                    J9HashTableState state;
+                    RootEntry* rootEntry = (RootEntry*)hashTableStartDoBuckets(rootTable, &state, bucket, endBucket);
+                    while (NULL != rootEntry) {
+                        if (NULL != rootEntry->rootPtr) {
+                            _scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t*)&rootEntry->rootPtr);
+                        }
+                        rootEntry = (RootEntry*)hashTableNextDo(&state);
                     }
-                    rootEntry = (RootEntry*)hashTableNextDo(&state);
                 }
             }
-            OMR_VMThread* walkThread;
-            GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
-            while ((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+            env->_rootScannerStats.addEntityScanTime(RootScannerEntity_JNIGlobalReferences,
+                                                      omrtime_hires_clock() - startTime);
+        }
+
+        /* Each thread is a work unit of its own */
+        uint64_t startTime = omrtime_hires_clock();
+        OMR_VMThread* walkThread;
+        GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+        while ((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+            if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
                 if (NULL != walkThread->_savedObject1) {
                     _scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t*)&walkThread->_savedObject1);
                 }
@@ -90,8 +110,8 @@ public:
                     _scavenger->copyObjectSlot(envStd, (volatile omrobjectptr_t*)&walkThread->_savedObject2);
                 }
             }
-            env->_currentTask->releaseSynchronizedGCThreads(env);
         }
+        env->_rootScannerStats.addEntityScanTime(RootScannerEntity_Threads, omrtime_hires_clock() - startTime);
     }
 
     void rescanThreadSlots(MM_EnvironmentStandard* env) {}
@@ -101,24 +121,51 @@ public:
         OMRPORT_ACCESS_FROM_OMRVM(env->getOmrVM());
         OMR_VM_Example* omrVM = (OMR_VM_Example*)env->getOmrVM()->_language_vm;
         if (NULL != omrVM->objectTable) {
+            /* Entries are updated or cleared in parallel, a range of buckets per work unit. Removing an entry is not
+             * thread safe, so the entries of dead objects are only cleared here and removed by a single thread.
+             */
+            J9HashTable* objectTable = omrVM->objectTable;
+            MM_ScavengerDelegate* delegate = _scavenger->getDelegate();
+            uintptr_t clearedEntries = 0;
+            for (uint32_t bucket = 0; bucket < objectTable->tableSize; bucket += HASH_TABLE_BUCKETS_PER_WORK_UNIT) {
+                if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+                    uint32_t endBucket = OMR_MIN(bucket + HASH_TABLE_BUCKETS_PER_WORK_UNIT, objectTable->tableSize);
+                    J9HashTableState state;
+                    ObjectEntry* objectEntry =
+                        (ObjectEntry*)hashTableStartDoBuckets(objectTable, &state, bucket, endBucket);
+                    while (NULL != objectEntry) {
+                        if (_scavenger->isObjectInEvacuateMemory(objectEntry->objPtr)) {
+                            MM_ForwardedHeader fwdHeader(objectEntry->objPtr);
+                            if (fwdHeader.isForwardedPointer()) {
+                                objectEntry->objPtr = fwdHeader.getForwardedObject();
+                            } else {
+                                omrmem_free_memory((void*)objectEntry->name);
+                                objectEntry->name = NULL;
+                                objectEntry->objPtr = NULL;
+                                clearedEntries += 1;
+                            }
+                        }
+                        objectEntry = (ObjectEntry*)hashTableNextDo(&state);
+                    }
+                }
+            }
+            if (0 != clearedEntries) {
+                delegate->addClearedObjectEntries(clearedEntries);
+            }
+
             if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
-                J9HashTableState state;
-                ObjectEntry* objectEntry = (ObjectEntry*)hashTableStartDo(omrVM->objectTable, &state);
-                while (NULL != objectEntry) {
-                    if (_scavenger->isObjectInEvacuateMemory(objectEntry->objPtr)) {
-                        MM_ForwardedHeader fwdHeader(objectEntry->objPtr);
-                        if (fwdHeader.isForwardedPointer()) {
-                            objectEntry->objPtr = fwdHeader.getForwardedObject();
-                        } else {
-                            omrmem_free_memory((void*)objectEntry->name);
-                            objectEntry->name = NULL;
+                if (0 != delegate->getClearedObjectEntries()) {
+                    J9HashTableState state;
+                    ObjectEntry* objectEntry = (ObjectEntry*)hashTableStartDo(objectTable, &state);
+                    while (NULL != objectEntry) {
+                        if (NULL == objectEntry->objPtr) {
                             hashTableDoRemove(&state);
                         }
+                        objectEntry = (ObjectEntry*)hashTableNextDo(&state);
                     }
-                    objectEntry = (ObjectEntry*)hashTableNextDo(&state);
                 }
+                env->_currentTask->releaseSynchronizedGCThreads(env);
             }
-            env->_currentTask->releaseSynchronizedGCThreads(env);
         }
     }
 
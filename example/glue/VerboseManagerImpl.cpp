@@ -84,7 +84,8 @@ bool MM_VerboseManagerImpl::reconfigureVerboseGC(OMR_VM* omrVM)
      * otherwise we append the pid of the child before the extension.
      */
     WriterType type = parseWriterType(NULL, filename, 0, 0); /* All parameters other than filename aren't used */
-    if (((type == VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS) || (type == VERBOSE_WRITER_FILE_LOGGING_BUFFERED))
+    if (((type == VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS) || (type == VERBOSE_WRITER_FILE_LOGGING_BUFFERED)
+            || (type == VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS))
         && (NULL == strstr(filename, "%p")) && (NULL == strstr(filename, "%pid"))) {
 #define MAX_PID_LENGTH 16
         char pidStr[MAX_PID_LENGTH];
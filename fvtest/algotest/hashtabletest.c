@@ -31,6 +31,7 @@
  * 		hashTableGetCount()
  * 		hashTableFind()
  * 		hashTableStartDo()
+ * 		hashTableStartDoBuckets()
  * 		hashTableNextDo()
  * 		hashTableRemove()
  */
@@ -132,6 +133,34 @@ static BOOLEAN checkHashtableIntegrity(OMRPortLibrary* portLib, J9HashTable* tab
         return FALSE;
     }
 
+    /* walking the buckets in uneven ranges must return every element exactly once */
+    memset(dup, 0, sizeof(dup));
+    count = 0;
+    {
+        uint32_t rangeStart = 0;
+        uint32_t rangeSize = 1;
+        while (rangeStart < table->tableSize) {
+            uint32_t rangeEnd = rangeStart + rangeSize;
+            if (rangeEnd > table->tableSize) {
+                rangeEnd = table->tableSize;
+            }
+            next = hashTableStartDoBuckets(table, &walkState, rangeStart, rangeEnd);
+            while (next != NULL) {
+                count++;
+                if ((*next >= sizeof(dup) / sizeof(uintptr_t)) || dup[*next]) {
+                    return FALSE;
+                }
+                dup[*next] = 1;
+                next = hashTableNextDo(&walkState);
+            }
+            rangeStart = rangeEnd;
+            rangeSize += 2;
+        }
+    }
+    if (count != dataLength - (i + 1)) {
+        return FALSE;
+    }
+
     for (j = i + 1; j < dataLength; j++) {
         uintptr_t* node;
         uintptr_t entry = data[dataOffset(removeOffset, dataLength, j)];
@@ -76,6 +76,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/env/OMRVMMethodEnv.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/SegmentProvider.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/SegmentAllocator.cpp \
+    $(JIT_OMR_DIRTY_DIR)/env/SegmentPool.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/SystemSegmentProvider.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/DebugSegmentProvider.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Region.cpp \
@@ -146,6 +147,7 @@ JIT_PRODUCT_BACKEND_SOURCES+=\
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizationManager.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMRTransformUtil.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OMROptimizer.cpp \
+    $(JIT_OMR_DIRTY_DIR)/optimizer/OptimizationProfiler.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OrderBlocks.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/OSRDefAnalysis.cpp \
     $(JIT_OMR_DIRTY_DIR)/optimizer/PartialRedundancy.cpp \
@@ -224,7 +226,9 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_PRODUCT_DIR)/tests/injectors/IndirectStoreIlInjector.cpp \
     $(JIT_PRODUCT_DIR)/tests/injectors/FooIlInjector.cpp \
     $(JIT_PRODUCT_DIR)/tests/injectors/Qux2IlInjector.cpp \
+    $(JIT_PRODUCT_DIR)/tests/BitVectorTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/BuilderTest.cpp \
+    $(JIT_PRODUCT_DIR)/tests/CompilationQueueTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/FooBarTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/LimitFileTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/LogFileTest.cpp \
@@ -233,6 +237,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_PRODUCT_DIR)/tests/OpCodesTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/PPCOpCodesTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/Qux2Test.cpp \
+    $(JIT_PRODUCT_DIR)/tests/SegmentPoolTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/SimplifierFoldAndTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/SingleBitContainerTest.cpp \
     $(JIT_PRODUCT_DIR)/tests/S390OpCodesTest.cpp \
@@ -247,6 +252,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     $(JIT_OMR_DIRTY_DIR)/runtime/Runtime.cpp \
     $(JIT_OMR_DIRTY_DIR)/runtime/Trampoline.cpp \
     $(JIT_OMR_DIRTY_DIR)/control/CompileMethod.cpp \
+    $(JIT_OMR_DIRTY_DIR)/control/CompilationQueue.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRIO.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/OMRKnownObjectTable.cpp \
     $(JIT_OMR_DIRTY_DIR)/env/Globals.cpp \
@@ -31,6 +31,7 @@
 #include "env/RawAllocator.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
+#include "optimizer/OptimizationProfiler.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/TestJitConfig.hpp"
@@ -176,6 +177,8 @@ extern "C" bool initializeJit()
 
 extern "C" void shutdownJit()
 {
+    TR::OptimizationProfiler::shutdown();
+
     auto fe = TestCompiler::FrontEnd::instance();
 
     TR::CodeCacheManager& codeCacheManager = fe->codeCacheManager();
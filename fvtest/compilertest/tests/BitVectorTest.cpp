@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "env/RawAllocator.hpp"
+#include "env/Region.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "infra/BitVector.hpp"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace {
+
+// The sizes the representation depends on: vectors of fewer than 8 chunks are always dense, and a sparse
+// vector holds at most min(chunks / 2, 256) bits
+const int32_t smallChunks = 7;
+const int32_t mediumChunks = 64;
+const int32_t mediumElementLimit = mediumChunks / 2;
+const int32_t largeChunks = 1024;
+const int32_t largeElementLimit = 256;
+
+class BitVectorTest : public ::testing::Test {
+protected:
+    BitVectorTest()
+        : _segmentProvider(1 << 16, _rawAllocator)
+        , _region(_segmentProvider, _rawAllocator)
+        , _seed(1)
+    {}
+
+    // Vectors are dense by default, so these tests turn the sparse representation on
+    virtual void SetUp() { TR_BitVector::enableSparseRepresentation(true); }
+
+    virtual void TearDown() { TR_BitVector::enableSparseRepresentation(false); }
+
+    // A linear congruential generator keeps the vectors the same on every run
+    int32_t random(int32_t limit)
+    {
+        _seed = _seed * 1103515245 + 12345;
+        return (_seed >> 8) % limit;
+    }
+
+    // Set random bits in both the vector and the reference
+    void setRandomBits(TR_BitVector& bv, std::vector<bool>& reference, int32_t count)
+    {
+        for (int32_t i = 0; i < count; i++) {
+            int32_t bit = random((int32_t)reference.size());
+            bv.set(bit);
+            reference[bit] = true;
+        }
+    }
+
+    void expectSameBits(TR_BitVector& bv, const std::vector<bool>& reference, const char* operation)
+    {
+        int32_t count = 0;
+        for (size_t bit = 0; bit < reference.size(); bit++) {
+            ASSERT_EQ((bool)reference[bit], bv.get(bit) != 0) << "bit " << bit << " after " << operation;
+            if (reference[bit])
+                count++;
+        }
+        ASSERT_EQ(count, bv.elementCount()) << "element count after " << operation;
+
+        TR_BitVectorIterator bvi(bv);
+        int32_t previous = -1;
+        while (bvi.hasMoreElements()) {
+            int32_t bit = bvi.getNextElement();
+            ASSERT_GT(bit, previous) << "iteration out of order after " << operation;
+            ASSERT_TRUE(reference[bit]) << "iterated over bit " << bit << " after " << operation;
+            previous = bit;
+            count--;
+        }
+        ASSERT_EQ(0, count) << "iteration missed bits after " << operation;
+    }
+
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _segmentProvider;
+    TR::Region _region;
+    uint32_t _seed;
+};
+
+TEST_F(BitVectorTest, SmallVectorsAreDense)
+{
+    TR_BitVector bv(smallChunks * BITS_IN_CHUNK, _region);
+    ASSERT_FALSE(bv.isSparse());
+    bv.set(3);
+    ASSERT_FALSE(bv.isSparse());
+}
+
+TEST_F(BitVectorTest, DenseWhenSparseIsDisabled)
+{
+    TR_BitVector::enableSparseRepresentation(false);
+    TR_BitVector bv(largeChunks * BITS_IN_CHUNK, _region);
+    ASSERT_FALSE(bv.isSparse());
+    bv.set(5);
+    bv.set(largeChunks * BITS_IN_CHUNK - 1);
+    ASSERT_FALSE(bv.isSparse());
+    ASSERT_TRUE(bv.get(5));
+    ASSERT_EQ(2, bv.elementCount());
+}
+
+TEST_F(BitVectorTest, LargeVectorsStartSparse)
+{
+    TR_BitVector bv((smallChunks + 1) * BITS_IN_CHUNK, _region);
+    ASSERT_TRUE(bv.isSparse());
+    TR_BitVector large(largeChunks * BITS_IN_CHUNK, _region);
+    ASSERT_TRUE(large.isSparse());
+}
+
+TEST_F(BitVectorTest, SparseSetGetReset)
+{
+    std::vector<bool> reference(largeChunks * BITS_IN_CHUNK);
+    TR_BitVector bv(reference.size(), _region);
+    ASSERT_TRUE(bv.isEmpty());
+
+    int32_t bits[] = { 700, 5, largeChunks * BITS_IN_CHUNK - 1, 64, 3, 700 };
+    for (size_t i = 0; i < sizeof(bits) / sizeof(bits[0]); i++) {
+        bv.set(bits[i]);
+        reference[bits[i]] = true;
+    }
+    ASSERT_TRUE(bv.isSparse());
+    expectSameBits(bv, reference, "set");
+    ASSERT_EQ(largeChunks * BITS_IN_CHUNK - 1, bv.getHighestBitPosition());
+    ASSERT_TRUE(bv.hasMoreThanOneElement());
+
+    bv.reset(largeChunks * BITS_IN_CHUNK - 1);
+    reference[largeChunks * BITS_IN_CHUNK - 1] = false;
+    bv.reset(6);
+    ASSERT_TRUE(bv.isSparse());
+    expectSameBits(bv, reference, "reset");
+    ASSERT_EQ(700, bv.getHighestBitPosition());
+
+    bv.empty();
+    ASSERT_TRUE(bv.isEmpty());
+    ASSERT_FALSE(bv.hasMoreThanOneElement());
+}
+
+TEST_F(BitVectorTest, DensifiesAboveElementLimit)
+{
+    TR_BitVector medium(mediumChunks * BITS_IN_CHUNK, _region);
+    for (int32_t i = 0; i < mediumElementLimit; i++)
+        medium.set(i * 3);
+    ASSERT_TRUE(medium.isSparse()) << "a vector of " << mediumChunks << " chunks holds " << mediumElementLimit
+                                   << " bits sparsely";
+    medium.set(1);
+    ASSERT_FALSE(medium.isSparse());
+    ASSERT_EQ(mediumElementLimit + 1, medium.elementCount());
+
+    TR_BitVector large(largeChunks * BITS_IN_CHUNK, _region);
+    for (int32_t i = 0; i < largeElementLimit; i++)
+        large.set(i * 100);
+    ASSERT_TRUE(large.isSparse()) << "a sparse vector of any size holds " << largeElementLimit << " bits";
+    large.set(1);
+    ASSERT_FALSE(large.isSparse());
+    ASSERT_EQ(largeElementLimit + 1, large.elementCount());
+}
+
+TEST_F(BitVectorTest, SparsifiesAtHalfElementLimit)
+{
+    const int32_t numBits = mediumChunks * BITS_IN_CHUNK;
+
+    // The intersection of the two dense vectors is [firstMaskBit, numBits / 2)
+    for (int32_t remaining = mediumElementLimit / 2; remaining <= mediumElementLimit / 2 + 1; remaining++) {
+        int32_t firstMaskBit = numBits / 2 - remaining;
+        TR_BitVector bv(numBits, _region);
+        TR_BitVector mask(numBits, _region);
+        for (int32_t i = 0; i < numBits / 2; i++)
+            bv.set(i);
+        for (int32_t i = firstMaskBit; i < numBits; i++)
+            mask.set(i);
+        ASSERT_FALSE(bv.isSparse());
+        ASSERT_FALSE(mask.isSparse());
+
+        bv &= mask;
+        ASSERT_EQ(remaining, bv.elementCount());
+        ASSERT_EQ(remaining <= mediumElementLimit / 2, bv.isSparse()) << remaining << " bits left after &=";
+    }
+
+    // The difference is [0, remaining)
+    for (int32_t remaining = mediumElementLimit / 2; remaining <= mediumElementLimit / 2 + 1; remaining++) {
+        TR_BitVector bv(numBits, _region);
+        TR_BitVector subtrahend(numBits, _region);
+        for (int32_t i = 0; i < numBits; i++)
+            bv.set(i);
+        for (int32_t i = remaining; i < numBits; i++)
+            subtrahend.set(i);
+
+        bv -= subtrahend;
+        ASSERT_EQ(remaining, bv.elementCount());
+        ASSERT_EQ(remaining <= mediumElementLimit / 2, bv.isSparse()) << remaining << " bits left after -=";
+    }
+}
+
+TEST_F(BitVectorTest, SparseAndDenseOperations)
+{
+    const int32_t numBits = mediumChunks * BITS_IN_CHUNK;
+
+    // Each operand is either sparse, with a few bits, or dense, with many
+    for (int32_t iteration = 0; iteration < 64; iteration++) {
+        std::vector<bool> reference1(numBits), reference2(numBits);
+        TR_BitVector bv1(numBits, _region);
+        TR_BitVector bv2(numBits, _region);
+        setRandomBits(bv1, reference1, (iteration & 1) ? numBits / 2 : mediumElementLimit / 4);
+        setRandomBits(bv2, reference2, (iteration & 2) ? numBits / 2 : mediumElementLimit / 4);
+        ASSERT_EQ((iteration & 1) == 0, bv1.isSparse());
+        ASSERT_EQ((iteration & 2) == 0, bv2.isSparse());
+
+        bool intersects = false;
+        int32_t common = 0;
+        for (int32_t bit = 0; bit < numBits; bit++) {
+            if (reference1[bit] && reference2[bit]) {
+                intersects = true;
+                common++;
+            }
+        }
+        ASSERT_EQ(intersects, bv1.intersects(bv2));
+        ASSERT_EQ(common, bv1.commonElementCount(bv2));
+        ASSERT_EQ(reference1 == reference2, bv1 == bv2);
+
+        TR_BitVector copy(numBits, _region);
+        copy = bv1;
+        ASSERT_TRUE(copy == bv1);
+        expectSameBits(copy, reference1, "=");
+
+        std::vector<bool> expected(numBits);
+        switch (iteration % 3) {
+        case 0:
+            bv1 |= bv2;
+            for (int32_t bit = 0; bit < numBits; bit++)
+                expected[bit] = reference1[bit] || reference2[bit];
+            expectSameBits(bv1, expected, "|=");
+            break;
+        case 1:
+            bv1 &= bv2;
+            for (int32_t bit = 0; bit < numBits; bit++)
+                expected[bit] = reference1[bit] && reference2[bit];
+            expectSameBits(bv1, expected, "&=");
+            break;
+        case 2:
+            bv1 -= bv2;
+            for (int32_t bit = 0; bit < numBits; bit++)
+                expected[bit] = reference1[bit] && !reference2[bit];
+            expectSameBits(bv1, expected, "-=");
+            break;
+        }
+    }
+}
+
+// Runs the dense |=, &= and -= over every selectable chunk operation implementation, with the operands
+// starting at every chunk alignment the vector instructions care about and with tails of every length
+//
+class BitVectorChunkOperationsTest : public BitVectorTest {
+protected:
+    virtual void SetUp()
+    {
+        BitVectorTest::SetUp();
+        _original = TR_BitVector::selectedChunkOperations();
+    }
+
+    virtual void TearDown()
+    {
+        TR_BitVector::selectChunkOperations(_original);
+        BitVectorTest::TearDown();
+    }
+
+    void testChunkOperations()
+    {
+        const int32_t numChunks = 48;
+        const int32_t numBits = numChunks * BITS_IN_CHUNK;
+        for (int32_t firstChunk = 0; firstChunk < 4; firstChunk++) {
+            for (int32_t count = 8; count <= 40; count++) {
+                for (int32_t operation = 0; operation < 3; operation++) {
+                    std::vector<bool> reference1(numBits), reference2(numBits);
+                    TR_BitVector bv1(numBits, _region);
+                    TR_BitVector bv2(numBits, _region);
+                    setRandomBits(bv1, reference1, numBits);
+                    for (int32_t bit = firstChunk * BITS_IN_CHUNK; bit < (firstChunk + count) * BITS_IN_CHUNK; bit++) {
+                        if (random(2)) {
+                            bv2.set(bit);
+                            reference2[bit] = true;
+                        }
+                    }
+                    ASSERT_FALSE(bv1.isSparse());
+                    ASSERT_FALSE(bv2.isSparse());
+
+                    std::vector<bool> expected(numBits);
+                    for (int32_t bit = 0; bit < numBits; bit++) {
+                        if (operation == 0)
+                            expected[bit] = reference1[bit] || reference2[bit];
+                        else if (operation == 1)
+                            expected[bit] = reference1[bit] && reference2[bit];
+                        else
+                            expected[bit] = reference1[bit] && !reference2[bit];
+                    }
+
+                    if (operation == 0)
+                        bv1 |= bv2;
+                    else if (operation == 1)
+                        bv1 &= bv2;
+                    else
+                        bv1 -= bv2;
+                    SCOPED_TRACE(testing::Message() << "first chunk " << firstChunk << ", " << count << " chunks");
+                    expectSameBits(bv1, expected, operation == 0 ? "|=" : operation == 1 ? "&=" : "-=");
+                    if (HasFatalFailure())
+                        return;
+                }
+            }
+        }
+    }
+
+    TR_BitVector::ChunkOperations _original;
+};
+
+TEST_F(BitVectorChunkOperationsTest, Scalar)
+{
+    ASSERT_TRUE(TR_BitVector::selectChunkOperations(TR_BitVector::scalarChunkOperations));
+    ASSERT_EQ(TR_BitVector::scalarChunkOperations, TR_BitVector::selectedChunkOperations());
+    testChunkOperations();
+}
+
+TEST_F(BitVectorChunkOperationsTest, SSE2)
+{
+    if (!TR_BitVector::selectChunkOperations(TR_BitVector::sse2ChunkOperations))
+        return; // not an x86-64 host
+    ASSERT_EQ(TR_BitVector::sse2ChunkOperations, TR_BitVector::selectedChunkOperations());
+    testChunkOperations();
+}
+
+TEST_F(BitVectorChunkOperationsTest, AVX2)
+{
+    if (!TR_BitVector::selectChunkOperations(TR_BitVector::avx2ChunkOperations))
+        return; // the processor does not have AVX2
+    ASSERT_EQ(TR_BitVector::avx2ChunkOperations, TR_BitVector::selectedChunkOperations());
+    testChunkOperations();
+}
+
+} // namespace
@@ -0,0 +1,299 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "compile/Compilation.hpp"
+#include "control/CompilationQueue.hpp"
+#include "env/CompilerEnv.hpp"
+#include "omrthread.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace {
+
+/**
+ * Holds back the compilation thread inside a request until the test opens it, so the requests submitted
+ * in the meantime are queued behind it.
+ */
+class Gate {
+public:
+    Gate()
+        : _entered(false)
+        , _open(false)
+    {
+        omrthread_monitor_init_with_name(&_monitor, 0, "CompilationQueueTest gate");
+    }
+
+    ~Gate() { omrthread_monitor_destroy(_monitor); }
+
+    void pass()
+    {
+        omrthread_monitor_enter(_monitor);
+        _entered = true;
+        omrthread_monitor_notify_all(_monitor);
+        while (!_open) {
+            omrthread_monitor_wait(_monitor);
+        }
+        omrthread_monitor_exit(_monitor);
+    }
+
+    void waitUntilEntered()
+    {
+        omrthread_monitor_enter(_monitor);
+        while (!_entered) {
+            omrthread_monitor_wait(_monitor);
+        }
+        omrthread_monitor_exit(_monitor);
+    }
+
+    void open()
+    {
+        omrthread_monitor_enter(_monitor);
+        _open = true;
+        omrthread_monitor_notify_all(_monitor);
+        omrthread_monitor_exit(_monitor);
+    }
+
+private:
+    omrthread_monitor_t _monitor;
+    bool _entered;
+    bool _open;
+};
+
+/**
+ * A request that compiles nothing: it records the order in which the queue served it and completes
+ * with its key as the start PC.
+ */
+class TestRequest : public TR::CompilationRequest {
+public:
+    static TestRequest* create(const void* key, TR_Hotness hotness, std::vector<const void*>* compiled,
+        Gate* gate = NULL, Callback callback = NULL, void* userData = NULL)
+    {
+        return new (TR::Compiler->rawAllocator) TestRequest(key, hotness, compiled, gate, callback, userData);
+    }
+
+protected:
+    TestRequest(const void* key, TR_Hotness hotness, std::vector<const void*>* compiled, Gate* gate,
+        Callback callback, void* userData)
+        : TR::CompilationRequest(key, hotness, callback, userData)
+        , _compiled(compiled)
+        , _gate(gate)
+    {}
+
+    virtual uint8_t* compile(TR_Hotness hotness, int32_t& rc)
+    {
+        if (NULL != _gate) {
+            _gate->pass();
+        }
+        _compiled->push_back(key());
+        rc = COMPILATION_SUCCEEDED;
+        return (uint8_t*)key();
+    }
+
+private:
+    std::vector<const void*>* _compiled;
+    Gate* _gate;
+};
+
+class CompilationQueueTest : public ::testing::Test {
+protected:
+    virtual void SetUp() { omrthread_attach_ex(&_thread, J9THREAD_ATTR_DEFAULT); }
+
+    virtual void TearDown() { omrthread_detach(_thread); }
+
+    /** The keys of the test requests; only their addresses are used. */
+    char keys[8];
+    std::vector<const void*> compiled;
+
+private:
+    omrthread_t _thread;
+};
+
+struct CallbackState {
+    bool called;
+    bool doneInCallback;
+    const void* startPC;
+};
+
+void recordCallback(TR::CompilationRequest* request, void* userData)
+{
+    CallbackState* state = static_cast<CallbackState*>(userData);
+    state->called = true;
+    state->doneInCallback = request->isDone();
+    state->startPC = request->startPC();
+}
+
+} // namespace
+
+TEST_F(CompilationQueueTest, SubmitAndWait)
+{
+    TR::CompilationQueue queue;
+    ASSERT_TRUE(queue.start());
+
+    TestRequest* request = TestRequest::create(&keys[0], warm, &compiled);
+    ASSERT_TRUE(queue.submit(request));
+    request->wait();
+    EXPECT_TRUE(request->isDone());
+    EXPECT_EQ((uint8_t*)&keys[0], request->startPC());
+    EXPECT_EQ(COMPILATION_SUCCEEDED, request->returnCode());
+    request->release();
+
+    queue.shutdown();
+    ASSERT_EQ(1u, compiled.size());
+}
+
+TEST_F(CompilationQueueTest, SubmitRequiresRunningQueue)
+{
+    TR::CompilationQueue queue;
+    TestRequest* request = TestRequest::create(&keys[0], warm, &compiled);
+    EXPECT_FALSE(queue.submit(request)) << "the queue accepted a request before it was started";
+    EXPECT_FALSE(request->isDone());
+    request->release();
+}
+
+TEST_F(CompilationQueueTest, DuplicatesAreCompiledOnce)
+{
+    Gate gate;
+    TR::CompilationQueue queue;
+    ASSERT_TRUE(queue.start());
+
+    TestRequest* inProgress = TestRequest::create(&keys[0], warm, &compiled, &gate);
+    ASSERT_TRUE(queue.submit(inProgress));
+    gate.waitUntilEntered();
+
+    TestRequest* queued = TestRequest::create(&keys[1], warm, &compiled);
+    TestRequest* queuedDuplicate = TestRequest::create(&keys[1], cold, &compiled);
+    TestRequest* inProgressDuplicate = TestRequest::create(&keys[0], warm, &compiled);
+    ASSERT_TRUE(queue.submit(queued));
+    ASSERT_TRUE(queue.submit(queuedDuplicate));
+    ASSERT_TRUE(queue.submit(inProgressDuplicate));
+    EXPECT_EQ(1u, queue.depth()) << "a duplicate was queued";
+    gate.open();
+
+    TestRequest* requests[] = { inProgress, queued, queuedDuplicate, inProgressDuplicate };
+    for (int32_t i = 0; i < 4; i++) {
+        requests[i]->wait();
+        EXPECT_EQ((uint8_t*)requests[i]->key(), requests[i]->startPC());
+        EXPECT_EQ(COMPILATION_SUCCEEDED, requests[i]->returnCode());
+        requests[i]->release();
+    }
+    queue.shutdown();
+
+    ASSERT_EQ(2u, compiled.size());
+    EXPECT_EQ(&keys[0], compiled[0]);
+    EXPECT_EQ(&keys[1], compiled[1]);
+}
+
+TEST_F(CompilationQueueTest, HottestRequestsFirst)
+{
+    Gate gate;
+    TR::CompilationQueue queue;
+    ASSERT_TRUE(queue.start());
+
+    TestRequest* blocker = TestRequest::create(&keys[0], warm, &compiled, &gate);
+    ASSERT_TRUE(queue.submit(blocker));
+    gate.waitUntilEntered();
+
+    TestRequest* requests[] = {
+        TestRequest::create(&keys[1], cold, &compiled),
+        TestRequest::create(&keys[2], warm, &compiled),
+        TestRequest::create(&keys[3], hot, &compiled),
+        TestRequest::create(&keys[4], warm, &compiled),
+        TestRequest::create(&keys[5], cold, &compiled),
+        /* moves the queued cold request for keys[5] up to scorching */
+        TestRequest::create(&keys[5], scorching, &compiled),
+    };
+    for (int32_t i = 0; i < 6; i++) {
+        ASSERT_TRUE(queue.submit(requests[i]));
+    }
+    EXPECT_EQ(5u, queue.depth());
+    gate.open();
+
+    for (int32_t i = 0; i < 6; i++) {
+        requests[i]->wait();
+        requests[i]->release();
+    }
+    blocker->wait();
+    blocker->release();
+    queue.shutdown();
+
+    const void* expected[] = { &keys[0], &keys[5], &keys[3], &keys[2], &keys[4], &keys[1] };
+    ASSERT_EQ(6u, compiled.size());
+    for (int32_t i = 0; i < 6; i++) {
+        EXPECT_EQ(expected[i], compiled[i]) << "at position " << i;
+    }
+}
+
+TEST_F(CompilationQueueTest, CallbacksRunBeforeWaitReturns)
+{
+    Gate gate;
+    TR::CompilationQueue queue;
+    ASSERT_TRUE(queue.start());
+
+    CallbackState original = { false, false, NULL };
+    CallbackState duplicate = { false, false, NULL };
+    TestRequest* request = TestRequest::create(&keys[0], warm, &compiled, &gate, recordCallback, &original);
+    TestRequest* follower = TestRequest::create(&keys[0], warm, &compiled, NULL, recordCallback, &duplicate);
+    ASSERT_TRUE(queue.submit(request));
+    gate.waitUntilEntered();
+    ASSERT_TRUE(queue.submit(follower));
+    gate.open();
+
+    /* the waiter may free the user data as soon as wait() returns, so the callbacks must be done by then */
+    request->wait();
+    follower->wait();
+    EXPECT_TRUE(original.called);
+    EXPECT_TRUE(duplicate.called);
+    EXPECT_FALSE(original.doneInCallback);
+    EXPECT_FALSE(duplicate.doneInCallback);
+    EXPECT_EQ(&keys[0], original.startPC);
+    EXPECT_EQ(&keys[0], duplicate.startPC);
+    request->release();
+    follower->release();
+    queue.shutdown();
+}
+
+TEST_F(CompilationQueueTest, ShutdownCompilesQueuedRequests)
+{
+    Gate gate;
+    TR::CompilationQueue queue;
+    ASSERT_TRUE(queue.start());
+
+    TestRequest* requests[8];
+    requests[0] = TestRequest::create(&keys[0], warm, &compiled, &gate);
+    ASSERT_TRUE(queue.submit(requests[0]));
+    gate.waitUntilEntered();
+    for (int32_t i = 1; i < 8; i++) {
+        requests[i] = TestRequest::create(&keys[i], warm, &compiled);
+        ASSERT_TRUE(queue.submit(requests[i]));
+    }
+    gate.open();
+    queue.shutdown();
+
+    EXPECT_EQ(0u, queue.depth());
+    for (int32_t i = 0; i < 8; i++) {
+        EXPECT_TRUE(requests[i]->isDone()) << "request " << i << " was dropped by shutdown";
+        requests[i]->release();
+    }
+
+    TestRequest* late = TestRequest::create(&keys[0], warm, &compiled);
+    EXPECT_FALSE(queue.submit(late)) << "the queue accepted a request after shutdown";
+    late->release();
+}
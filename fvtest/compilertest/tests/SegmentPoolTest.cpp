@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "env/MemorySegment.hpp"
+#include "env/RawAllocator.hpp"
+#include "env/SegmentPool.hpp"
+#include "env/SystemSegmentProvider.hpp"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace {
+
+const size_t segmentSize = 1 << 16;
+
+class SegmentPoolTest : public ::testing::Test {
+protected:
+    SegmentPoolTest()
+        : _backingProvider(segmentSize, _rawAllocator)
+    {}
+
+    // A compilation that needs segmentCount segments of the default size at once, after which the owner of
+    // the pool trims it
+    void compile(TR::SegmentPool& pool, size_t segmentCount)
+    {
+        std::vector<TR::MemorySegment*> segments;
+        for (size_t i = 0; i < segmentCount; i++)
+            segments.push_back(&pool.request(segmentSize));
+        for (size_t i = 0; i < segmentCount; i++)
+            pool.release(*segments[i]);
+        pool.trim();
+    }
+
+    size_t backingSegments() { return _backingProvider.bytesInUse() / segmentSize; }
+
+    TR::RawAllocator _rawAllocator;
+    TR::SystemSegmentProvider _backingProvider;
+};
+
+TEST_F(SegmentPoolTest, ReusesSegmentsAcrossCompilations)
+{
+    TR::SegmentPool pool(_backingProvider, 16, _rawAllocator);
+
+    compile(pool, 4);
+    ASSERT_EQ(4u, pool.segmentRequests());
+    ASSERT_EQ(0u, pool.segmentReuses()) << "the first compilation finds the pool empty";
+    ASSERT_EQ(4u, backingSegments()) << "the pool keeps the segments of the compilation";
+
+    compile(pool, 4);
+    ASSERT_EQ(8u, pool.segmentRequests());
+    ASSERT_EQ(4u, pool.segmentReuses()) << "the second compilation gets the segments of the first";
+    ASSERT_EQ(4u, backingSegments()) << "the second compilation needed no new segments";
+
+    // Larger segments are not kept
+    pool.release(pool.request(2 * segmentSize));
+    ASSERT_EQ(4u, backingSegments());
+}
+
+TEST_F(SegmentPoolTest, PrefaultedSegmentsAreReused)
+{
+    TR::SegmentPool pool(_backingProvider, 16, _rawAllocator);
+    pool.prefault(3);
+    ASSERT_EQ(3u, backingSegments());
+
+    compile(pool, 3);
+    ASSERT_EQ(3u, pool.segmentReuses());
+    ASSERT_EQ(3u, backingSegments());
+}
+
+TEST_F(SegmentPoolTest, KeepsNoMoreThanThePoolSize)
+{
+    TR::SegmentPool pool(_backingProvider, 4, _rawAllocator);
+    pool.prefault(8);
+    ASSERT_EQ(4u, backingSegments()) << "prefaulting stops at the pool size";
+
+    compile(pool, 8);
+    ASSERT_EQ(4u, backingSegments()) << "segments released beyond the pool size go back to the system";
+}
+
+TEST_F(SegmentPoolTest, TrimsWhatRecentCompilationsDidNotNeed)
+{
+    TR::SegmentPool pool(_backingProvider, 16, _rawAllocator);
+
+    compile(pool, 8);
+    ASSERT_EQ(8u, backingSegments());
+
+    // The excess kept for the large compilation halves with each small one
+    compile(pool, 1);
+    ASSERT_EQ(4u, backingSegments());
+    compile(pool, 1);
+    ASSERT_EQ(2u, backingSegments());
+    compile(pool, 1);
+    ASSERT_EQ(1u, backingSegments());
+    compile(pool, 1);
+    ASSERT_EQ(1u, backingSegments());
+
+    // A large compilation raises the allowance again at once
+    compile(pool, 6);
+    ASSERT_EQ(6u, backingSegments());
+}
+
+TEST_F(SegmentPoolTest, TrimCountsOnlyTheSegmentsOfTheLastCompilation)
+{
+    TR::SegmentPool pool(_backingProvider, 16, _rawAllocator);
+
+    // Segments still held when a compilation ends are not part of what the next compilation needs
+    TR::MemorySegment& held = pool.request(segmentSize);
+    compile(pool, 0);
+    compile(pool, 2);
+    ASSERT_EQ(3u, backingSegments());
+    compile(pool, 0);
+    ASSERT_EQ(2u, backingSegments()) << "one segment in use and half the allowance of two kept";
+
+    // Nor does a segment released after the compilation that used it ended
+    pool.release(held);
+    pool.trim();
+    ASSERT_EQ(0u, backingSegments());
+}
+
+} // namespace
@@ -20,16 +20,23 @@
  *******************************************************************************/
 
 #include "CollectorLanguageInterface.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "MarkMap.hpp"
 #include "ObjectAllocationModel.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseGCDecoder.hpp"
 #include "VerboseWriterChain.hpp"
 
+#include <string>
+
 //#define OMRGCTEST_PRINTFILE
 
 #define MAX_NAME_LENGTH 512
@@ -41,14 +48,42 @@
 #define DO_STRINGFY(str) #str
 
 const char* gcTests[] = { "fvtest/gctest/configuration/sample_GC_config.xml",
-    "fvtest/gctest/configuration/test_system_gc.xml", "fvtest/gctest/configuration/global_GC_config.xml"
+    "fvtest/gctest/configuration/test_system_gc.xml", "fvtest/gctest/configuration/global_GC_config.xml",
+    "fvtest/gctest/configuration/global_workstealing_GC_config.xml",
+    "fvtest/gctest/configuration/global_tlhcache_GC_config.xml",
+    "fvtest/gctest/configuration/global_tlhadaptive_GC_config.xml",
+    "fvtest/gctest/configuration/global_pretouch_GC_config.xml",
+    "fvtest/gctest/configuration/global_asynclog_GC_config.xml",
+    "fvtest/gctest/configuration/global_heapwalk_GC_config.xml",
+    "fvtest/gctest/configuration/global_arraysplit_GC_config.xml",
+    "fvtest/gctest/configuration/verbose_binary_GC_config.xml",
+    "fvtest/gctest/configuration/global_syncpark_GC_config.xml",
+    "fvtest/gctest/configuration/global_syncspin_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
     ,
-    "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+    "fvtest/gctest/configuration/optavgpause_GC_config.xml",
+    "fvtest/gctest/configuration/optavgpause_cardsummary_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK) && defined(OMR_GC_CONCURRENT_SWEEP)
+    ,
+    "fvtest/gctest/configuration/optavgpause_concurrentsweep_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+    ,
+    "fvtest/gctest/configuration/global_compact_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
     ,
-    "fvtest/gctest/configuration/scavenger_GC_config.xml", "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+    "fvtest/gctest/configuration/scavenger_GC_config.xml", "fvtest/gctest/configuration/scavenger_GC_backout_config.xml",
+    "fvtest/gctest/configuration/scavenger_rsdedup_GC_config.xml",
+    "fvtest/gctest/configuration/scavenger_pausetarget_GC_config.xml",
+    "fvtest/gctest/configuration/scavenger_adaptivethreads_GC_config.xml",
+    "fvtest/gctest/configuration/scavenger_parallelroots_GC_config.xml",
+    "fvtest/gctest/configuration/scavenger_numa_GC_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+    ,
+    "fvtest/gctest/configuration/segregated_magazines_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
     ,
@@ -57,7 +92,14 @@ const char* gcTests[] = { "fvtest/gctest/configuration/sample_GC_config.xml",
 };
 
 const char* perfTests[] = { "perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-    "perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml" };
+    "perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+    "perftest/gctest/configuration/verbose_binary_perf_config.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+    ,
+    "perftest/gctest/configuration/scavenger_prefetch_perf_config.xml",
+    "perftest/gctest/configuration/scavenger_prefetch_baseline_perf_config.xml"
+#endif
+};
 void GCConfigTest::SetUp()
 {
     OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
@@ -101,6 +143,7 @@ void GCConfigTest::SetUp()
     const char* verboseFileNamePrefix = optionNode.attribute("verboseLog").value();
     numOfFiles = (uintptr_t)optionNode.attribute("numOfFiles").as_int();
     uintptr_t numOfCycles = (uintptr_t)optionNode.attribute("numOfCycles").as_int();
+    duplicateRememberedSetEntries = optionNode.attribute("duplicateRememberedSetEntries").as_bool();
     if (0 == strcmp(verboseFileNamePrefix, "")) {
         verboseFileNamePrefix = "VerboseGCOutput";
     }
@@ -630,7 +673,17 @@ int32_t GCConfigTest::attachChildEntry(ObjectEntry* parentEntry, ObjectEntry* ch
 
     if ((uint32_t)parentEntry->numOfRef < slotCount) {
         fomrobject_t* childSlot = firstSlot + parentEntry->numOfRef;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+        bool parentRemembered = extensions->objectModel.isRemembered(parentEntry->objPtr);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
         standardWriteBarrierStore(exampleVM->_omrVMThread, parentEntry->objPtr, childSlot, childEntry->objPtr);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+        if (duplicateRememberedSetEntries && !parentRemembered
+            && extensions->objectModel.isRemembered(parentEntry->objPtr)) {
+            /* Remember the parent once more, as a language barrier that does not test the remembered bit would */
+            extensions->scavenger->addToRememberedSetFragment((MM_EnvironmentStandard*)env, parentEntry->objPtr);
+        }
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
         gcTestEnv->log(LEVEL_VERBOSE, "\tadd child %s(%p[0x%llx]) to parent %s(%p[0x%llx]) slot %p[%llx].\n",
             childEntry->name, childEntry->objPtr, childEntry->objPtr->header.raw(), parentEntry->name,
             parentEntry->objPtr, parentEntry->objPtr->header.raw(), childSlot, (uintptr_t)*childSlot);
@@ -829,6 +882,54 @@ void printFile(const char* name)
 }
 #endif
 
+static void appendDecodedText(void* userData, const char* text, uintptr_t length)
+{
+    ((std::string*)userData)->append(text, length);
+}
+
+/**
+ * Load a verbose GC log, decoding it first when the test runs with verboseBinaryFormat. A binary log must decode
+ * without error and end on a record boundary, so records the writer dropped or mangled fail the test here.
+ */
+pugi::xml_parse_status GCConfigTest::loadVerboseFile(pugi::xml_document* verboseDoc, const char* name)
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+    intptr_t fileDescriptor = omrfile_open(name, EsOpenRead, 0444);
+    if (-1 == fileDescriptor) {
+        return pugi::status_file_not_found;
+    }
+
+    std::string contents;
+    char chunk[4096];
+    intptr_t length = 0;
+    while (0 < (length = omrfile_read(fileDescriptor, chunk, sizeof(chunk)))) {
+        contents.append(chunk, length);
+    }
+    omrfile_close(fileDescriptor);
+
+    MM_GCExtensionsBase* extensions = env->getExtensions();
+    bool isBinary = VerboseGCDecoder::isBinaryFormat((const uint8_t*)contents.data(), contents.size());
+    if (isBinary != extensions->verboseBinaryFormat) {
+        gcTestEnv->log(LEVEL_ERROR, "%s:%d Verbose log %s is %s, expected %s.\n", __FILE__, __LINE__, name,
+            isBinary ? "binary" : "text", extensions->verboseBinaryFormat ? "binary" : "text");
+        return pugi::status_io_error;
+    }
+    if (isBinary) {
+        std::string text;
+        VerboseGCDecoder decoder(appendDecodedText, &text);
+        if (!decoder.decode((const uint8_t*)contents.data(), contents.size()) || !decoder.finish()) {
+            gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to decode verbose log %s: %s.\n", __FILE__, __LINE__, name,
+                decoder.getError());
+            return pugi::status_io_error;
+        }
+        contents.swap(text);
+    }
+
+    /* the log is still open, so a text log lacks its closing tag; the parsed prefix is all that is verified */
+    verboseDoc->load_buffer(contents.data(), contents.size());
+    return pugi::status_ok;
+}
+
 int32_t GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
     OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
@@ -849,7 +950,11 @@ int32_t GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
     do {
         pugi::xml_document verboseDoc;
         if (0 == numOfFiles) {
-            verboseDoc.load_file(verboseFile);
+            if (pugi::status_ok != loadVerboseFile(&verboseDoc, verboseFile)) {
+                rt = 1;
+                gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to load verbose log %s.\n", __FILE__, __LINE__, verboseFile);
+                goto done;
+            }
             gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
             printFile(verboseFile);
@@ -857,9 +962,14 @@ int32_t GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
         } else {
             char currentVerboseFile[MAX_NAME_LENGTH];
             omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-            pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
-            if (pugi::status_file_not_found == result.status) {
+            pugi::xml_parse_status status = loadVerboseFile(&verboseDoc, currentVerboseFile);
+            if (pugi::status_file_not_found == status) {
                 break;
+            } else if (pugi::status_ok != status) {
+                rt = 1;
+                gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to load verbose log %s.\n", __FILE__, __LINE__,
+                    currentVerboseFile);
+                goto done;
             }
             gcTestEnv->log("Parsing verbose log %s:\n", currentVerboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
@@ -928,6 +1038,40 @@ done:
     return rt;
 }
 
+/**
+ * Check that the objects named by each liveObjects node survived the collections: the objects namePrefix_depth_0 to
+ * namePrefix_depth_(count - 1) must still be in the object table, which the collector clears of unmarked objects.
+ */
+int32_t GCConfigTest::verifyLiveObjects(pugi::xpath_node_set liveObjects)
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+    int32_t rt = 0;
+    for (pugi::xpath_node_set::const_iterator it = liveObjects.begin(); it != liveObjects.end(); ++it) {
+        const char* namePrefixStr = it->node().attribute("namePrefix").value();
+        int32_t depth = it->node().attribute("depth").as_int(0);
+        int32_t count = it->node().attribute("count").as_int(1);
+        int32_t missing = 0;
+        for (int32_t i = 0; i < count; i++) {
+            char objName[MAX_NAME_LENGTH];
+            omrstr_printf(objName, MAX_NAME_LENGTH, "%s_%d_%d", namePrefixStr, depth, i);
+            if (NULL == find(objName)) {
+                if (0 == missing) {
+                    gcTestEnv->log(LEVEL_ERROR, "%s:%d Live object %s was collected.\n", __FILE__, __LINE__, objName);
+                }
+                missing += 1;
+            }
+        }
+        if (0 != missing) {
+            gcTestEnv->log(LEVEL_ERROR, "*FAILED* %d of %d %s objects at depth %d were collected\n", missing, count,
+                namePrefixStr, depth);
+            rt = 1;
+        } else {
+            gcTestEnv->log("Verified %d live %s objects at depth %d *PASSED*\n", count, namePrefixStr, depth);
+        }
+    }
+    return rt;
+}
+
 int32_t GCConfigTest::parseGarbagePolicy(pugi::xml_node node)
 {
     int32_t rt = 0;
@@ -999,12 +1143,106 @@ int32_t GCConfigTest::triggerOperation(pugi::xml_node node)
             }
             OMRGCTEST_CHECK_RT(rt);
             verboseManager->getWriterChain()->endOfCycle(env);
+        } else if (0 == strcmp(node.name(), "heapWalk")) {
+            rt = walkHeap(node);
+            OMRGCTEST_CHECK_RT(rt);
         }
     }
 done:
     return rt;
 }
 
+/* Objects and bytes seen by one GC thread during a heap walk, padded to a cache line */
+typedef struct HeapWalkCounter {
+    uintptr_t objects;
+    uintptr_t bytes;
+    uint8_t padding[64 - (2 * sizeof(uintptr_t))];
+} HeapWalkCounter;
+
+static void heapWalkCountObject(
+    OMR_VMThread* omrVMThread, MM_HeapRegionDescriptor* region, omrobjectptr_t object, void* userData)
+{
+    MM_EnvironmentBase* walkEnv = MM_EnvironmentBase::getEnvironment(omrVMThread);
+    HeapWalkCounter* counter = (HeapWalkCounter*)userData + walkEnv->getSlaveID();
+    counter->objects += 1;
+    counter->bytes += walkEnv->getExtensions()->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+
+/**
+ * Walk the heap in parallel with 1, 2, 4, ... GC threads up to the number of GC threads, "iterations" times for
+ * each thread count, and report the best walk time and object rate of each thread count. Every walk must see the
+ * same objects.
+ */
+int32_t GCConfigTest::walkHeap(pugi::xml_node node)
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+    int32_t rt = 0;
+    MM_GCExtensionsBase* extensions = env->getExtensions();
+    MM_ParallelGlobalGC* globalCollector = (MM_ParallelGlobalGC*)extensions->getGlobalCollector();
+    MM_ParallelHeapWalker* heapWalker = (MM_ParallelHeapWalker*)globalCollector->getHeapWalker();
+    uintptr_t threadCountMaximum = extensions->dispatcher->threadCountMaximum();
+    uintptr_t iterations = 3;
+    const char* iterationsStr = node.attribute("iterations").value();
+    if (0 != strcmp(iterationsStr, "")) {
+        iterations = OMR_MAX(atoi(iterationsStr), 1);
+    }
+
+    HeapWalkCounter* counters = (HeapWalkCounter*)omrmem_allocate_memory(
+        sizeof(HeapWalkCounter) * threadCountMaximum, OMRMEM_CATEGORY_MM);
+    if (NULL == counters) {
+        gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate heap walk counters.\n", __FILE__, __LINE__);
+        return 1;
+    }
+
+    env->acquireExclusiveVMAccess();
+    /* mark once so that every walk is split by the same mark map, and only the walks are timed */
+    bool markMapWasValid = heapWalker->getMarkMap()->isMarkMapValid();
+    globalCollector->prepareHeapForWalk(env);
+    heapWalker->getMarkMap()->setMarkMapValid(true);
+
+    uintptr_t expectedObjects = 0;
+    uint64_t singleThreadMicros = 0;
+    for (uintptr_t threadCount = 1; (0 == rt) && (threadCount <= threadCountMaximum); threadCount *= 2) {
+        uint64_t bestMicros = UINT64_MAX;
+        uintptr_t objects = 0;
+        uintptr_t bytes = 0;
+        for (uintptr_t iteration = 0; iteration < iterations; iteration++) {
+            memset(counters, 0, sizeof(HeapWalkCounter) * threadCountMaximum);
+            uint64_t startTime = omrtime_hires_clock();
+            heapWalker->allObjectsDoWithThreadCount(env, heapWalkCountObject, counters, 0, threadCount, false);
+            uint64_t micros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+            bestMicros = OMR_MIN(bestMicros, micros);
+
+            objects = 0;
+            bytes = 0;
+            for (uintptr_t slave = 0; slave < threadCountMaximum; slave++) {
+                objects += counters[slave].objects;
+                bytes += counters[slave].bytes;
+            }
+            if (0 == expectedObjects) {
+                expectedObjects = objects;
+            } else if (objects != expectedObjects) {
+                gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walk with %zu threads saw %zu objects, expected %zu.\n",
+                    __FILE__, __LINE__, threadCount, objects, expectedObjects);
+                rt = 1;
+                break;
+            }
+        }
+        if (1 == threadCount) {
+            singleThreadMicros = bestMicros;
+        }
+        bestMicros = OMR_MAX(bestMicros, 1);
+        gcTestEnv->log("Heap walk: threads=%zu objects=%zu bytes=%zu time=%llu us rate=%.1f objects/ms speedup=%.2f\n",
+            threadCount, objects, bytes, bestMicros, (double)objects * 1000 / bestMicros,
+            (double)singleThreadMicros / bestMicros);
+    }
+
+    heapWalker->getMarkMap()->setMarkMapValid(markMapWasValid);
+    env->releaseExclusiveVMAccess();
+    omrmem_free_memory(counters);
+    return rt;
+}
+
 int32_t GCConfigTest::iniXMLStr(const char* configStyle)
 {
     int32_t rt = 0;
@@ -1072,6 +1310,8 @@ TEST_P(GCConfigTest, test)
             pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
             rt = verifyVerboseGC(verboseGCs);
             ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
+            rt = verifyLiveObjects(configChild.select_nodes("liveObjects"));
+            ASSERT_EQ(0, rt) << "Failed in live object verification.";
             gcTestEnv->log("[ Verification Successful ]\n\n");
         } else if (0 == strcmp(configChild.name(), "operation")) {
             gcTestEnv->log("\n++++++++++++++++++++++++++++Operation+++++++++++++++++++++++++++\n");
@@ -79,6 +79,9 @@ protected:
     char* verboseFile;
     uintptr_t numOfFiles;
 
+    /* mutator options */
+    bool duplicateRememberedSetEntries;
+
     /*
      * Function members
      */
@@ -102,9 +105,12 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
     void printFile(const char* name);
 #endif
+    pugi::xml_parse_status loadVerboseFile(pugi::xml_document* verboseDoc, const char* name);
     int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
+    int32_t verifyLiveObjects(pugi::xpath_node_set liveObjects);
     int32_t parseGarbagePolicy(pugi::xml_node node);
     int32_t triggerOperation(pugi::xml_node node);
+    int32_t walkHeap(pugi::xml_node node);
     int32_t iniXMLStr(const char* configStyle);
 
     /* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -153,6 +159,7 @@ public:
         , verboseManager(NULL)
         , verboseFile(NULL)
         , numOfFiles(0)
+        , duplicateRememberedSetEntries(false)
     {
         gp.namePrefix = NULL;
         gp.percentage = 0.0f;
@@ -82,8 +82,69 @@ bool MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase* ext
                     extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
                 } else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
                     extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+                } else if (0 == strcmp(attr.name(), "markingArraySplitMinimumAmount")) {
+                    extensions->markingArraySplitMinimumAmount = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "markingArraySplitMaximumAmount")) {
+                    extensions->markingArraySplitMaximumAmount = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "workStealingMarking")) {
+                    extensions->workStealingMarking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "tlhAllocationCacheCount")) {
+                    extensions->tlhAllocationCacheCount = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "allocationCacheMagazineSize")) {
+                    extensions->allocationCacheMagazineSize = atoi(attr.value()) * unitSize;
+                } else if (0 == strcmp(attr.name(), "allocationCacheMagazineBatch")) {
+                    extensions->allocationCacheMagazineBatch = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "cardTableSummary")) {
+                    extensions->cardTableSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "asyncLogging")) {
+                    extensions->asyncLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "verboseBinaryFormat")) {
+                    extensions->verboseBinaryFormat = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "heapPretouch")) {
+                    extensions->heapPretouch = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "parallelHeapWalkUnitSize")) {
+                    extensions->parallelHeapWalkUnitSize = atoi(attr.value()) * unitSize;
+                } else if (0 == strcmp(attr.name(), "parallelHeapWalkUnitObjects")) {
+                    extensions->parallelHeapWalkUnitObjects = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+                    extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "tlhAdaptiveRefreshInterval")) {
+                    extensions->tlhAdaptiveRefreshInterval = atoi(attr.value());
+                } else if (0 == strcmp(attr.name(), "scavengerSlotPrefetchDepth")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                    extensions->scavengerSlotPrefetchDepth
+                        = OMR_MIN((uintptr_t)atoi(attr.value()), MAXIMUM_SCAVENGER_SLOT_PREFETCH_DEPTH);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+                } else if (0 == strcmp(attr.name(), "scavengerRememberedSetDeduplication")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                    extensions->scavengerRememberedSetDeduplication = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* OMR_GC_MODRON_SCAVENGER */
+                } else if (0 == strcmp(attr.name(), "scavengerPauseTargetMillis")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                    extensions->scavengerPauseTargetMillis = atoi(attr.value());
+#endif /* OMR_GC_MODRON_SCAVENGER */
+                } else if (0 == strcmp(attr.name(), "scavengerPauseTargetOverhead")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                    extensions->scavengerPauseTargetOverhead = atof(attr.value());
+#endif /* OMR_GC_MODRON_SCAVENGER */
+                } else if (0 == strcmp(attr.name(), "scavengerWorkPerThread")) {
+#if defined(OMR_GC_MODRON_SCAVENGER)
+                    extensions->scavengerWorkPerThread = atoi(attr.value()) * unitSize;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+                } else if (0 == strcmp(attr.name(), "adaptiveGCThreadCount")) {
+                    extensions->adaptiveGCThreadCount = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "synchronizeGCThreadsSpinMicros")) {
+                    extensions->synchronizeGCThreadsSpinMicros = atoi(attr.value());
                 } else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-                    /* TODO: support multi-thread GC*/
+                    extensions->gcThreadCount = atoi(attr.value());
+                    extensions->gcThreadCountForced = true;
+                } else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+                    extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true")) ? 1 : 0;
+                    extensions->noCompactOnGlobalGC = 1 - extensions->compactOnGlobalGC;
+#endif /* OMR_GC_MODRON_COMPACTION */
+                } else if (0 == strcmp(attr.name(), "numaSimulatedNodeCount")) {
+                    extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
                 } else if (0 == strcmp(attr.name(), "GCPolicy")) {
                     if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -93,9 +154,18 @@ bool MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase* ext
                             "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see "
                             "configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+                    } else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        _useSegregatedGC = true;
+#else
+                        gcTestEnv->log(LEVEL_ERROR,
+                            "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see "
+                            "configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
                     } else if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
                         gcTestEnv->log(LEVEL_ERROR,
-                            "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+                            "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n",
+                            attr.value());
                         result = false;
                     }
                 } else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -106,14 +176,25 @@ bool MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase* ext
                         "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see "
                         "configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+                } else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                    extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+                    gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+                } else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+                    extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #if defined(OMR_GC_MODRON_SCAVENGER)
                 } else if (0 == strcmp(attr.name(), "forceBackOut")) {
                     extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
                 } else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
                     extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+                } else if (0 == strcmp(attr.name(), "rememberedSetMaxSize")) {
+                    extensions->rememberedSet.setMaxSize(atoi(attr.value()) * unitSize);
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
                 } else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles"))
-                    || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
+                    || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))
+                    || (0 == strcmp(attr.name(), "duplicateRememberedSetEntries"))) {
                 } else {
                     gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
                     result = false;
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "HeapMapWordOperations.hpp"
+
+#include <gtest/gtest.h>
+
+#define TEST_WORD_COUNT 300
+
+/* Exercise every selected implementation against the scalar one over a range of alignments and run lengths */
+class TestHeapMapWordOperations : public ::testing::Test
+{
+protected:
+    uintptr_t _words[TEST_WORD_COUNT];
+
+    virtual void SetUp() { MM_HeapMapWordOperations::initialize(); }
+
+    virtual void TearDown() { MM_HeapMapWordOperations::initialize(); }
+
+    void fill(uintptr_t value)
+    {
+        for (uintptr_t i = 0; i < TEST_WORD_COUNT; i++) {
+            _words[i] = value;
+        }
+    }
+};
+
+TEST_F(TestHeapMapWordOperations, findNonZeroWord)
+{
+    for (uintptr_t start = 0; start < 16; start++) {
+        for (uintptr_t set = start; set < TEST_WORD_COUNT; set += 7) {
+            fill(0);
+            _words[set] = (uintptr_t)1 << (set % (sizeof(uintptr_t) * 8));
+            uintptr_t count = TEST_WORD_COUNT - start;
+            EXPECT_EQ(set - start, MM_HeapMapWordOperations::findNonZeroWord(_words + start, count));
+            EXPECT_EQ(set - start, MM_HeapMapWordOperations::findNonZeroWordScalar(_words + start, count));
+            /* a run ending before the set word is all zero */
+            EXPECT_EQ(set - start, MM_HeapMapWordOperations::findNonZeroWord(_words + start, set - start));
+        }
+    }
+}
+
+TEST_F(TestHeapMapWordOperations, clearWords)
+{
+    for (uintptr_t start = 0; start < 16; start++) {
+        for (uintptr_t count = 0; (start + count) <= TEST_WORD_COUNT; count += 13) {
+            fill(~(uintptr_t)0);
+            MM_HeapMapWordOperations::clearWords(_words + start, count);
+            for (uintptr_t i = 0; i < TEST_WORD_COUNT; i++) {
+                bool cleared = (i >= start) && (i < (start + count));
+                ASSERT_EQ(cleared ? (uintptr_t)0 : ~(uintptr_t)0, _words[i]);
+            }
+        }
+    }
+}
+
+TEST_F(TestHeapMapWordOperations, clearWordsStreaming)
+{
+    /* large enough to take the non-temporal store path where one is selected */
+    uintptr_t count = (512 * 1024) / sizeof(uintptr_t);
+    uintptr_t* words = new uintptr_t[count + 1];
+    for (uintptr_t i = 0; i <= count; i++) {
+        words[i] = ~(uintptr_t)0;
+    }
+    MM_HeapMapWordOperations::clearWords(words + 1, count);
+    EXPECT_EQ(~(uintptr_t)0, words[0]);
+    EXPECT_EQ(count, MM_HeapMapWordOperations::findNonZeroWord(words + 1, count));
+    delete[] words;
+}
+
+TEST_F(TestHeapMapWordOperations, populationCount)
+{
+    for (uintptr_t i = 0; i < TEST_WORD_COUNT; i++) {
+        _words[i] = i * (uintptr_t)0x9E3779B97F4A7C15ULL;
+    }
+    for (uintptr_t start = 0; start < 16; start++) {
+        uintptr_t count = TEST_WORD_COUNT - start;
+        EXPECT_EQ(MM_HeapMapWordOperations::populationCountScalar(_words + start, count),
+            MM_HeapMapWordOperations::populationCount(_words + start, count));
+    }
+}
+
+TEST_F(TestHeapMapWordOperations, forceScalar)
+{
+    MM_HeapMapWordOperations::forceScalar();
+    EXPECT_EQ(MM_HeapMapWordOperations::implementation_scalar, MM_HeapMapWordOperations::getImplementation());
+    fill(0);
+    _words[TEST_WORD_COUNT - 1] = 3;
+    EXPECT_EQ((uintptr_t)(TEST_WORD_COUNT - 1), MM_HeapMapWordOperations::findNonZeroWord(_words, TEST_WORD_COUNT));
+    EXPECT_EQ((uintptr_t)2, MM_HeapMapWordOperations::populationCount(_words, TEST_WORD_COUNT));
+}
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "SegregatedMagazineDepot.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+#define TEST_SIZE_CLASS OMR_SIZECLASSES_MIN_SMALL
+
+TEST(TestSegregatedMagazineDepot, pushPop)
+{
+    MM_SegregatedMagazineDepot depot;
+    uintptr_t magazines[MM_SegregatedMagazineDepot::_slotsPerSizeClass + 1];
+
+    EXPECT_TRUE(NULL == depot.pop(TEST_SIZE_CLASS));
+    for (uintptr_t i = 0; i < MM_SegregatedMagazineDepot::_slotsPerSizeClass; i++) {
+        EXPECT_TRUE(depot.push(TEST_SIZE_CLASS, &magazines[i]));
+    }
+    /* the depot is full for this size class, but not for others */
+    EXPECT_FALSE(depot.push(TEST_SIZE_CLASS, &magazines[MM_SegregatedMagazineDepot::_slotsPerSizeClass]));
+    EXPECT_TRUE(depot.push(TEST_SIZE_CLASS + 1, &magazines[MM_SegregatedMagazineDepot::_slotsPerSizeClass]));
+
+    uintptr_t popped = 0;
+    for (void* magazine = depot.pop(TEST_SIZE_CLASS); NULL != magazine; magazine = depot.pop(TEST_SIZE_CLASS)) {
+        EXPECT_TRUE((magazine >= (void*)&magazines[0])
+            && (magazine < (void*)&magazines[MM_SegregatedMagazineDepot::_slotsPerSizeClass]));
+        popped += 1;
+    }
+    EXPECT_EQ((uintptr_t)MM_SegregatedMagazineDepot::_slotsPerSizeClass, popped);
+
+    depot.flush();
+    EXPECT_TRUE(NULL == depot.pop(TEST_SIZE_CLASS + 1));
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+// Each method multiplies its argument by a different factor, so a method compiled for the wrong
+// builder, or an entry point returned for the wrong method, is caught.
+class ScaleBuilder : public OMR::JitBuilder::MethodBuilder {
+public:
+    ScaleBuilder(OMR::JitBuilder::TypeDictionary* types, int32_t factor)
+        : OMR::JitBuilder::MethodBuilder(types)
+        , _factor(factor)
+    {
+        DefineLine(LINETOSTR(__LINE__));
+        DefineFile(__FILE__);
+        DefineName("scale");
+        DefineParameter("x", Int32);
+        DefineReturnType(Int32);
+    }
+
+    virtual bool buildIL()
+    {
+        Return(Mul(Load("x"), ConstInt32(_factor)));
+        return true;
+    }
+
+private:
+    int32_t _factor;
+};
+
+typedef int32_t (*ScaleFunctionType)(int32_t);
+
+// Methods compiled concurrently must not share a TypeDictionary
+class ScaleMethods {
+public:
+    static const uint32_t count = 32;
+
+    ScaleMethods()
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            types[i] = new OMR::JitBuilder::TypeDictionary();
+            builders[i] = new ScaleBuilder(types[i], i + 1);
+            entries[i] = NULL;
+        }
+    }
+
+    ~ScaleMethods()
+    {
+        for (uint32_t i = 0; i < count; i++) {
+            delete builders[i];
+            delete types[i];
+        }
+    }
+
+    OMR::JitBuilder::TypeDictionary* types[count];
+    OMR::JitBuilder::MethodBuilder* builders[count];
+    void* entries[count];
+};
+
+class CompileBatchTest : public JitBuilderTest {
+public:
+    static const uint32_t threadCount = 4;
+
+    virtual void SetUp()
+    {
+        ASSERT_TRUE(startCompilationThreads(threadCount)) << "Failed to start the compilation threads.";
+    }
+
+    virtual void TearDown()
+    {
+        stopCompilationThreads();
+    }
+};
+
+TEST_F(CompileBatchTest, CompileBatch)
+{
+    ScaleMethods methods;
+    ASSERT_EQ(0, OMR::JitBuilder::MethodBuilder::CompileBatch(ScaleMethods::count, methods.builders, methods.entries));
+
+    for (uint32_t i = 0; i < ScaleMethods::count; i++) {
+        ASSERT_NE((void*)NULL, methods.entries[i]) << "Method " << i << " was not compiled";
+        ScaleFunctionType scale = (ScaleFunctionType)methods.entries[i];
+        EXPECT_EQ(3 * (int32_t)(i + 1), scale(3)) << "Method " << i << " computes the wrong result";
+    }
+}
+
+TEST_F(CompileBatchTest, EmptyBatch)
+{
+    ASSERT_EQ(0, OMR::JitBuilder::MethodBuilder::CompileBatch(0, NULL, NULL));
+}
+
+TEST_F(CompileBatchTest, CompileAsync)
+{
+    ScaleMethods methods;
+    for (uint32_t i = 0; i < ScaleMethods::count; i++)
+        ASSERT_TRUE(methods.builders[i]->CompileAsync()) << "Failed to queue method " << i;
+
+    // only one compilation of a method can be in flight
+    ASSERT_FALSE(methods.builders[0]->CompileAsync());
+
+    for (uint32_t i = 0; i < ScaleMethods::count; i++) {
+        ASSERT_EQ(0, methods.builders[i]->WaitForCompile(&methods.entries[i])) << "Failed to compile method " << i;
+        ScaleFunctionType scale = (ScaleFunctionType)methods.entries[i];
+        EXPECT_EQ(-5 * (int32_t)(i + 1), scale(-5)) << "Method " << i << " computes the wrong result";
+    }
+}
+
+TEST_F(CompileBatchTest, NoCompilationThreads)
+{
+    stopCompilationThreads();
+
+    ScaleMethods methods;
+    ASSERT_FALSE(methods.builders[0]->CompileAsync());
+    ASSERT_EQ((int32_t)ScaleMethods::count,
+        OMR::JitBuilder::MethodBuilder::CompileBatch(ScaleMethods::count, methods.builders, methods.entries));
+    for (uint32_t i = 0; i < ScaleMethods::count; i++)
+        EXPECT_EQ((void*)NULL, methods.entries[i]);
+}
@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#define PROFILE_FILE_NAME "jitbuildertest-optprofile.json"
+
+// Gives the optimizer a loop to work on
+class SumBuilder : public OMR::JitBuilder::MethodBuilder {
+public:
+    SumBuilder(OMR::JitBuilder::TypeDictionary* types)
+        : OMR::JitBuilder::MethodBuilder(types)
+    {
+        DefineLine(LINETOSTR(__LINE__));
+        DefineFile(__FILE__);
+        DefineName("sum");
+        DefineParameter("n", Int32);
+        DefineReturnType(Int32);
+    }
+
+    virtual bool buildIL()
+    {
+        Store("sum", ConstInt32(0));
+        OMR::JitBuilder::IlBuilder* loop = NULL;
+        ForLoopUp("i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+        loop->Store("sum", loop->Add(loop->Load("sum"), loop->Mul(loop->Load("i"), loop->ConstInt32(2))));
+        Return(Load("sum"));
+        return true;
+    }
+};
+
+typedef int32_t (*SumFunctionType)(int32_t);
+
+/**
+ * Just enough of JSON to check the lines the profiler writes. A value that does not parse leaves the
+ * parser failed.
+ */
+class JsonValue {
+public:
+    enum Type { Null, Number, String, Array, Object, Invalid };
+
+    JsonValue()
+        : type(Invalid)
+        , number(0)
+    {}
+
+    const JsonValue& operator[](const char* name) const
+    {
+        static JsonValue invalid;
+        const JsonValue* value = find(name);
+        return value ? *value : invalid;
+    }
+
+    static bool parse(const std::string& text, JsonValue& value)
+    {
+        size_t position = 0;
+        return parseValue(text, position, value) && skipSpace(text, position) == text.size();
+    }
+
+    Type type;
+    double number;
+    std::string string;
+    std::vector<JsonValue> elements;
+    std::vector<std::pair<std::string, JsonValue> > members;
+
+private:
+    const JsonValue* find(const char* name) const
+    {
+        for (size_t i = 0; i < members.size(); i++)
+            if (members[i].first == name)
+                return &members[i].second;
+        return NULL;
+    }
+
+    static size_t skipSpace(const std::string& text, size_t& position)
+    {
+        while (position < text.size() && isspace((unsigned char)text[position]))
+            position++;
+        return position;
+    }
+
+    static bool parseString(const std::string& text, size_t& position, std::string& string)
+    {
+        if (text[position] != '"')
+            return false;
+        for (position++; position < text.size(); position++) {
+            char c = text[position];
+            if (c == '"') {
+                position++;
+                return true;
+            }
+            if ((unsigned char)c < 0x20)
+                return false;
+            if (c == '\\') {
+                if (++position == text.size())
+                    return false;
+                c = text[position];
+                if (c == 'u') {
+                    if (position + 4 >= text.size())
+                        return false;
+                    c = (char)strtol(text.substr(position + 1, 4).c_str(), NULL, 16);
+                    position += 4;
+                } else if (c != '"' && c != '\\' && c != '/') {
+                    return false;
+                }
+            }
+            string += c;
+        }
+        return false;
+    }
+
+    static bool parseValue(const std::string& text, size_t& position, JsonValue& value)
+    {
+        if (skipSpace(text, position) == text.size())
+            return false;
+        char c = text[position];
+        if (c == '{') {
+            value.type = Object;
+            position++;
+            if (skipSpace(text, position) < text.size() && text[position] == '}') {
+                position++;
+                return true;
+            }
+            while (true) {
+                std::pair<std::string, JsonValue> member;
+                if (skipSpace(text, position) == text.size() || !parseString(text, position, member.first))
+                    return false;
+                if (skipSpace(text, position) == text.size() || text[position++] != ':')
+                    return false;
+                if (!parseValue(text, position, member.second))
+                    return false;
+                value.members.push_back(member);
+                if (skipSpace(text, position) == text.size())
+                    return false;
+                c = text[position++];
+                if (c == '}')
+                    return true;
+                if (c != ',')
+                    return false;
+            }
+        } else if (c == '[') {
+            value.type = Array;
+            position++;
+            if (skipSpace(text, position) < text.size() && text[position] == ']') {
+                position++;
+                return true;
+            }
+            while (true) {
+                JsonValue element;
+                if (!parseValue(text, position, element))
+                    return false;
+                value.elements.push_back(element);
+                if (skipSpace(text, position) == text.size())
+                    return false;
+                c = text[position++];
+                if (c == ']')
+                    return true;
+                if (c != ',')
+                    return false;
+            }
+        } else if (c == '"') {
+            value.type = String;
+            return parseString(text, position, value.string);
+        } else if (text.compare(position, 4, "null") == 0) {
+            value.type = Null;
+            position += 4;
+            return true;
+        } else {
+            const char* start = text.c_str() + position;
+            char* end = NULL;
+            value.number = strtod(start, &end);
+            if (end == start)
+                return false;
+            value.type = Number;
+            position += end - start;
+            return true;
+        }
+    }
+};
+
+class OptimizationProfilerTest : public ::testing::Test {
+public:
+    virtual void SetUp() { remove(PROFILE_FILE_NAME); }
+
+    virtual void TearDown() { remove(PROFILE_FILE_NAME); }
+};
+
+TEST_F(OptimizationProfilerTest, WritesJsonLines)
+{
+    static char options[]
+        = "-Xjit:acceptHugeMethods,useILValidator,profileOptimizations,optProfileFile=" PROFILE_FILE_NAME;
+    ASSERT_TRUE(initializeJitWithOptions(options)) << "Failed to initialize the JIT.";
+
+    const int32_t numCompilations = 2;
+    for (int32_t c = 0; c < numCompilations; c++) {
+        OMR::JitBuilder::TypeDictionary types;
+        SumBuilder builder(&types);
+        void* entry = NULL;
+        int32_t rc = compileMethodBuilder(&builder, &entry);
+        ASSERT_EQ(0, rc) << "Failed to compile method " << c;
+        EXPECT_EQ(2 * (0 + 1 + 2 + 3 + 4), ((SumFunctionType)entry)(5));
+    }
+    shutdownJit();
+
+    FILE* file = fopen(PROFILE_FILE_NAME, "r");
+    ASSERT_NE((FILE*)NULL, file) << "The profile was not written to " PROFILE_FILE_NAME;
+    std::vector<std::string> lines;
+    std::string line;
+    for (int c = fgetc(file); c != EOF; c = fgetc(file)) {
+        if (c == '\n') {
+            lines.push_back(line);
+            line.clear();
+        } else {
+            line += (char)c;
+        }
+    }
+    fclose(file);
+    ASSERT_TRUE(line.empty()) << "The last line is not terminated: " << line;
+
+    // One line per compilation, then the totals
+    ASSERT_EQ((size_t)numCompilations + 1, lines.size());
+    int32_t passes = 0;
+    for (int32_t c = 0; c < numCompilations; c++) {
+        JsonValue compilation;
+        ASSERT_TRUE(JsonValue::parse(lines[c], compilation)) << "Not JSON: " << lines[c];
+        ASSERT_EQ(JsonValue::Object, compilation.type);
+        ASSERT_EQ(JsonValue::String, compilation["method"].type);
+        ASSERT_EQ(JsonValue::String, compilation["hotness"].type);
+        const JsonValue& optimizations = compilation["optimizations"];
+        ASSERT_EQ(JsonValue::Array, optimizations.type);
+        ASSERT_FALSE(optimizations.elements.empty()) << "No optimization passes were recorded";
+        for (size_t i = 0; i < optimizations.elements.size(); i++) {
+            const JsonValue& optimization = optimizations.elements[i];
+            ASSERT_EQ(JsonValue::String, optimization["name"].type);
+            ASSERT_FALSE(optimization["name"].string.empty());
+            ASSERT_EQ(JsonValue::Number, optimization["index"].type);
+            ASSERT_EQ(JsonValue::Number, optimization["micros"].type);
+            ASSERT_GE(optimization["micros"].number, 0);
+            // JitBuilder compiles with a segment provider that measures the scratch memory
+            ASSERT_EQ(JsonValue::Number, optimization["scratchBytes"].type);
+            ASSERT_GE(optimization["scratchBytes"].number, 0);
+            ASSERT_EQ(JsonValue::Number, optimization["nodes"].type);
+        }
+        passes += (int32_t)optimizations.elements.size();
+    }
+
+    JsonValue totals;
+    ASSERT_TRUE(JsonValue::parse(lines[numCompilations], totals)) << "Not JSON: " << lines[numCompilations];
+    ASSERT_EQ(JsonValue::Array, totals["totals"].type);
+    int32_t totalPasses = 0;
+    double previousMicros = -1;
+    for (size_t i = 0; i < totals["totals"].elements.size(); i++) {
+        const JsonValue& total = totals["totals"].elements[i];
+        ASSERT_EQ(JsonValue::String, total["name"].type);
+        ASSERT_EQ(JsonValue::Number, total["passes"].type);
+        ASSERT_EQ(JsonValue::Number, total["micros"].type);
+        ASSERT_EQ(JsonValue::Number, total["maxScratchBytes"].type);
+        ASSERT_EQ(JsonValue::Number, total["nodes"].type);
+        if (previousMicros >= 0)
+            ASSERT_LE(total["micros"].number, previousMicros) << "The totals are not slowest first";
+        previousMicros = total["micros"].number;
+        totalPasses += (int32_t)total["passes"].number;
+    }
+    ASSERT_EQ(passes, totalPasses) << "The totals do not count every pass";
+}
@@ -46,6 +46,11 @@ public:
 	 */
 	MMINLINE_DEBUG static void nop() { VM_AtomicSupport::nop(); }
 
+	/**
+	 * Hint to the processor that the cache line containing address will be read soon.
+	 */
+	MMINLINE_DEBUG static void prefetch(const void* address) { VM_AtomicSupport::prefetch(address); }
+
 	/**
 	 * @Deprecated use the readWriteBarrier
 	 */
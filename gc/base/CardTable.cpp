@@ -54,6 +54,25 @@ MM_CardTable::initialize(MM_EnvironmentBase* env, MM_Heap* heap)
 		_cardTableVirtualStart =
 		        (Card*)((uintptr_t)_cardTableStart - (((uintptr_t)getHeapBase()) >> CARD_SIZE_SHIFT));
 		initialized = true;
+
+		if (extensions->cardTableSummary) {
+			/* one bit per cache line of cards, then one bit per slot of those bits */
+			uintptr_t summaryBitCount = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, cardTableSizeRequired)
+			                            >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+			uintptr_t summarySlotCount =
+			        MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, summaryBitCount) / J9BITS_BITS_IN_SLOT;
+			uintptr_t summarySlotBitsSlotCount =
+			        MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, summarySlotCount) / J9BITS_BITS_IN_SLOT;
+			uintptr_t allocationSize = (summarySlotCount + summarySlotBitsSlotCount) * sizeof(uintptr_t);
+			_summaryBits = (volatile uintptr_t*)env->getForge()->allocate(
+			        allocationSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _summaryBits) {
+				initialized = false;
+			} else {
+				memset((void*)_summaryBits, 0, allocationSize);
+				_summarySlotBits = _summaryBits + summarySlotCount;
+			}
+		}
 	}
 
 	return initialized;
@@ -71,6 +90,12 @@ MM_CardTable::tearDown(MM_EnvironmentBase* env)
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryBits) {
+		env->getForge()->free((void*)_summaryBits);
+		_summaryBits = NULL;
+		_summarySlotBits = NULL;
+	}
 }
 
 uintptr_t
@@ -267,6 +292,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase* env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			summarizeCard(card);
 		}
 	}
 }
@@ -281,6 +307,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase* env, void* heapAddrFrom, void*
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			summarizeCard(card);
 		}
 	}
 }
@@ -313,9 +340,10 @@ MM_CardTable::cardAddrToHeapAddr(MM_EnvironmentBase* env, Card* cardAddr)
 MMINLINE void
 MM_CardTable::cleanRange(MM_EnvironmentBase* env, MM_CardCleaner* cardCleaner, Card* low, Card* high)
 {
-	Card* thisCard = low;
+	Card* thisCard = skipCleanCards(low, high);
 	Card* endCard = high;
 	uintptr_t cardsCleaned = 0;
+	uintptr_t cardsSkipped = thisCard - low;
 	while (thisCard < endCard) {
 		if (CARD_CLEAN != *thisCard) {
 			void* lowAddress = (void*)cardAddrToHeapAddr(env, thisCard);
@@ -325,8 +353,14 @@ MM_CardTable::cleanRange(MM_EnvironmentBase* env, MM_CardCleaner* cardCleaner, C
 			cardsCleaned += 1;
 		}
 		thisCard += 1;
+		if (isSummaryBoundary(thisCard)) {
+			Card* nextCard = skipCleanCards(thisCard, endCard);
+			cardsSkipped += nextCard - thisCard;
+			thisCard = nextCard;
+		}
 	}
 	env->_cardCleaningStats._cardsCleaned += cardsCleaned;
+	env->_cardCleaningStats._cardsSkipped += cardsSkipped;
 }
 
 void
@@ -393,6 +427,8 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase* env, void* heapBase, void* h
 	Card* lastCard = heapAddrToCardAddr(env, heapTop);
 	uintptr_t sizeToClear = (uint8_t*)lastCard - (uint8_t*)firstCard;
 
+	clearSummaryForRange(env, firstCard, lastCard);
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
@@ -401,6 +437,39 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase* env, void* heapBase, void* h
 	return sizeToClear;
 }
 
+void
+MM_CardTable::clearSummaryForRange(MM_EnvironmentBase* env, Card* lowCard, Card* highCard)
+{
+	if (NULL == _summaryBits) {
+		return;
+	}
+
+	/* only summary bits whose cards all lie within the range may be cleared */
+	uintptr_t lowBit = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(lowCard - _cardTableStart))
+	                   >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+	uintptr_t highBit = (uintptr_t)(highCard - _cardTableStart) >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+	uintptr_t bitIndex = lowBit;
+
+	while (bitIndex < highBit) {
+		uintptr_t slotIndex = bitIndex / J9BITS_BITS_IN_SLOT;
+		uintptr_t firstBit = bitIndex % J9BITS_BITS_IN_SLOT;
+		uintptr_t bitCount = OMR_MIN(J9BITS_BITS_IN_SLOT - firstBit, highBit - bitIndex);
+		if (J9BITS_BITS_IN_SLOT == bitCount) {
+			/* the whole slot covers the range - the slot bit may go as well */
+			MM_AtomicOperations::set(&_summaryBits[slotIndex], 0);
+			clearSummaryBits(&_summarySlotBits[slotIndex / J9BITS_BITS_IN_SLOT],
+			                 (uintptr_t)1 << (slotIndex % J9BITS_BITS_IN_SLOT));
+		} else {
+			uintptr_t mask = (((uintptr_t)1 << bitCount) - 1) << firstBit;
+			clearSummaryBits(&_summaryBits[slotIndex], mask);
+		}
+		bitIndex += bitCount;
+	}
+
+	/* the summary must be clear before the cards are, otherwise a racing dirty could lose its summary bit */
+	MM_AtomicOperations::sync();
+}
+
 void
 MM_CardTable::kill(MM_EnvironmentBase* env)
 {
@@ -28,7 +28,10 @@
 #if !defined(CARDTABLE_HPP_)
 #define CARDTABLE_HPP_
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
+#include "Bits.hpp"
+#include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "modronbase.h"
 #include "omrcfg.h"
@@ -39,6 +42,18 @@ class MM_CardCleaner;
 class MM_Heap;
 class MM_HeapRegionDescriptor;
 
+/**
+ * @ingroup GC_Base
+ * @name Card table summary constants
+ * @{
+ */
+/* base2 log of the number of cards (one cache line worth) tracked by a single summary bit */
+#define CARD_SUMMARY_CARDS_PER_BIT_SHIFT 6
+#define CARD_SUMMARY_CARDS_PER_BIT ((uintptr_t)1 << CARD_SUMMARY_CARDS_PER_BIT_SHIFT)
+/**
+ * @}
+ */
+
 /**
  * @todo Provide typedef documentation
  * @ingroup GC_Base
@@ -61,6 +76,8 @@ private:
 	Card* _cardTableStart;
 	Card* _cardTableVirtualStart;
 	void* _heapBase;
+	volatile uintptr_t* _summaryBits; /**< One bit per CARD_SUMMARY_CARDS_PER_BIT cards, set if any of them may not be clean (NULL if the summary is disabled) */
+	volatile uintptr_t* _summarySlotBits; /**< One bit per slot of _summaryBits, set if the slot may be non-zero */
 
 public:
 	/**
@@ -81,6 +98,72 @@ public:
 	 */
 	void* getHeapBase() { return _heapBase; };
 
+	/**
+	 * Record in the summary that the given card may no longer be clean. Must be called after the card is
+	 * written by anything dirtying cards directly (rather than through dirtyCard()) when the summary is enabled.
+	 * @param[in] card The card which was written
+	 */
+	MMINLINE void summarizeCard(Card* card)
+	{
+		if (NULL != _summaryBits) {
+			uintptr_t bitIndex = (uintptr_t)(card - _cardTableStart) >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+			uintptr_t slotIndex = bitIndex / J9BITS_BITS_IN_SLOT;
+			/* set the summary bit before the slot bit, so a scan which sees the slot bit finds the summary bit */
+			setSummaryBit(&_summaryBits[slotIndex], bitIndex % J9BITS_BITS_IN_SLOT);
+			setSummaryBit(&_summarySlotBits[slotIndex / J9BITS_BITS_IN_SLOT], slotIndex % J9BITS_BITS_IN_SLOT);
+		}
+	}
+
+	/**
+	 * Skip all leading cards of a range which the summary knows to be clean.
+	 * @param[in] card The first card of the range
+	 * @param[in] endCard The card following the last card of the range
+	 * @return The first card in the range which may not be clean (card itself if the summary is disabled),
+	 * or endCard if all cards are clean
+	 */
+	MMINLINE Card* skipCleanCards(Card* card, Card* endCard)
+	{
+		if ((NULL == _summaryBits) || (card >= endCard)) {
+			return card;
+		}
+
+		uintptr_t bitIndex = (uintptr_t)(card - _cardTableStart) >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+		uintptr_t endCardIndex = (uintptr_t)(endCard - _cardTableStart);
+		uintptr_t endBitIndex =
+		        MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, endCardIndex) >> CARD_SUMMARY_CARDS_PER_BIT_SHIFT;
+		while (bitIndex < endBitIndex) {
+			uintptr_t slotIndex = bitIndex / J9BITS_BITS_IN_SLOT;
+			uintptr_t slotBits = _summarySlotBits[slotIndex / J9BITS_BITS_IN_SLOT];
+			if (0 == slotBits) {
+				/* no summary bit is set for a whole slot of slots */
+				bitIndex = MM_Math::roundToFloor(J9BITS_BITS_IN_SLOT * J9BITS_BITS_IN_SLOT, bitIndex)
+				           + (J9BITS_BITS_IN_SLOT * J9BITS_BITS_IN_SLOT);
+			} else if (0 == (slotBits & ((uintptr_t)1 << (slotIndex % J9BITS_BITS_IN_SLOT)))) {
+				bitIndex = (slotIndex + 1) * J9BITS_BITS_IN_SLOT;
+			} else {
+				uintptr_t summaryBits = _summaryBits[slotIndex] >> (bitIndex % J9BITS_BITS_IN_SLOT);
+				if (0 != summaryBits) {
+					bitIndex += MM_Bits::leadingZeroes(summaryBits);
+					break;
+				}
+				bitIndex = (slotIndex + 1) * J9BITS_BITS_IN_SLOT;
+			}
+		}
+
+		if (bitIndex >= endBitIndex) {
+			return endCard;
+		}
+		return OMR_MAX(card, _cardTableStart + (bitIndex << CARD_SUMMARY_CARDS_PER_BIT_SHIFT));
+	}
+
+	/**
+	 * @return true if the given card is the first card tracked by a summary bit and the summary is enabled
+	 */
+	MMINLINE bool isSummaryBoundary(Card* card)
+	{
+		return (NULL != _summaryBits) && (0 == ((uintptr_t)(card - _cardTableStart) % CARD_SUMMARY_CARDS_PER_BIT));
+	}
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -265,6 +348,13 @@ protected:
 	                             Card* lowValidCard,
 	                             Card* highValidCard);
 
+	/**
+	 * Clear the summary bits of all cards in the range [lowCard, highCard). Summary bits shared with
+	 * cards outside the range are left set. Must be called before the cards themselves are cleared,
+	 * so a card dirtied concurrently is never left without its summary bit.
+	 */
+	void clearSummaryForRange(MM_EnvironmentBase* env, Card* lowCard, Card* highCard);
+
 	/**
 	 * Create a CardTable object.
 	 */
@@ -274,13 +364,46 @@ protected:
 	          _cardTableMemoryHandle(),
 	          _cardTableStart(NULL),
 	          _cardTableVirtualStart(NULL),
-	          _heapBase(NULL)
+	          _heapBase(NULL),
+	          _summaryBits(NULL),
+	          _summarySlotBits(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
 
 private:
 	void cleanRange(MM_EnvironmentBase* env, MM_CardCleaner* cardCleaner, Card* low, Card* high);
+
+	/**
+	 * Atomically set a bit in a summary slot, unless it is already set.
+	 */
+	MMINLINE void setSummaryBit(volatile uintptr_t* slot, uintptr_t bit)
+	{
+		uintptr_t mask = (uintptr_t)1 << bit;
+		uintptr_t oldValue = *slot;
+		while (0 == (oldValue & mask)) {
+			uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue | mask);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+	}
+
+	/**
+	 * Atomically clear the bits of a mask in a summary slot.
+	 */
+	MMINLINE void clearSummaryBits(volatile uintptr_t* slot, uintptr_t mask)
+	{
+		uintptr_t oldValue = *slot;
+		while (0 != (oldValue & mask)) {
+			uintptr_t value = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue & ~mask);
+			if (value == oldValue) {
+				break;
+			}
+			oldValue = value;
+		}
+	}
 };
 
 #endif /* CARDTABLE_HPP_ */
@@ -220,6 +220,9 @@ MM_Collector::preCollect(MM_EnvironmentBase* env,
 	/* Record the master GC thread CPU time at the start to diff later */
 	_masterThreadCpuTimeStart = omrthread_get_self_cpu_time(env->getOmrVMThread()->_os_thread);
 
+	/* Dispatcher statistics are reported per cycle */
+	extensions->dispatcherStats.clear();
+
 	/* Set up frequent object stats */
 	if (extensions->doFrequentObjectAllocationSampling) {
 		if (NULL == extensions->frequentObjectsStats) {
@@ -502,6 +505,9 @@ MM_Collector::garbageCollect(MM_EnvironmentBase* env,
 
 	env->popVMstate(vmState);
 
+	/* memory committed by expansions during the collection is pre-touched now that the GC threads are free */
+	env->getExtensions()->heap->pretouchDeferredMemory(env);
+
 	/* now, see if we need to resume an allocation or replenishment attempt */
 	void* postCollectAllocationResult = NULL;
 	if (NULL != allocateDescription) {
@@ -26,6 +26,7 @@
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
 #include "BaseVirtual.hpp"
+#include "DispatcherStats.hpp"
 #include "ExcessiveGCStats.hpp"
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
@@ -107,6 +108,9 @@ class HeapRegionStateTable;
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
+/* The maximum number of slots the scavenger will batch up and prefetch before copying. */
+#define MAXIMUM_SCAVENGER_SLOT_PREFETCH_DEPTH 16
+
 #define NO_ESTIMATE_FRAGMENTATION 0x0
 #define LOCALGC_ESTIMATE_FRAGMENTATION 0x1
 #define GLOBALGC_ESTIMATE_FRAGMENTATION 0x2
@@ -236,6 +240,7 @@ public:
 
 	J9Pool* environments;
 	MM_ExcessiveGCStats excessiveGCStats;
+	MM_DispatcherStats dispatcherStats; /**< statistics on the tasks dispatched within the current cycle */
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	MM_GlobalGCStats globalGCStats;
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
@@ -337,6 +342,13 @@ public:
 	        tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t
 	        tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true each TLH refresh is sized from the owning thread's observed allocation rate */
+	uintptr_t
+	        tlhAdaptiveRefreshInterval; /**< with tlhAdaptiveSizing, the target time in microseconds between refreshes of a thread's TLH */
+	uintptr_t
+	        tlhAllocationCacheCount; /**< number of TLH allocation caches per address ordered list memory pool, zero (default) refreshes every TLH under the pool lock */
+	uintptr_t
+	        tlhAllocationCacheRefillCount; /**< number of TLHs carved from the free list each time a TLH allocation cache is refilled */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -392,6 +404,7 @@ public:
 	        workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t
 	        packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMarking; /**< if true, parallel mark threads exchange output packets through per-thread work stealing deques before falling back to the shared packet lists */
 	uintptr_t
 	        cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
 
@@ -463,6 +476,9 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreadCount; /**< if true, tasks which can estimate their work run with no more threads than the work can keep busy */
+	uintptr_t markPacketsPerThread; /**< number of non empty mark work packets which keep one more thread busy when the thread count is adaptive */
+	uintptr_t synchronizeGCThreadsSpinMicros; /**< time GC threads spin at a synchronization point before parking, 0 to park at once */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering{
@@ -482,6 +498,8 @@ public:
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
+	bool scavengerRememberedSetDeduplication; /**< if true, each GC thread filters duplicate remembered set entries out before scanning them */
+	uintptr_t scavengerWorkPerThread; /**< estimated bytes to copy which keep one more thread busy in a scavenge when the thread count is adaptive */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -504,6 +522,8 @@ public:
 	        scavengerScanCacheMaximumSize; /**< maximum size of scan and copy caches before rounding, zero (default) means calculate them */
 	uintptr_t
 	        scavengerScanCacheMinimumSize; /**< minimum size of scan and copy caches before rounding, zero (default) means calculate them */
+	uintptr_t
+	        scavengerSlotPrefetchDepth; /**< number of slots batched and prefetched ahead of copy-forward while scanning an object, zero or one (default) disables batching */
 	bool tiltedScavenge;
 	bool debugTiltedScavenge;
 	double survivorSpaceMinimumSizeRatio;
@@ -525,6 +545,12 @@ public:
 	double dnssMaximumContraction;
 	double dnssMinimumExpansion;
 	double dnssMinimumContraction;
+	uintptr_t
+	        scavengerPauseTargetMillis; /**< target maximum scavenge pause in milliseconds used to size the nursery instead of the GC time ratio heuristics, 0 (default) disables the pause target */
+	double
+	        scavengerPauseTargetOverhead; /**< target fraction of time spent in scavenges when the nursery is sized for a pause target */
+	uintptr_t
+	        scavengerPauseTargetTenureScavenges; /**< number of average promotions tenure space keeps free when the nursery is sized for a pause target */
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
 
@@ -597,6 +623,7 @@ public:
 	MM_Dispatcher* dispatcher;
 
 	MM_CardTable* cardTable;
+	bool cardTableSummary; /**< if true, the card table keeps a summary bitmap of possibly dirty cards which card cleaning uses to skip clean spans. Any write barrier which dirties cards directly must then also call MM_CardTable::summarizeCard() */
 
 	/* Begin command line options temporary home */
 	uintptr_t memoryMax;
@@ -690,6 +717,10 @@ public:
 	uintptr_t allocationCacheMaximumSize;
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
+	uintptr_t
+	        allocationCacheMagazineSize; /**< Bytes of cells per magazine exchanged through the segregated magazine depot, 0 disables magazines */
+	uintptr_t
+	        allocationCacheMagazineBatch; /**< Number of magazines carved from a region on each cache refill when magazines are enabled */
 	bool nonDeterministicSweep;
 	/* OMR_GC_REALTIME (in for all) */
 
@@ -703,6 +734,9 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Write logs (e.g. verbose:gc) to a file from a background thread */
+	uintptr_t asyncLoggingBufferSize; /**< size of the ring buffer holding log output not yet written by the background thread */
+	bool verboseBinaryFormat; /**< Enabled by -Xgc:verboseBinaryFormat.  Write verbose:gc log files in the binary format read by vgcdecode */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -746,6 +780,9 @@ public:
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
 
 	bool padToPageSize;
+	bool heapPretouch; /**< if true, committed heap memory is faulted in by the GC threads at startup and after each expansion */
+	uintptr_t parallelHeapWalkUnitSize; /**< size of the units a parallel heap walk splits the heap into */
+	uintptr_t parallelHeapWalkUnitObjects; /**< number of marked objects a parallel heap walk unit is merged with its neighbours to hold, 0 for fixed size units */
 
 	bool fvtest_disableExplictMasterThread; /**< Test option to disable creation of explicit master GC thread */
 
@@ -1405,7 +1442,8 @@ public:
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	          ,
 	          environments(NULL),
-	          excessiveGCStats()
+	          excessiveGCStats(),
+	          dispatcherStats()
 #if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
 	          ,
 	          globalGCStats()
@@ -1492,6 +1530,10 @@ public:
 	          tlhIncrementSize(4096),
 	          tlhSurvivorDiscardThreshold(tlhMinimumSize),
 	          tlhTenureDiscardThreshold(tlhMinimumSize),
+	          tlhAdaptiveSizing(false),
+	          tlhAdaptiveRefreshInterval(100),
+	          tlhAllocationCacheCount(0),
+	          tlhAllocationCacheRefillCount(4),
 	          allocationStats(),
 	          bytesAllocatedMost(0),
 	          vmThreadAllocatedMost(NULL),
@@ -1538,6 +1580,7 @@ public:
 	          workpacketCount(0) /* only set if -Xgcworkpackets specified */
 	          ,
 	          packetListSplit(0),
+	          workStealingMarking(false),
 	          cacheListSplit(0),
 	          markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE),
 	          markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE),
@@ -1593,7 +1636,10 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 	          ,
 	          gcThreadCount(0),
-	          gcThreadCountForced(false)
+	          gcThreadCountForced(false),
+	          adaptiveGCThreadCount(false),
+	          markPacketsPerThread(4),
+	          synchronizeGCThreadsSpinMicros(50)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	          ,
 	          scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
@@ -1610,7 +1656,9 @@ public:
 	          scvTenureStrategyLookback(true),
 	          scvTenureStrategyHistory(true),
 	          scavengerEnabled(false),
-	          scavengerRsoScanUnsafe(false)
+	          scavengerRsoScanUnsafe(false),
+	          scavengerRememberedSetDeduplication(false),
+	          scavengerWorkPerThread(256 * 1024)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	          ,
 	          softwareRangeCheckReadBarrier(false),
@@ -1629,6 +1677,7 @@ public:
 	          scvArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE),
 	          scavengerScanCacheMaximumSize(DEFAULT_SCAN_CACHE_MAXIMUM_SIZE),
 	          scavengerScanCacheMinimumSize(DEFAULT_SCAN_CACHE_MINIMUM_SIZE),
+	          scavengerSlotPrefetchDepth(0),
 	          tiltedScavenge(true),
 	          debugTiltedScavenge(false),
 	          survivorSpaceMinimumSizeRatio(0.10),
@@ -1649,6 +1698,9 @@ public:
 	          dnssMaximumContraction(0.5),
 	          dnssMinimumExpansion(0.0),
 	          dnssMinimumContraction(0.0),
+	          scavengerPauseTargetMillis(0),
+	          scavengerPauseTargetOverhead(0.05),
+	          scavengerPauseTargetTenureScavenges(4),
 	          enableSplitHeap(false),
 	          aliasInhibitingThresholdPercentage(0.20),
 	          splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
@@ -1707,6 +1759,7 @@ public:
 	          fvtest_forceCardTableDecommitFailureCounter(0),
 	          dispatcher(NULL),
 	          cardTable(NULL),
+	          cardTableSummary(false),
 	          memoryMax(0),
 	          initialMemorySize(0),
 	          minNewSpaceSize(0),
@@ -1792,6 +1845,8 @@ public:
 	          allocationCacheMaximumSize(16384),
 	          allocationCacheInitialSize(256),
 	          allocationCacheIncrementSize(256),
+	          allocationCacheMagazineSize(0),
+	          allocationCacheMagazineBatch(4),
 	          nonDeterministicSweep(false),
 	          configuration(NULL),
 	          verboseGCManager(NULL),
@@ -1800,6 +1855,9 @@ public:
 	          verboseExtensions(false),
 	          verboseNewFormat(true),
 	          bufferedLogging(false),
+	          asyncLogging(false),
+	          asyncLoggingBufferSize(1024 * 1024),
+	          verboseBinaryFormat(false),
 	          lowAllocationThreshold(UDATA_MAX),
 	          highAllocationThreshold(UDATA_MAX),
 	          disableInlineCacheForAllocationThreshold(false),
@@ -1828,6 +1886,9 @@ public:
 	          _numaManager(),
 	          numaForced(false),
 	          padToPageSize(false),
+	          heapPretouch(false),
+	          parallelHeapWalkUnitSize(256 * 1024),
+	          parallelHeapWalkUnitObjects(2048),
 	          fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
 	          ,
@@ -132,6 +132,21 @@ public:
 	virtual bool commitMemory(void* address, uintptr_t size) = 0;
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress) = 0;
 
+	/**
+	 * Fault in the pages of committed heap memory ahead of use, if enabled by the heapPretouch option.
+	 * @param env[in] the thread requesting the pre-touch
+	 * @param type[in] whether the range is the initial heap or a newly expanded range
+	 * @param lowAddress[in] base of the committed range to touch, or NULL to touch all committed memory
+	 * @param highAddress[in] top of the committed range to touch
+	 */
+	virtual void pretouchMemory(MM_EnvironmentBase* env, HeapPretouchType type, void* lowAddress, void* highAddress) {}
+
+	/**
+	 * Fault in the memory committed by expansions which happened while the GC threads were busy with a task.
+	 * @param env[in] the master thread, after the task has completed
+	 */
+	virtual void pretouchDeferredMemory(MM_EnvironmentBase* env) {}
+
 	void mergeHeapStats(MM_HeapStats* heapStats, uintptr_t includeMemoryType);
 	void mergeHeapStats(MM_HeapStats* heapStats);
 	void resetHeapStatistics(bool globalCollect);
@@ -26,6 +26,7 @@
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapWordOperations.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
@@ -54,6 +55,8 @@ MM_HeapMap::initialize(MM_EnvironmentBase* env)
 	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
+	MM_HeapMapWordOperations::initialize();
+
 	uintptr_t heapMapSizeRequired = getMaximumHeapMapSize(env);
 
 	MM_MemoryManager* memoryManager = _extensions->memoryManager;
@@ -277,7 +280,7 @@ MM_HeapMap::setBitsInRange(MM_EnvironmentBase* env, void* lowAddress, void* high
 	bytesToSet = (topIndex - baseIndex) * sizeof(uintptr_t);
 
 	if (clear) {
-		OMRZeroMemory((void*)&(_heapMapBits[baseIndex]), bytesToSet);
+		MM_HeapMapWordOperations::clearWords(&(_heapMapBits[baseIndex]), topIndex - baseIndex);
 	} else {
 		memset(&(_heapMapBits[baseIndex]), 0xFF, bytesToSet);
 	}
@@ -295,7 +298,6 @@ bool
 MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region)
 {
 	uintptr_t baseIndex, topIndex;
-	uintptr_t bytesToCheck;
 
 	void* lowAddress = region->getLowAddress();
 	void* highAddress = region->getHighAddress();
@@ -317,14 +319,23 @@ MM_HeapMap::checkBitsForRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor*
 	topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress);
 	topIndex >>= _heapMapIndexShift;
 
-	bytesToCheck = (topIndex - baseIndex) * sizeof(uintptr_t);
+	uintptr_t wordsToCheck = topIndex - baseIndex;
+	return wordsToCheck == MM_HeapMapWordOperations::findNonZeroWord(&_heapMapBits[baseIndex], wordsToCheck);
+}
 
-	uint8_t* markMapBytes = (uint8_t*)(&_heapMapBits[baseIndex]);
-	for (uintptr_t i = 0; i < bytesToCheck; i++) {
-		if (0 != markMapBytes[i]) {
-			return false;
-		}
-	}
+uintptr_t
+MM_HeapMap::countBitsForRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region)
+{
+	void* lowAddress = region->getLowAddress();
+	void* highAddress = region->getHighAddress();
+
+	/* Validate passed heap references */
+	Assert_MM_true(lowAddress < _heapTop);
+	Assert_MM_true(lowAddress >= _heapBase);
+	Assert_MM_true(highAddress <= _heapTop);
+
+	uintptr_t baseIndex = _extensions->heap->calculateOffsetFromHeapBase(lowAddress) >> _heapMapIndexShift;
+	uintptr_t topIndex = _extensions->heap->calculateOffsetFromHeapBase(highAddress) >> _heapMapIndexShift;
 
-	return true;
+	return MM_HeapMapWordOperations::populationCount(&_heapMapBits[baseIndex], topIndex - baseIndex);
 }
@@ -274,6 +274,14 @@ public:
 	 */
 	bool checkBitsForRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region);
 
+	/**
+	 * Count the bits set in the heap map of a region (eg. the number of marked objects in the mark map).
+	 * @param env[in] GC thread
+	 * @param region for which bits should be counted
+	 * @return number of bits set
+	 */
+	uintptr_t countBitsForRegion(MM_EnvironmentBase* env, MM_HeapRegionDescriptor* region);
+
 	/**
 	 * Create a HeapMap object.
 	 */
@@ -24,6 +24,7 @@
 #include "Bits.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapMap.hpp"
+#include "HeapMapWordOperations.hpp"
 #include "Math.hpp"
 #include "ObjectModel.hpp"
 
@@ -135,6 +136,20 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if (_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Skip the rest of a run of empty map slots in bulk rather than one slot per iteration */
+				uintptr_t heapSlotsRemaining = (uintptr_t)(_heapChunkTop - _heapSlotCurrent);
+				uintptr_t heapMapSlotsRemaining =
+				        MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, heapSlotsRemaining)
+				        / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+				uintptr_t emptySlots =
+				        MM_HeapMapWordOperations::findNonZeroWord(_heapMapSlotCurrent, heapMapSlotsRemaining);
+				_heapMapSlotCurrent += emptySlots;
+				_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * emptySlots;
+				if (_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -0,0 +1,237 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapMapWordOperations.hpp"
+
+#include "omrutil.h"
+
+#include "Bits.hpp"
+
+#if defined(OMR_ARCH_X86) && defined(OMR_ENV_DATA64) && defined(__GNUC__)
+#define J9MODRON_HMWO_X86_VECTOR
+#include <immintrin.h>
+#endif /* OMR_ARCH_X86 && OMR_ENV_DATA64 && __GNUC__ */
+
+/**
+ * Clears of at least this many bytes use non-temporal stores, since the mark map will not be read again until
+ * marking starts and there is no point in displacing the rest of the cache with it.
+ */
+#define J9MODRON_HMWO_STREAMING_CLEAR_BYTES ((uintptr_t)256 * 1024)
+
+MM_HeapMapWordOperations::Implementation MM_HeapMapWordOperations::_implementation =
+        MM_HeapMapWordOperations::implementation_scalar;
+void (*MM_HeapMapWordOperations::_clearWords)(uintptr_t* words, uintptr_t count) =
+        MM_HeapMapWordOperations::clearWordsScalar;
+uintptr_t (*MM_HeapMapWordOperations::_findNonZeroWord)(const uintptr_t* words, uintptr_t count) =
+        MM_HeapMapWordOperations::findNonZeroWordScalar;
+uintptr_t (*MM_HeapMapWordOperations::_populationCount)(const uintptr_t* words, uintptr_t count) =
+        MM_HeapMapWordOperations::populationCountScalar;
+
+void
+MM_HeapMapWordOperations::clearWordsScalar(uintptr_t* words, uintptr_t count)
+{
+	OMRZeroMemory((void*)words, count * sizeof(uintptr_t));
+}
+
+uintptr_t
+MM_HeapMapWordOperations::findNonZeroWordScalar(const uintptr_t* words, uintptr_t count)
+{
+	for (uintptr_t index = 0; index < count; index++) {
+		if (0 != words[index]) {
+			return index;
+		}
+	}
+	return count;
+}
+
+uintptr_t
+MM_HeapMapWordOperations::populationCountScalar(const uintptr_t* words, uintptr_t count)
+{
+	uintptr_t bitCount = 0;
+	for (uintptr_t index = 0; index < count; index++) {
+		bitCount += MM_Bits::populationCount(words[index]);
+	}
+	return bitCount;
+}
+
+#if defined(J9MODRON_HMWO_X86_VECTOR)
+/**
+ * Index of the first word at or after start which is aligned to alignment bytes, clamped to count.
+ */
+static MMINLINE uintptr_t
+alignedWordIndex(const uintptr_t* words, uintptr_t start, uintptr_t count, uintptr_t alignment)
+{
+	uintptr_t index = start;
+	while ((index < count) && (0 != ((uintptr_t)(words + index) & (alignment - 1)))) {
+		index += 1;
+	}
+	return index;
+}
+
+__attribute__((target("popcnt"))) static uintptr_t
+populationCountPOPCNT(const uintptr_t* words, uintptr_t count)
+{
+	uintptr_t bitCount = 0;
+	for (uintptr_t index = 0; index < count; index++) {
+		bitCount += (uintptr_t)__builtin_popcountll(words[index]);
+	}
+	return bitCount;
+}
+
+__attribute__((target("avx2"))) static void
+clearWordsAVX2(uintptr_t* words, uintptr_t count)
+{
+	if ((count * sizeof(uintptr_t)) < J9MODRON_HMWO_STREAMING_CLEAR_BYTES) {
+		MM_HeapMapWordOperations::clearWordsScalar(words, count);
+		return;
+	}
+
+	uintptr_t index = alignedWordIndex(words, 0, count, sizeof(__m256i));
+	MM_HeapMapWordOperations::clearWordsScalar(words, index);
+
+	__m256i zero = _mm256_setzero_si256();
+	for (; (index + 4) <= count; index += 4) {
+		_mm256_stream_si256((__m256i*)(words + index), zero);
+	}
+	/* order the non-temporal stores before any subsequent store (eg. the task completion handshake) */
+	_mm_sfence();
+
+	MM_HeapMapWordOperations::clearWordsScalar(words + index, count - index);
+}
+
+__attribute__((target("avx2"))) static uintptr_t
+findNonZeroWordAVX2(const uintptr_t* words, uintptr_t count)
+{
+	uintptr_t index = alignedWordIndex(words, 0, count, sizeof(__m256i));
+	uintptr_t found = MM_HeapMapWordOperations::findNonZeroWordScalar(words, index);
+	if (found < index) {
+		return found;
+	}
+
+	/* two vectors per iteration; the scalar tail pins down the word once a non-zero vector is seen */
+	for (; (index + 8) <= count; index += 8) {
+		__m256i low = _mm256_load_si256((const __m256i*)(words + index));
+		__m256i high = _mm256_load_si256((const __m256i*)(words + index + 4));
+		__m256i combined = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(combined, combined)) {
+			break;
+		}
+	}
+
+	return index + MM_HeapMapWordOperations::findNonZeroWordScalar(words + index, count - index);
+}
+
+__attribute__((target("avx512f"))) static void
+clearWordsAVX512(uintptr_t* words, uintptr_t count)
+{
+	if ((count * sizeof(uintptr_t)) < J9MODRON_HMWO_STREAMING_CLEAR_BYTES) {
+		MM_HeapMapWordOperations::clearWordsScalar(words, count);
+		return;
+	}
+
+	uintptr_t index = alignedWordIndex(words, 0, count, sizeof(__m512i));
+	MM_HeapMapWordOperations::clearWordsScalar(words, index);
+
+	__m512i zero = _mm512_setzero_si512();
+	for (; (index + 8) <= count; index += 8) {
+		_mm512_stream_si512((__m512i*)(words + index), zero);
+	}
+	_mm_sfence();
+
+	MM_HeapMapWordOperations::clearWordsScalar(words + index, count - index);
+}
+
+__attribute__((target("avx512f"))) static uintptr_t
+findNonZeroWordAVX512(const uintptr_t* words, uintptr_t count)
+{
+	uintptr_t index = alignedWordIndex(words, 0, count, sizeof(__m512i));
+	uintptr_t found = MM_HeapMapWordOperations::findNonZeroWordScalar(words, index);
+	if (found < index) {
+		return found;
+	}
+
+	for (; (index + 16) <= count; index += 16) {
+		__m512i low = _mm512_load_si512((const void*)(words + index));
+		__m512i high = _mm512_load_si512((const void*)(words + index + 8));
+		__m512i combined = _mm512_or_si512(low, high);
+		if (0 != _mm512_test_epi64_mask(combined, combined)) {
+			break;
+		}
+	}
+
+	return index + MM_HeapMapWordOperations::findNonZeroWordScalar(words + index, count - index);
+}
+
+__attribute__((target("avx512f,avx512vpopcntdq"))) static uintptr_t
+populationCountAVX512(const uintptr_t* words, uintptr_t count)
+{
+	uintptr_t index = alignedWordIndex(words, 0, count, sizeof(__m512i));
+	uintptr_t bitCount = populationCountPOPCNT(words, index);
+
+	__m512i counts = _mm512_setzero_si512();
+	for (; (index + 8) <= count; index += 8) {
+		__m512i value = _mm512_load_si512((const void*)(words + index));
+		counts = _mm512_add_epi64(counts, _mm512_popcnt_epi64(value));
+	}
+	bitCount += (uintptr_t)_mm512_reduce_add_epi64(counts);
+
+	return bitCount + populationCountPOPCNT(words + index, count - index);
+}
+#endif /* J9MODRON_HMWO_X86_VECTOR */
+
+void
+MM_HeapMapWordOperations::initialize()
+{
+#if defined(J9MODRON_HMWO_X86_VECTOR)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("popcnt")) {
+		_populationCount = populationCountPOPCNT;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		_implementation = implementation_avx2;
+		_clearWords = clearWordsAVX2;
+		_findNonZeroWord = findNonZeroWordAVX2;
+	}
+	if (__builtin_cpu_supports("avx512f")) {
+		_implementation = implementation_avx512;
+		_clearWords = clearWordsAVX512;
+		_findNonZeroWord = findNonZeroWordAVX512;
+		if (__builtin_cpu_supports("avx512vpopcntdq")) {
+			_populationCount = populationCountAVX512;
+		}
+	}
+#endif /* J9MODRON_HMWO_X86_VECTOR */
+}
+
+void
+MM_HeapMapWordOperations::forceScalar()
+{
+	_implementation = implementation_scalar;
+	_clearWords = clearWordsScalar;
+	_findNonZeroWord = findNonZeroWordScalar;
+	_populationCount = populationCountScalar;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPWORDOPERATIONS_HPP_)
+#define HEAPMAPWORDOPERATIONS_HPP_
+
+#include "modronbase.h"
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+/**
+ * Runs shorter than this many words are processed inline rather than through the selected implementation.
+ */
+#define J9MODRON_HMWO_INLINE_WORD_LIMIT 8
+
+/**
+ * Bulk operations over runs of heap map words (clearing, searching for the next set bit, population counting).
+ *
+ * A scalar implementation is always available. On x86-64 with a GNU compatible compiler, AVX2 and AVX-512
+ * implementations are compiled alongside it and initialize() selects the widest one the processor supports.
+ * Selection is process wide since it depends only on the processor.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapWordOperations
+{
+	/* Data members / types */
+public:
+	enum Implementation
+	{
+		implementation_scalar = 0,
+		implementation_avx2,
+		implementation_avx512
+	};
+
+protected:
+private:
+	static Implementation _implementation; /**< Widest implementation selected for this processor */
+	static void (*_clearWords)(uintptr_t* words, uintptr_t count);
+	static uintptr_t (*_findNonZeroWord)(const uintptr_t* words, uintptr_t count);
+	static uintptr_t (*_populationCount)(const uintptr_t* words, uintptr_t count);
+
+	/* Methods */
+public:
+	/**
+	 * Select the implementation for the current processor. Must be called before GC threads start using the
+	 * heap map; until then the scalar implementation is used.
+	 */
+	static void initialize();
+
+	/**
+	 * @return the widest implementation selected by initialize()
+	 */
+	static MMINLINE Implementation getImplementation() { return _implementation; }
+
+	/**
+	 * Force the scalar implementation, regardless of processor support.
+	 */
+	static void forceScalar();
+
+	/**
+	 * Set a run of heap map words to zero.
+	 * @param words the first word to clear
+	 * @param count the number of words to clear
+	 */
+	static MMINLINE void clearWords(uintptr_t* words, uintptr_t count) { (*_clearWords)(words, count); }
+
+	/**
+	 * Find the first non-zero word in a run of heap map words.
+	 * @param words the first word to examine
+	 * @param count the number of words to examine
+	 * @return the index of the first non-zero word, or count if all words are zero
+	 */
+	static MMINLINE uintptr_t findNonZeroWord(const uintptr_t* words, uintptr_t count)
+	{
+		if (count < J9MODRON_HMWO_INLINE_WORD_LIMIT) {
+			for (uintptr_t index = 0; index < count; index++) {
+				if (0 != words[index]) {
+					return index;
+				}
+			}
+			return count;
+		}
+		return (*_findNonZeroWord)(words, count);
+	}
+
+	/**
+	 * Count the bits set in a run of heap map words.
+	 * @param words the first word to count
+	 * @param count the number of words to count
+	 * @return the number of bits set
+	 */
+	static MMINLINE uintptr_t populationCount(const uintptr_t* words, uintptr_t count)
+	{
+		return (*_populationCount)(words, count);
+	}
+
+	static void clearWordsScalar(uintptr_t* words, uintptr_t count);
+	static uintptr_t findNonZeroWordScalar(const uintptr_t* words, uintptr_t count);
+	static uintptr_t populationCountScalar(const uintptr_t* words, uintptr_t count);
+};
+
+#endif /* HEAPMAPWORDOPERATIONS_HPP_ */
@@ -22,15 +22,20 @@
 
 #include "HeapVirtualMemory.hpp"
 
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
+#include "ParallelTask.hpp"
 #include "PhysicalArena.hpp"
+#include "omrmodroncore.h"
 #include "omrport.h"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -40,6 +45,94 @@
 #define HIGH_ADDRESS UDATA_MAX
 #define OVERFLOW_ROUNDING ((uintptr_t)16 * 1024)
 
+/**
+ * Fault in the pages of committed heap memory on all GC threads.
+ * Every thread touches an equal, page aligned slice of each range. A thread with NUMA node affinity first
+ * binds its slice to that node, so the heap ends up interleaved across the nodes the GC threads run on.
+ * @ingroup GC_Base_Core
+ */
+class MM_ParallelHeapPretouchTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapVirtualMemory* _heap;
+	void* _lowAddress; /**< Base of the range to touch, or NULL to touch every committed region */
+	void* _highAddress; /**< Top of the range to touch */
+	uintptr_t _pageSize; /**< Stride between touches */
+
+public:
+	volatile uintptr_t _touchedBytes; /**< Bytes touched by all threads */
+	volatile uintptr_t _boundBytes; /**< Bytes bound to the NUMA node of the touching thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PERFORM_RESIZE; };
+
+	virtual void run(MM_EnvironmentBase* env) { pretouch(env, env->getSlaveID(), getThreadCount()); }
+
+	/**
+	 * Touch this thread's share of every range.
+	 * @param sliceIndex[in] the index of the slice of each range to touch
+	 * @param sliceCount[in] the number of slices each range is divided into
+	 */
+	void pretouch(MM_EnvironmentBase* env, uintptr_t sliceIndex, uintptr_t sliceCount)
+	{
+		if (NULL != _lowAddress) {
+			pretouchSlice(env, (uintptr_t)_lowAddress, (uintptr_t)_highAddress, sliceIndex, sliceCount);
+		} else {
+			GC_HeapRegionIterator regionIterator(_heap->getHeapRegionManager());
+			MM_HeapRegionDescriptor* region = NULL;
+			while (NULL != (region = regionIterator.nextRegion())) {
+				pretouchSlice(env, (uintptr_t)region->getLowAddress(), (uintptr_t)region->getHighAddress(),
+				              sliceIndex, sliceCount);
+			}
+		}
+	}
+
+	MM_ParallelHeapPretouchTask(MM_EnvironmentBase* env, MM_HeapVirtualMemory* heap, void* lowAddress, void* highAddress)
+	        : MM_ParallelTask(env, env->getExtensions()->dispatcher),
+	          _heap(heap),
+	          _lowAddress(lowAddress),
+	          _highAddress(highAddress),
+	          _pageSize(heap->getPageSize()),
+	          _touchedBytes(0),
+	          _boundBytes(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+
+private:
+	void pretouchSlice(MM_EnvironmentBase* env, uintptr_t low, uintptr_t high, uintptr_t sliceIndex, uintptr_t sliceCount)
+	{
+		uintptr_t sliceSize = MM_Math::roundToCeiling(_pageSize, ((high - low) + sliceCount - 1) / sliceCount);
+		uintptr_t sliceLow = low + (sliceIndex * sliceSize);
+		if (sliceLow >= high) {
+			return;
+		}
+		uintptr_t sliceHigh = OMR_MIN(sliceLow + sliceSize, high);
+
+		MM_GCExtensionsBase* extensions = env->getExtensions();
+		if (extensions->_numaManager.isPhysicalNUMAEnabled()) {
+			uintptr_t numaNode = env->getNumaAffinity();
+			if ((0 != numaNode)
+			    && extensions->memoryManager->setNumaAffinity(_heap->getVmemHandle(), numaNode, (void*)sliceLow,
+			                                                  sliceHigh - sliceLow)) {
+				MM_AtomicOperations::add(&_boundBytes, sliceHigh - sliceLow);
+			}
+		}
+
+		for (uintptr_t page = sliceLow; page < sliceHigh; page += _pageSize) {
+			/* atomically adding zero forces a write fault without disturbing anything already stored in the page */
+			MM_AtomicOperations::add((volatile uintptr_t*)page, 0);
+		}
+		MM_AtomicOperations::add(&_touchedBytes, sliceHigh - sliceLow);
+	}
+};
+
 /**
  * @param heapAlignment size in bytes the heap should be aligned to
  * @param size the <i>desired</i> heap size
@@ -341,9 +434,83 @@ MM_HeapVirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowVal
 {
 	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(_omrVM);
 	MM_MemoryManager* memoryManager = extensions->memoryManager;
+	_pretouchedBytes -= OMR_MIN(_pretouchedBytes, size);
+	if ((NULL != _deferredPretouchHigh) && (address < _deferredPretouchHigh)
+	    && (_deferredPretouchLow < (void*)((uintptr_t)address + size))) {
+		/* part of the deferred range is going away: touch whatever is still committed instead */
+		_deferredPretouchLow = NULL;
+		_deferredPretouchHigh = (void*)HIGH_ADDRESS;
+	}
 	return memoryManager->decommitMemory(&_vmemHandle, address, size, lowValidAddress, highValidAddress);
 }
 
+/**
+ * Fault in the pages of a committed range (or of the whole committed heap) using the GC threads, so that
+ * the first collections after startup or expansion do not pay for the page faults, and report the time taken.
+ * When called from within a task (e.g. an expansion during a collection) the dispatcher is busy, so the range
+ * is remembered and touched by pretouchDeferredMemory() once the task has completed.
+ */
+void
+MM_HeapVirtualMemory::pretouchMemory(MM_EnvironmentBase* env, HeapPretouchType type, void* lowAddress, void* highAddress)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	if (!extensions->heapPretouch) {
+		return;
+	}
+
+	if (NULL != env->_currentTask) {
+		/* expansion is serialized, so the deferred range needs no locking */
+		if (NULL == _deferredPretouchHigh) {
+			_deferredPretouchLow = lowAddress;
+			_deferredPretouchHigh = highAddress;
+		} else if (_deferredPretouchHigh == lowAddress) {
+			_deferredPretouchHigh = highAddress;
+		} else if (_deferredPretouchLow == highAddress) {
+			_deferredPretouchLow = lowAddress;
+		} else if (NULL != _deferredPretouchLow) {
+			/* disjoint ranges (e.g. both semi-spaces): fall back to touching the whole committed heap */
+			_deferredPretouchLow = NULL;
+			_deferredPretouchHigh = (void*)HIGH_ADDRESS;
+		}
+		return;
+	}
+
+	runPretouchTask(env, type, lowAddress, highAddress);
+}
+
+void
+MM_HeapVirtualMemory::pretouchDeferredMemory(MM_EnvironmentBase* env)
+{
+	if (NULL != _deferredPretouchHigh) {
+		void* lowAddress = _deferredPretouchLow;
+		void* highAddress = _deferredPretouchHigh;
+		_deferredPretouchLow = NULL;
+		_deferredPretouchHigh = NULL;
+		runPretouchTask(env, HEAP_PRETOUCH_EXPAND, lowAddress, highAddress);
+	}
+}
+
+void
+MM_HeapVirtualMemory::runPretouchTask(MM_EnvironmentBase* env, HeapPretouchType type, void* lowAddress, void* highAddress)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+	MM_ParallelHeapPretouchTask pretouchTask(env, this, lowAddress, highAddress);
+	extensions->dispatcher->run(env, &pretouchTask);
+	uint64_t endTime = omrtime_hires_clock();
+
+	uintptr_t heapSize = getActiveMemorySize();
+	uintptr_t amount = (NULL == lowAddress) ? heapSize : ((uintptr_t)highAddress - (uintptr_t)lowAddress);
+	_pretouchedBytes = OMR_MIN(_pretouchedBytes + pretouchTask._touchedBytes, heapSize);
+
+	TRIGGER_J9HOOK_MM_PRIVATE_HEAP_PRETOUCH(extensions->privateHookInterface, env->getOmrVMThread(), endTime,
+	                                        J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, type, amount, pretouchTask._touchedBytes,
+	                                        pretouchTask._boundBytes, pretouchTask.getThreadCount(),
+	                                        omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+	                                        _pretouchedBytes, heapSize);
+}
+
 /**
  * Calculate the offset of an address from the base of the heap.
  * @param The address which require the offset for.
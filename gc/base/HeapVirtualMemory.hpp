@@ -37,10 +37,15 @@ class MM_HeapVirtualMemory : public MM_Heap
 protected:
 	MM_MemoryHandle _vmemHandle;
 	uintptr_t _heapAlignment;
+	uintptr_t _pretouchedBytes; /**< Bytes of committed heap memory faulted in by pretouchMemory() (approximate after decommits) */
+	void* _deferredPretouchLow; /**< Base of the range committed during a task and not touched yet, or NULL for the whole heap */
+	void* _deferredPretouchHigh; /**< Top of the deferred range, or NULL if nothing is deferred */
 
 	MM_PhysicalArena* _physicalArena;
 
 private:
+	void runPretouchTask(MM_EnvironmentBase* env, HeapPretouchType type, void* lowAddress, void* highAddress);
+
 protected:
 	bool initialize(MM_EnvironmentBase* env, uintptr_t size);
 	void tearDown(MM_EnvironmentBase* env);
@@ -76,6 +81,8 @@ public:
 
 	virtual bool commitMemory(void* address, uintptr_t size);
 	virtual bool decommitMemory(void* address, uintptr_t size, void* lowValidAddress, void* highValidAddress);
+	virtual void pretouchMemory(MM_EnvironmentBase* env, HeapPretouchType type, void* lowAddress, void* highAddress);
+	virtual void pretouchDeferredMemory(MM_EnvironmentBase* env);
 
 	virtual uintptr_t calculateOffsetFromHeapBase(void* address);
 
@@ -103,6 +110,9 @@ public:
 	        : MM_Heap(env, maximumMemorySize, regionManager),
 	          _vmemHandle(),
 	          _heapAlignment(heapAlignment),
+	          _pretouchedBytes(0),
+	          _deferredPretouchLow(NULL),
+	          _deferredPretouchHigh(NULL),
 	          _physicalArena(NULL)
 	{
 		_typeId = __FUNCTION__;
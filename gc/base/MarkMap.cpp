@@ -31,6 +31,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapWordOperations.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -106,8 +107,9 @@ MM_MarkMap::initializeMarkMap(MM_EnvironmentBase* env)
 					        - heapMapClearIndex;
 
 					/* And clear the mark map */
-					OMRZeroMemory((void*)(((uintptr_t)_heapMapBits) + heapMapClearIndex),
-					              heapMapClearSize);
+					MM_HeapMapWordOperations::clearWords(
+					        (uintptr_t*)(((uintptr_t)_heapMapBits) + heapMapClearIndex),
+					        heapMapClearSize / sizeof(uintptr_t));
 				}
 
 				/* Move to the next address range in the segment */
@@ -28,6 +28,8 @@
 #include "MarkMapSegmentChunkIterator.hpp"
 
 #include "Heap.hpp"
+#include "HeapMap.hpp"
+#include "HeapMapWordOperations.hpp"
 #include "HeapRegionManager.hpp"
 
 /**
@@ -38,17 +40,33 @@ GC_MarkMapSegmentChunkIterator::nextChunk(MM_HeapMap* markMap, UDATA** base, UDA
 {
 	while (_segmentBytesRemaining > 0) {
 		UDATA thisChunkSize = OMR_MIN(_segmentBytesRemaining, _chunkSize);
-		UDATA* chunkTop = (UDATA*)((U_8*)_nextChunkBase + thisChunkSize);
+		UDATA* chunkBase = _nextChunkBase;
+		UDATA* chunkTop = (UDATA*)((U_8*)chunkBase + thisChunkSize);
 		_segmentBytesRemaining -= thisChunkSize;
+		UDATA unitIndex = _unitIndex;
+		_unitIndex += 1;
 
 		/* There may not be a marked object in this chunk */
 		/* If that is the case, we move on to the next chunk */
-		_markedObjectIterator.reset(markMap, _nextChunkBase, chunkTop);
+		_markedObjectIterator.reset(markMap, chunkBase, chunkTop);
 		omrobjectptr_t firstObject = _markedObjectIterator.nextObject();
 
 		_nextChunkBase = chunkTop;
 
 		if (firstObject != NULL) {
+			if (NULL != _unitObjectCounts) {
+				/* extend sparse chunks by whole units so each chunk holds a similar amount of work */
+				UDATA objectCount = _unitObjectCounts[unitIndex];
+				while ((objectCount < _chunkObjects) && (_segmentBytesRemaining > 0)
+				       && (((UDATA)chunkTop - (UDATA)chunkBase) < _maximumChunkSize)) {
+					UDATA unitSize = OMR_MIN(_segmentBytesRemaining, _chunkSize);
+					objectCount += _unitObjectCounts[_unitIndex];
+					_unitIndex += 1;
+					_segmentBytesRemaining -= unitSize;
+					chunkTop = (UDATA*)((U_8*)chunkTop + unitSize);
+				}
+				_nextChunkBase = chunkTop;
+			}
 			*base = (UDATA*)firstObject;
 			*top = chunkTop;
 			if (_extensions->isVLHGC()) {
@@ -65,3 +83,14 @@ GC_MarkMapSegmentChunkIterator::nextChunk(MM_HeapMap* markMap, UDATA** base, UDA
 	}
 	return false;
 }
+
+/**
+ * @see GC_MarkMapSegmentChunkIterator::countMarkedObjects()
+ */
+UDATA
+GC_MarkMapSegmentChunkIterator::countMarkedObjects(MM_HeapMap* markMap, void* lowAddress, void* highAddress)
+{
+	UDATA lowSlot = markMap->getSlotIndex((omrobjectptr_t)lowAddress);
+	UDATA highSlot = markMap->getSlotIndex((omrobjectptr_t)highAddress);
+	return MM_HeapMapWordOperations::populationCount(markMap->getHeapMapBits() + lowSlot, highSlot - lowSlot);
+}
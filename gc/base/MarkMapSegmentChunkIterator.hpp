@@ -39,6 +39,10 @@ class MM_HeapMap;
 /**
  * Iterate over chunks of an area of memory by splitting the extent into even size chunks,
  * then using the mark map to find the first object in each chunk.
+ * When the marked object counts of the chunk sized units are given, a chunk is extended by whole units until it
+ * holds the target number of marked objects (or reaches the maximum size), so sparse parts of the heap yield fewer,
+ * larger chunks. The chunk boundaries only depend on the mark map and the unit counts, so every thread iterating the
+ * same area sees the same chunks.
  * @note the mark map must be valid in order to use this iterator
  * @ingroup GC_Base
  */
@@ -47,6 +51,10 @@ class GC_MarkMapSegmentChunkIterator
 private:
 	MM_GCExtensionsBase* const _extensions; /**< the GC extensions for the JVM */
 	UDATA _chunkSize;
+	UDATA _maximumChunkSize; /**< the size a chunk is not extended beyond */
+	UDATA _chunkObjects; /**< the number of marked objects a chunk is extended to hold */
+	const UDATA* _unitObjectCounts; /**< the marked objects of each unit of the area, NULL to not extend chunks */
+	UDATA _unitIndex; /**< the index in _unitObjectCounts of the unit starting at _nextChunkBase */
 	UDATA _segmentBytesRemaining;
 	MM_HeapMapIterator _markedObjectIterator;
 	UDATA* _nextChunkBase;
@@ -60,6 +68,34 @@ public:
 	                               UDATA chunkSize)
 	        : _extensions(extensions),
 	          _chunkSize(chunkSize),
+	          _maximumChunkSize(chunkSize),
+	          _chunkObjects(0),
+	          _unitObjectCounts(NULL),
+	          _unitIndex(0),
+	          _segmentBytesRemaining((UDATA)highAddress - (UDATA)lowAddress),
+	          _markedObjectIterator(extensions),
+	          _nextChunkBase((UDATA*)lowAddress){};
+
+	/**
+	 * @param chunkSize the size of the units chunks are built from, a multiple of the heap alignment
+	 * @param maximumChunkSize the size a chunk is not extended beyond
+	 * @param chunkObjects the number of marked objects a chunk is extended to hold
+	 * @param unitObjectCounts the number of marked objects in each chunkSize unit of the area, as returned by
+	 * countMarkedObjects(), or NULL for fixed size chunks
+	 */
+	GC_MarkMapSegmentChunkIterator(MM_GCExtensionsBase* extensions,
+	                               void* lowAddress,
+	                               void* highAddress,
+	                               UDATA chunkSize,
+	                               UDATA maximumChunkSize,
+	                               UDATA chunkObjects,
+	                               const UDATA* unitObjectCounts)
+	        : _extensions(extensions),
+	          _chunkSize(chunkSize),
+	          _maximumChunkSize(OMR_MAX(chunkSize, maximumChunkSize)),
+	          _chunkObjects(chunkObjects),
+	          _unitObjectCounts(unitObjectCounts),
+	          _unitIndex(0),
 	          _segmentBytesRemaining((UDATA)highAddress - (UDATA)lowAddress),
 	          _markedObjectIterator(extensions),
 	          _nextChunkBase((UDATA*)lowAddress){};
@@ -75,6 +111,11 @@ public:
 	 * @return false if there were no more chunks
 	 */
 	bool nextChunk(MM_HeapMap* markMap, UDATA** base, UDATA** top);
+
+	/**
+	 * @return the number of marked objects between two addresses which are multiples of the heap alignment
+	 */
+	static UDATA countMarkedObjects(MM_HeapMap* markMap, void* lowAddress, void* highAddress);
 };
 
 #endif /* MARKMAPSEGMENTCHUNKITERATOR_HPP_ */
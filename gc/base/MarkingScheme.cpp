@@ -30,6 +30,7 @@
 #include "ConcurrentGCStats.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 #include "Configuration.hpp"
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
@@ -296,6 +297,46 @@ MM_MarkingScheme::setMarkBitsInRange(MM_EnvironmentBase* env, void* heapBase, vo
  * Scanning
  ****************************************
  */
+uintptr_t
+MM_MarkingScheme::getArraySplitAmount(MM_EnvironmentBase* env, uintptr_t sizeInElements)
+{
+	uintptr_t splitAmount = sizeInElements / _extensions->dispatcher->activeThreadCount();
+	splitAmount = OMR_MAX(splitAmount, _extensions->markingArraySplitMinimumAmount);
+	return OMR_MIN(splitAmount, _extensions->markingArraySplitMaximumAmount);
+}
+
+uintptr_t
+MM_MarkingScheme::claimArraySplit(MM_EnvironmentBase* env,
+                                  omrobjectptr_t arrayPtr,
+                                  uintptr_t sizeInElements,
+                                  uintptr_t* startIndex)
+{
+	uintptr_t index = 0;
+	uintptr_t workItem = (uintptr_t)env->_workStack.peek(env);
+	if (PACKET_ARRAY_SPLIT_TAG == (workItem & PACKET_ARRAY_SPLIT_TAG)) {
+		/* the array was pushed with the index of the first element remaining to be scanned */
+		env->_workStack.popNoWait(env);
+		index = workItem >> PACKET_ARRAY_SPLIT_SHIFT;
+		Assert_MM_true(index < sizeInElements);
+		env->_markStats._arraySplitThreadCount = 1;
+	}
+
+	uintptr_t remaining = sizeInElements - index;
+	uintptr_t splitAmount = getArraySplitAmount(env, remaining);
+	if (splitAmount < remaining) {
+		uintptr_t splitIndex = index + splitAmount;
+		env->_workStack.push(env, (void*)arrayPtr,
+		                     (void*)((splitIndex << PACKET_ARRAY_SPLIT_SHIFT) | PACKET_ARRAY_SPLIT_TAG));
+		env->_workStack.flushOutputPacket(env);
+		env->_markStats._arraySplitCount += 1;
+		env->_markStats._arraySplitAmount += splitAmount;
+		remaining = splitAmount;
+	}
+
+	*startIndex = index;
+	return remaining;
+}
+
 /**
  * Private internal. Called exclusively from completeScan();
  */
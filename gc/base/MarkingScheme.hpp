@@ -255,6 +255,36 @@ public:
 		return sizeToDo;
 	}
 
+	/**
+	 * Get the number of elements of a large array that a thread should scan before leaving the rest to others.
+	 * The amount is proportional to what remains of the array, within markingArraySplitMinimumAmount and
+	 * markingArraySplitMaximumAmount.
+	 * @param[in] env calling thread environment
+	 * @param[in] sizeInElements the number of elements which remain to be scanned
+	 * @return the number of elements to scan
+	 */
+	uintptr_t getArraySplitAmount(MM_EnvironmentBase* env, uintptr_t sizeInElements);
+
+	/**
+	 * Claim the part of a large array popped from the work stack which the calling thread should scan. If the
+	 * array is followed by a split tag (see PACKET_ARRAY_SPLIT_TAG) on the work stack, the tag is popped and
+	 * scanning starts at the index it holds, otherwise at 0. If elements remain after the claimed part, the array
+	 * is pushed again with a tag holding the index of the first remaining element and the output packet is
+	 * flushed, so that another thread can pick up the rest while this one scans its part.
+	 *
+	 * Called by the marking delegate when it builds a scanner for a splittable array.
+	 *
+	 * @param[in] env calling thread environment
+	 * @param[in] arrayPtr the array popped from the work stack
+	 * @param[in] sizeInElements the number of elements in the array
+	 * @param[out] startIndex the index of the first element to scan
+	 * @return the number of elements to scan, from startIndex
+	 */
+	uintptr_t claimArraySplit(MM_EnvironmentBase* env,
+	                          omrobjectptr_t arrayPtr,
+	                          uintptr_t sizeInElements,
+	                          uintptr_t* startIndex);
+
 	MM_MarkingDelegate* getMarkingDelegate() { return &_delegate; }
 
 	MM_MarkMap* getMarkMap() { return _markMap; }
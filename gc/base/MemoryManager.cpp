@@ -665,7 +665,6 @@ MM_MemoryManager::isLargePage(MM_EnvironmentBase* env, uintptr_t pageSize)
 	return pageSize > pageSizes[0];
 }
 
-#if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 bool
 MM_MemoryManager::setNumaAffinity(const MM_MemoryHandle* handle,
                                   uintptr_t numaNode,
@@ -678,4 +677,3 @@ MM_MemoryManager::setNumaAffinity(const MM_MemoryHandle* handle,
 	return memory->setNumaAffinity(numaNode, address, byteAmount);
 }
 
-#endif /* defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER) */
@@ -232,7 +232,6 @@ public:
 	                    void* lowValidAddress,
 	                    void* highValidAddress);
 
-#if defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER)
 	/*
 	 * Set the NUMA affinity for the specified range within the receiver.
 	 *
@@ -244,7 +243,6 @@ public:
 	 * @return true on success, false on failure
 	 */
 	bool setNumaAffinity(const MM_MemoryHandle* handle, uintptr_t numaNode, void* address, uintptr_t byteAmount);
-#endif /* defined(OMR_GC_VLHGC) || defined(OMR_GC_MODRON_SCAVENGER) */
 
 	/**
 	 * Call roundDownTop for virtual memory instance provided in memory handle
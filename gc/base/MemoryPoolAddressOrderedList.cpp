@@ -30,6 +30,7 @@
 #include "MemoryPool.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
+#include "ObjectAllocationInterface.hpp"
 #include "modronopt.h"
 #include "omrcfg.h"
 #include "omrcomp.h"
@@ -145,6 +146,18 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase* env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	if (0 != ext->tlhAllocationCacheCount) {
+		_tlhAllocationCacheCount = ext->tlhAllocationCacheCount;
+		_tlhAllocationCacheRefillCount = OMR_MIN(ext->tlhAllocationCacheRefillCount, TLH_ALLOCATION_CACHE_CAPACITY);
+		_tlhAllocationCaches = (J9ModronTLHAllocationCache*)ext->getForge()->allocate(
+		        sizeof(J9ModronTLHAllocationCache) * _tlhAllocationCacheCount, OMR::GC::AllocationCategory::FIXED,
+		        OMR_GET_CALLSITE());
+		if (NULL == _tlhAllocationCaches) {
+			return false;
+		}
+		memset((void*)_tlhAllocationCaches, 0, sizeof(J9ModronTLHAllocationCache) * _tlhAllocationCacheCount);
+	}
+
 	return true;
 }
 
@@ -190,6 +203,11 @@ MM_MemoryPoolAddressOrderedList::tearDown(MM_EnvironmentBase* env)
 
 	_largeObjectCollectorAllocateStats = NULL;
 
+	if (NULL != _tlhAllocationCaches) {
+		_extensions->getForge()->free(_tlhAllocationCaches);
+		_tlhAllocationCaches = NULL;
+	}
+
 	_heapLock.tearDown();
 	_resetLock.tearDown();
 }
@@ -694,8 +712,18 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase* env,
 {
 	void* tlhBase = NULL;
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
-		tlhBase = addrBase;
+	if (NULL != _tlhAllocationCaches) {
+		if (allocateTLHFromCaches(env, maximumSizeInBytesRequired, addrBase, addrTop)) {
+			tlhBase = addrBase;
+		}
+	} else {
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		env->_objectAllocationInterface->getAllocationStats()->_tlhRefreshLockCount += 1;
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+		if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true,
+		                        _largeObjectAllocateStats)) {
+			tlhBase = addrBase;
+		}
 	}
 
 	if (NULL != tlhBase) {
@@ -714,6 +742,188 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase* env,
 	return tlhBase;
 }
 
+/**
+ * Allocate a TLH through the allocation cache the thread maps to, refilling the cache in bulk under the pool
+ * lock when it runs dry.
+ * @return true if a TLH was allocated
+ */
+bool
+MM_MemoryPoolAddressOrderedList::allocateTLHFromCaches(MM_EnvironmentBase* env,
+                                                       uintptr_t maximumSizeInBytesRequired,
+                                                       void*& addrBase,
+                                                       void*& addrTop)
+{
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	MM_AllocationStats* stats = env->_objectAllocationInterface->getAllocationStats();
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	uintptr_t cacheIndex = env->getEnvironmentId() % _tlhAllocationCacheCount;
+	J9ModronTLHAllocationCache* cache = &_tlhAllocationCaches[cacheIndex];
+
+	if (popTLHAllocationCache(cache, maximumSizeInBytesRequired, addrBase, addrTop)) {
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		stats->_tlhRefreshCacheCount += 1;
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+		return true;
+	}
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	stats->_tlhRefreshLockCount += 1;
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+	_heapLock.acquire();
+	/* another thread may have refilled the cache while this one waited for the lock */
+	bool result = popTLHAllocationCache(cache, maximumSizeInBytesRequired, addrBase, addrTop);
+	if (!result) {
+		if (0 != (MM_AtomicOperations::getU64(&cache->state) & 0xFFFFFFFF)) {
+			/* the cache holds chunks carved for larger TLHs than are requested now; give them back so the
+			 * refill below carves chunks of the requested size instead of every refresh taking the lock
+			 */
+			flushTLHAllocationCache(cache);
+		}
+		result = internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, false,
+		                             _largeObjectAllocateStats);
+		if (result) {
+			refillTLHAllocationCache(env, cache, maximumSizeInBytesRequired);
+		}
+	}
+	_heapLock.release();
+
+	if (!result) {
+		/* The free list is exhausted - take whatever the other caches are holding before reporting failure */
+		for (uintptr_t i = 1; i < _tlhAllocationCacheCount; i++) {
+			cache = &_tlhAllocationCaches[(cacheIndex + i) % _tlhAllocationCacheCount];
+			if (popTLHAllocationCache(cache, maximumSizeInBytesRequired, addrBase, addrTop)) {
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+				stats->_tlhRefreshCacheCount += 1;
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
+				result = true;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Pop a chunk off an allocation cache without locking. Like a TLH allocated from the free list, the chunk may
+ * exceed maximumSizeInBytesRequired by a remainder too small to be a free entry.
+ * @return true if a chunk was popped
+ */
+bool
+MM_MemoryPoolAddressOrderedList::popTLHAllocationCache(J9ModronTLHAllocationCache* cache,
+                                                       uintptr_t maximumSizeInBytesRequired,
+                                                       void*& addrBase,
+                                                       void*& addrTop)
+{
+	for (;;) {
+		uint64_t state = MM_AtomicOperations::getU64(&cache->state);
+		uintptr_t count = (uintptr_t)(state & 0xFFFFFFFF);
+		if (0 == count) {
+			return false;
+		}
+		/* the chunk must not be read ahead of the state it was published with */
+		MM_AtomicOperations::loadSync();
+		void* chunkBase = cache->chunkBase[count - 1];
+		void* chunkTop = cache->chunkTop[count - 1];
+		if (((uintptr_t)chunkTop - (uintptr_t)chunkBase) >= (maximumSizeInBytesRequired + _minimumFreeEntrySize)) {
+			/* cached for a larger request; leave it for a thread that can use it */
+			return false;
+		}
+		if (state == MM_AtomicOperations::lockCompareExchangeU64(&cache->state, state, state - 1)) {
+			addrBase = chunkBase;
+			addrTop = chunkTop;
+			return true;
+		}
+	}
+}
+
+/**
+ * Carve up to _tlhAllocationCacheRefillCount chunks off the free list into an empty cache.
+ * The chunks are accounted as allocated and made walkable with holes until they are handed out.
+ * Must be called with the pool lock held.
+ */
+void
+MM_MemoryPoolAddressOrderedList::refillTLHAllocationCache(MM_EnvironmentBase* env,
+                                                          J9ModronTLHAllocationCache* cache,
+                                                          uintptr_t maximumSizeInBytesRequired)
+{
+	uint64_t state = MM_AtomicOperations::getU64(&cache->state);
+	if (0 != (state & 0xFFFFFFFF)) {
+		/* another thread refilled the cache while this one waited for the lock */
+		return;
+	}
+
+	bool const compressed = compressObjectReferences();
+	uintptr_t count = 0;
+	while (count < _tlhAllocationCacheRefillCount) {
+		void* chunkBase = NULL;
+		void* chunkTop = NULL;
+		if (!internalAllocateTLH(env, maximumSizeInBytesRequired, chunkBase, chunkTop, false,
+		                         _largeObjectAllocateStats)) {
+			break;
+		}
+		MM_HeapLinkedFreeHeader::fillWithHoles(chunkBase, (uintptr_t)chunkTop - (uintptr_t)chunkBase, compressed);
+		cache->chunkBase[count] = chunkBase;
+		cache->chunkTop[count] = chunkTop;
+		count += 1;
+	}
+
+	if (0 != count) {
+		/* publish the chunks before the count that makes them visible */
+		MM_AtomicOperations::storeSync();
+		uint64_t generation = (state >> 32) + 1;
+		MM_AtomicOperations::setU64(&cache->state, (generation << 32) | (uint64_t)count);
+	}
+}
+
+/**
+ * Hand the chunks of an allocation cache back to the free list. Must be called with the pool lock held, or with
+ * the mutators stopped, so that the cache is not refilled meanwhile.
+ */
+void
+MM_MemoryPoolAddressOrderedList::flushTLHAllocationCache(J9ModronTLHAllocationCache* cache)
+{
+	/* claim the chunks by emptying the cache; a pop racing with this fails its compare and swap */
+	uint64_t state = 0;
+	do {
+		state = MM_AtomicOperations::getU64(&cache->state);
+	} while (state
+	         != MM_AtomicOperations::lockCompareExchangeU64(&cache->state, state, ((state >> 32) + 1) << 32));
+	MM_AtomicOperations::loadSync();
+
+	uintptr_t count = (uintptr_t)(state & 0xFFFFFFFF);
+	for (uintptr_t i = 0; i < count; i++) {
+		insertHeapChunk(cache->chunkBase[i], cache->chunkTop[i]);
+	}
+}
+
+/**
+ * Hand the chunks of every allocation cache back to the free list.
+ * @see flushTLHAllocationCache()
+ */
+void
+MM_MemoryPoolAddressOrderedList::flushTLHAllocationCaches()
+{
+	for (uintptr_t i = 0; i < _tlhAllocationCacheCount; i++) {
+		flushTLHAllocationCache(&_tlhAllocationCaches[i]);
+	}
+}
+
+/**
+ * Drop every cached chunk. Only called when the free list is discarded, since the memory the chunks describe
+ * is then reclaimed by the collector along with the rest of the free memory. Cached chunks are already
+ * accounted as allocated.
+ */
+void
+MM_MemoryPoolAddressOrderedList::invalidateTLHAllocationCaches()
+{
+	for (uintptr_t i = 0; i < _tlhAllocationCacheCount; i++) {
+		J9ModronTLHAllocationCache* cache = &_tlhAllocationCaches[i];
+		uint64_t generation = (MM_AtomicOperations::getU64(&cache->state) >> 32) + 1;
+		MM_AtomicOperations::setU64(&cache->state, generation << 32);
+	}
+}
+
 void*
 MM_MemoryPoolAddressOrderedList::collectorAllocateTLH(MM_EnvironmentBase* env,
                                                       MM_AllocateDescription* allocDescription,
@@ -747,6 +957,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 
 	clearHints();
 	_heapFreeList = (MM_HeapLinkedFreeHeader*)NULL;
+	invalidateTLHAllocationCaches();
 
 	_lastFreeEntry = NULL;
 	resetFreeEntryAllocateStats(_largeObjectAllocateStats);
@@ -1152,6 +1363,11 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	/* Cached chunks in the range would otherwise still be handed out by this pool once the range moves. Give
+	 * them back to the free list first, so that those in the range move with it and the others stay free.
+	 */
+	flushTLHAllocationCaches();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1558,12 +1774,24 @@ MM_MemoryPoolAddressOrderedList::unlock(MM_EnvironmentBase* env)
  */
 bool
 MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTop)
+{
+	_heapLock.acquire();
+	bool recycled = insertHeapChunk(chunkBase, chunkTop);
+	_heapLock.release();
+
+	return recycled;
+}
+
+/**
+ * Insert Chunk into correct position on the free list. The caller must hold the pool lock.
+ * @return true if recycle was successful, false if not.
+ */
+bool
+MM_MemoryPoolAddressOrderedList::insertHeapChunk(void* chunkBase, void* chunkTop)
 {
 	bool const compressed = compressObjectReferences();
 	bool recycled = false;
 
-	_heapLock.acquire();
-
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
@@ -1599,8 +1827,6 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(chunkSize);
 	}
 
-	_heapLock.release();
-
 	return recycled;
 }
 
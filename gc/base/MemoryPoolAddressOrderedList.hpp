@@ -37,6 +37,21 @@ class MM_AllocateDescription;
 class MM_ConcurrentSweepScheme;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#define TLH_ALLOCATION_CACHE_CAPACITY 16
+
+/**
+ * A stack of TLH sized chunks carved from the free list in bulk, which mutator threads pop without taking
+ * the pool lock. _state holds a generation in the high 32 bits and the chunk count in the low 32 bits. Every
+ * refill or invalidation bumps the generation, so a pop that raced with either fails its compare and swap.
+ * @ingroup GC_Base_Core
+ */
+typedef struct J9ModronTLHAllocationCache
+{
+	volatile uint64_t state;
+	void* volatile chunkBase[TLH_ALLOCATION_CACHE_CAPACITY];
+	void* volatile chunkTop[TLH_ALLOCATION_CACHE_CAPACITY];
+} J9ModronTLHAllocationCache;
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base_Core
@@ -60,6 +75,13 @@ private:
 	MM_LargeObjectAllocateStats*
 	        _largeObjectCollectorAllocateStats; /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
+	/* TLH allocation cache support */
+	J9ModronTLHAllocationCache*
+	        _tlhAllocationCaches; /**< Array of caches threads refresh their TLHs from, NULL if disabled */
+	uintptr_t _tlhAllocationCacheCount; /**< Number of entries in _tlhAllocationCaches */
+	uintptr_t
+	        _tlhAllocationCacheRefillCount; /**< Number of chunks carved from the free list per cache refill */
+
 protected:
 public:
 	/*
@@ -88,6 +110,22 @@ private:
 	                      MM_HeapLinkedFreeHeader* previousFreeEntry,
 	                      MM_HeapLinkedFreeHeader* nextFreeEntry);
 
+	bool allocateTLHFromCaches(MM_EnvironmentBase* env,
+	                           uintptr_t maximumSizeInBytesRequired,
+	                           void*& addrBase,
+	                           void*& addrTop);
+	bool popTLHAllocationCache(J9ModronTLHAllocationCache* cache,
+	                           uintptr_t maximumSizeInBytesRequired,
+	                           void*& addrBase,
+	                           void*& addrTop);
+	void refillTLHAllocationCache(MM_EnvironmentBase* env,
+	                              J9ModronTLHAllocationCache* cache,
+	                              uintptr_t maximumSizeInBytesRequired);
+	void flushTLHAllocationCache(J9ModronTLHAllocationCache* cache);
+	void flushTLHAllocationCaches();
+	void invalidateTLHAllocationCaches();
+	bool insertHeapChunk(void* chunkBase, void* chunkTop);
+
 protected:
 public:
 	static MM_MemoryPoolAddressOrderedList* newInstance(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize);
@@ -194,7 +232,10 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize)
 	        : MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize),
 	          _heapFreeList(NULL),
-	          _largeObjectCollectorAllocateStats(NULL)
+	          _largeObjectCollectorAllocateStats(NULL),
+	          _tlhAllocationCaches(NULL),
+	          _tlhAllocationCacheCount(0),
+	          _tlhAllocationCacheRefillCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -202,7 +243,10 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase* env, uintptr_t minimumFreeEntrySize, const char* name)
 	        : MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name),
 	          _heapFreeList(NULL),
-	          _largeObjectCollectorAllocateStats(NULL)
+	          _largeObjectCollectorAllocateStats(NULL),
+	          _tlhAllocationCaches(NULL),
+	          _tlhAllocationCacheCount(0),
+	          _tlhAllocationCacheRefillCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -45,6 +45,8 @@
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
+#define PAUSE_TARGET_HISTORY_WEIGHT 0.7
+
 /****************************************
  * Allocation
  ****************************************
@@ -960,8 +962,9 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 			doDynamicNewSpaceSizing = false;
 		}
 
+		/* measure in microseconds, so that short scavenges still have a duration */
 		uint64_t intervalTime = omrtime_hires_delta(_lastScavengeEndTime, extensions->scavengerStats._endTime,
-		                                            OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+		                                            OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
 		if (0 == intervalTime) {
 			if (debug) {
@@ -972,7 +975,7 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 
 		uint64_t scavengeTime = omrtime_hires_delta(extensions->scavengerStats._startTime,
 		                                            extensions->scavengerStats._endTime,
-		                                            OMRPORT_TIME_DELTA_IN_MILLISECONDS);
+		                                            OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 
 		if (0 == scavengeTime) {
 			if (debug) {
@@ -992,7 +995,7 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 			double timeRatio = (double)((int64_t)scavengeTime) / (double)((int64_t)intervalTime);
 
 			if (debug) {
-				omrtty_printf("\tTime scav:%llu interval:%llu ratio:%lf\n", scavengeTime, intervalTime,
+				omrtty_printf("\tTime scav:%lluus interval:%lluus ratio:%lf\n", scavengeTime, intervalTime,
 				              timeRatio);
 			}
 
@@ -1038,8 +1041,14 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 				omrtty_printf("%lf (weight %lf)\n", _averageScavengeTimeRatio, weight);
 			}
 
+			/* A pause target replaces the time ratio bounds below */
+			if (0 != extensions->scavengerPauseTargetMillis) {
+				checkSubSpaceMemoryPauseTarget(env, scavengeTime, debug);
+			}
+
 			/* If the average scavenge to interval ratio is greater than the maximum, try to expand */
-			if ((_averageScavengeTimeRatio > extensions->dnssExpectedTimeRatioMaximum)
+			if ((0 == extensions->scavengerPauseTargetMillis)
+			    && (_averageScavengeTimeRatio > extensions->dnssExpectedTimeRatioMaximum)
 			    && (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env)
 			    && (maxExpansionInSpace(env) != 0)) {
 				double desiredExpansionFactor, adjustedExpansionFactor;
@@ -1077,7 +1086,8 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 			}
 
 			/* If the average scavenge to interval ratio is less than the minimum, try to contract */
-			if (_averageScavengeTimeRatio < extensions->dnssExpectedTimeRatioMinimum
+			if ((0 == extensions->scavengerPauseTargetMillis)
+			    && (_averageScavengeTimeRatio < extensions->dnssExpectedTimeRatioMinimum)
 			    && (NULL != _physicalSubArena) && _physicalSubArena->canContract(env)
 			    && (maxContractionInSpace(env) != 0)) {
 				double desiredContractionFactor, adjustedContractionFactor;
@@ -1120,6 +1130,113 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Size the nursery for the scavenge pause target.
+ * The next pause is estimated from the survival rate and the copy throughput of the scavenges so far. The allocate
+ * space is sized for the smallest scavenge time ratio within the overhead target, but never beyond the size whose
+ * estimated pause meets the pause target.
+ * @param scavengeTime duration of the scavenge which just completed, in microseconds
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPauseTarget(MM_EnvironmentBase* env, uint64_t scavengeTime, bool debug)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_ScavengerStats* scavengerStats = &extensions->scavengerStats;
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	/* _allocateSpaceBase/Top still describe the space which has just been evacuated */
+	uintptr_t allocateSize = (uintptr_t)_allocateSpaceTop - (uintptr_t)_allocateSpaceBase;
+	uintptr_t survivedBytes = scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+
+	if ((0 == allocateSize) || (0 == survivedBytes)) {
+		if (debug) {
+			omrtty_printf("\tPause target - nothing survived - ABORTING\n");
+		}
+		return;
+	}
+
+	double survivalRate = (double)survivedBytes / (double)allocateSize;
+	double copyThroughput = (double)survivedBytes * 1000.0 / (double)((int64_t)scavengeTime);
+
+	if (0.0 == scavengerStats->_avgCopyThroughput) {
+		scavengerStats->_avgSurvivalRate = survivalRate;
+		scavengerStats->_avgCopyThroughput = copyThroughput;
+	} else {
+		scavengerStats->_avgSurvivalRate = (survivalRate * (1.0 - PAUSE_TARGET_HISTORY_WEIGHT))
+		        + (scavengerStats->_avgSurvivalRate * PAUSE_TARGET_HISTORY_WEIGHT);
+		scavengerStats->_avgCopyThroughput = (copyThroughput * (1.0 - PAUSE_TARGET_HISTORY_WEIGHT))
+		        + (scavengerStats->_avgCopyThroughput * PAUSE_TARGET_HISTORY_WEIGHT);
+	}
+
+	/* Estimate conservatively: a rising survival rate or a falling throughput is believed right away */
+	double expectedSurvivalRate = OMR_MAX(survivalRate, scavengerStats->_avgSurvivalRate);
+	double expectedCopyThroughput = OMR_MIN(copyThroughput, scavengerStats->_avgCopyThroughput);
+
+	/* The largest allocate space whose survivors can be copied within the pause target */
+	double pauseAllocateSize =
+	        (double)extensions->scavengerPauseTargetMillis * expectedCopyThroughput / expectedSurvivalRate;
+
+	/* The interval between scavenges grows with the allocate space while the survivors, hence the scavenge time,
+	 * mostly do not, so the time ratio is inversely proportional to the allocate space size
+	 */
+	double overheadAllocateSize =
+	        (double)allocateSize * _averageScavengeTimeRatio / extensions->scavengerPauseTargetOverhead;
+
+	/* The allocate space is a part of the nursery, which also holds the survivor space */
+	double desiredAllocateSize = OMR_MIN(pauseAllocateSize, overheadAllocateSize);
+	double currentSize = (double)getCurrentSize();
+	double desiredFactor = (desiredAllocateSize / (double)allocateSize) - 1.0;
+
+	if (debug) {
+		omrtty_printf("\tPause target - survived:%zu of %zu rate:%lf (avg %lf) throughput:%lf (avg %lf) "
+		              "bytes/ms\n",
+		              survivedBytes, allocateSize, survivalRate, scavengerStats->_avgSurvivalRate,
+		              copyThroughput, scavengerStats->_avgCopyThroughput);
+		omrtty_printf("\tPause target - allocate size for pause:%.0lf for overhead:%.0lf factor:%lf\n",
+		              pauseAllocateSize, overheadAllocateSize, desiredFactor);
+	}
+
+	Trc_MM_MSSSS_pauseTarget(env->getLanguageVMThread(), expectedSurvivalRate, expectedCopyThroughput,
+	                         (uintptr_t)pauseAllocateSize, (uintptr_t)overheadAllocateSize,
+	                         (uintptr_t)(currentSize * (1.0 + desiredFactor)));
+
+	if ((desiredFactor > 0.0) && (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env)
+	    && (maxExpansionInSpace(env) != 0)) {
+		double adjustedExpansionFactor = OMR_MIN(desiredFactor, extensions->dnssMaximumExpansion);
+
+		/* Round down so that expansion never takes the nursery past the pause target */
+		_expansionSize = MM_Math::roundToFloor(extensions->heapAlignment,
+		                                       (uintptr_t)(currentSize * adjustedExpansionFactor));
+		_expansionSize = MM_Math::roundToFloor(2 * regionSize, _expansionSize);
+
+		if (debug) {
+			omrtty_printf("\tPause target - expand size: %zu\n\n\n", _expansionSize);
+		}
+
+		if (0 != _expansionSize) {
+			extensions->heap->getResizeStats()->setLastExpandReason(SCAV_RATIO_TOO_HIGH);
+		}
+	} else if ((desiredFactor < 0.0) && (NULL != _physicalSubArena) && _physicalSubArena->canContract(env)
+	           && (maxContractionInSpace(env) != 0)) {
+		double adjustedContractionFactor = OMR_MIN(-desiredFactor, extensions->dnssMaximumContraction);
+
+		_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment,
+		                                           (uintptr_t)(currentSize * adjustedContractionFactor));
+		_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+
+		if (debug) {
+			omrtty_printf("\tPause target - contract size: %zu\n\n\n", _contractionSize);
+		}
+
+		if (pauseAllocateSize < overheadAllocateSize) {
+			extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_ABOVE_TARGET);
+		} else {
+			extensions->heap->getResizeStats()->setLastContractReason(SCAV_RATIO_TOO_LOW);
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
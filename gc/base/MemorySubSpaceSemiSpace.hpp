@@ -103,6 +103,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase* env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase* env);
+	void checkSubSpaceMemoryPauseTarget(MM_EnvironmentBase* env, uint64_t scavengeTime, bool debug);
 
 protected:
 	virtual void* allocationRequestFailed(MM_EnvironmentBase* env,
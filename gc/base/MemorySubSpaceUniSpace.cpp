@@ -401,6 +401,13 @@ MM_MemorySubSpaceUniSpace::calculateTargetContractSize(MM_EnvironmentBase* env,
 				 */
 				contractionSize = currentHeapSize - targetHeapSize;
 
+				/* Don't contract into the free space kept for promotions */
+				uintptr_t promotionHeadroom = calculatePromotionHeadroom(env);
+				if ((currentFree - contractionSize) < promotionHeadroom) {
+					contractionSize =
+					        (currentFree > promotionHeadroom) ? (currentFree - promotionHeadroom) : 0;
+				}
+
 				Trc_MM_MemorySubSpaceUniSpace_calculateTargetContractSize_Event1(
 				        env->getLanguageVMThread(), contractionSize);
 
@@ -464,6 +471,11 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase* env, uintptr_
 	minimumFree = (getActiveMemorySize() / _extensions->heapFreeMinimumRatioDivisor)
 	        * _extensions->heapFreeMinimumRatioMultiplier;
 
+	/* With a scavenger pause target, keep at least enough free for the promotions of the next few scavenges */
+	uintptr_t promotionHeadroom = calculatePromotionHeadroom(env);
+	bool promotionLimited = (promotionHeadroom > minimumFree);
+	minimumFree = OMR_MAX(minimumFree, promotionHeadroom);
+
 	/* The derired free is the sum of these 2 rounded to heapAlignment */
 	desiredFree = MM_Math::roundToCeiling(_extensions->heapAlignment, minimumFree + bytesRequired);
 
@@ -492,12 +504,18 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase* env, uintptr_
 		/* Calculate how much we need to expand the heap by in order to meet the 
 		 * allocation request and the desired -Xminf amount AFTER expansion 
 		 */
-		expandSize = ((desiredFree - currentFree) / (100 - _extensions->heapFreeMinimumRatioMultiplier))
-		        * _extensions->heapFreeMinimumRatioDivisor;
+		if (promotionLimited) {
+			/* The headroom is an absolute amount, it does not grow with the heap */
+			expandSize = desiredFree - currentFree;
+		} else {
+			expandSize = ((desiredFree - currentFree) / (100 - _extensions->heapFreeMinimumRatioMultiplier))
+			        * _extensions->heapFreeMinimumRatioDivisor;
+		}
 
 		if (expandSize > 0) {
 			/* Remember reason for contraction for later */
-			_extensions->heap->getResizeStats()->setLastExpandReason(FREE_SPACE_LESS_MINF);
+			ExpandReason reason = promotionLimited ? PROMOTION_HEADROOM : FREE_SPACE_LESS_MINF;
+			_extensions->heap->getResizeStats()->setLastExpandReason(reason);
 		}
 	}
 
@@ -539,6 +557,28 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase* env, uintptr_
 	return expandSize;
 }
 
+/**
+ * Determine how much free space must be kept for the objects promoted by scavenges between global collections.
+ * This only applies to the tenure space when the nursery is sized for a scavenger pause target, so that a small
+ * nursery promoting steadily does not make tenure space fill up and force global collections.
+ * @return the number of bytes to keep free, 0 if there is no pause target
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculatePromotionHeadroom(MM_EnvironmentBase* env)
+{
+	uintptr_t promotionHeadroom = 0;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerEnabled && (0 != _extensions->scavengerPauseTargetMillis)
+	    && (MEMORY_TYPE_OLD == (getTypeFlags() & MEMORY_TYPE_OLD))) {
+		MM_ScavengerStats* scavengerStats = &_extensions->scavengerStats;
+		uintptr_t promotedBytes = scavengerStats->_avgTenureBytes
+		        + (uintptr_t)(_extensions->tenureBytesDeviationBoost * scavengerStats->_avgTenureBytesDeviation);
+		promotionHeadroom = _extensions->scavengerPauseTargetTenureScavenges * promotedBytes;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	return promotionHeadroom;
+}
+
 /**
  * Determine how much space we need to expand the heap by on this GC cycle to meet the collectors requirement.
  * @param allocDescription descriptor for failing allocate request  
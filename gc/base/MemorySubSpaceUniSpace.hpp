@@ -51,6 +51,7 @@ protected:
 	                                       MM_Collector* requestCollector,
 	                                       MM_AllocateDescription* allocDescription);
 	uintptr_t calculateTargetContractSize(MM_EnvironmentBase* env, uintptr_t allocSize, bool ratioContract);
+	uintptr_t calculatePromotionHeadroom(MM_EnvironmentBase* env);
 	bool timeForHeapContract(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription, bool systemGC);
 	bool timeForHeapExpand(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
 	uintptr_t performExpand(MM_EnvironmentBase* env);
@@ -22,6 +22,7 @@
 
 #include "ObjectHeapBufferedIterator.hpp"
 
+#include "AtomicOperations.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "ModronAssertions.h"
@@ -90,6 +91,10 @@ GC_ObjectHeapBufferedIterator::nextObject()
 
 	omrobjectptr_t next = _cache[_cacheIndex];
 	_cacheIndex++;
+	if ((_cacheIndex + PREFETCH_DISTANCE) <= _cacheCount) {
+		/* the caller is likely to read the header of each object it is handed */
+		MM_AtomicOperations::prefetch(_cache[_cacheIndex + PREFETCH_DISTANCE - 1]);
+	}
 	return next;
 }
 
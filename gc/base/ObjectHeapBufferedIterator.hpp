@@ -61,7 +61,8 @@ private:
 protected:
 	enum
 	{
-		CACHE_SIZE = 256
+		CACHE_SIZE = 256,
+		PREFETCH_DISTANCE = 4 /**< how many cached objects ahead of the one returned are prefetched */
 	};
 	MM_HeapRegionDescriptor* _region;
 	GC_ObjectHeapBufferedIteratorState _state;
@@ -425,6 +425,28 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase* env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+	uintptr_t availableThreadCount = taskActiveThreadCount;
+
+	/* Unless the caller chose the thread count, don't wake more threads than the task's own estimate of its work
+	 * can keep busy. The estimate is made again for each task, so threads join as the work grows. A thread count
+	 * forced by the user is the upper bound.
+	 */
+	if (_extensions->adaptiveGCThreadCount && !_extensions->isMetronomeGC() && (UDATA_MAX == threadCount)
+	    && (1 < taskActiveThreadCount)) {
+		uintptr_t recommendedThreadCount = task->getRecommendedWorkingThreads(env);
+		if (recommendedThreadCount < taskActiveThreadCount) {
+			taskActiveThreadCount = OMR_MAX(1, recommendedThreadCount);
+			Trc_MM_ParallelDispatcher_recomputeActiveThreadCountForTask_recommended(
+			        env->getLanguageVMThread(), task->getBaseVirtualTypeId(), availableThreadCount,
+			        taskActiveThreadCount);
+		}
+	}
+
+	MM_DispatcherStats* dispatcherStats = &_extensions->dispatcherStats;
+	dispatcherStats->_taskCount += 1;
+	dispatcherStats->_threadsAvailable += availableThreadCount;
+	dispatcherStats->_threadsDispatched += taskActiveThreadCount;
+
 	task->setThreadCount(taskActiveThreadCount);
 	return taskActiveThreadCount;
 }
@@ -477,7 +499,13 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase* env, MM_Task* t
 		_statusTable[index] = slave_status_reserved;
 		_taskTable[index] = task;
 	}
-	wakeUpThreads(threadCount);
+
+	/* Unless there is a separate master thread, a task run by the master alone has nobody to wake */
+	if ((1 < threadCount) || useSeparateMasterThread()) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_dispatchStartTime = omrtime_hires_clock();
+		wakeUpThreads(threadCount);
+	}
 	omrthread_monitor_exit(_slaveThreadMutex);
 }
 
@@ -486,6 +514,15 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase* env)
 {
 	uintptr_t slaveID = env->getSlaveID();
 
+	if (!env->isMasterThread()) {
+		/* Slave threads accept their task holding _slaveThreadMutex, so the stats can be updated directly */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_DispatcherStats* dispatcherStats = &_extensions->dispatcherStats;
+		uint64_t wakeTime = omrtime_hires_clock() - _dispatchStartTime;
+		dispatcherStats->_wakeTime += wakeTime;
+		dispatcherStats->_maxWakeTime = OMR_MAX(dispatcherStats->_maxWakeTime, wakeTime);
+	}
+
 	env->resetWorkUnitIndex();
 	_statusTable[slaveID] = slave_status_active;
 	env->_currentTask = _taskTable[slaveID];
@@ -75,6 +75,7 @@ protected:
 	uintptr_t _threadCountMaximum; /**< maximum threadcount - this is the size of the thread tables etc */
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
+	uint64_t _dispatchStartTime; /**< time in hi-res ticks at which slave threads were woken for the current task */
 
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
@@ -152,6 +153,7 @@ public:
 	          _threadCountMaximum(1),
 	          _threadCount(1),
 	          _activeThreadCount(1),
+	          _dispatchStartTime(0),
 	          _handler(handler),
 	          _handler_arg(handler_arg),
 	          _defaultOSStackSize(defaultOSStackSize)
@@ -38,6 +38,11 @@
 #include "ParallelObjectHeapIterator.hpp"
 #include "ParallelTask.hpp"
 
+/**
+ * The fewest work units per thread a parallel walk is split into, whatever the density of the heap.
+ */
+#define PARALLEL_HEAP_WALK_MINIMUM_UNITS_PER_THREAD 4
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Standard
@@ -53,6 +58,8 @@ private:
 	uintptr_t _walkFlags;
 
 	MM_ParallelHeapWalker* _heapWalker;
+	uintptr_t* _unitObjectCounts; /**< marked objects of each work unit of the walk, shared by the threads of the task */
+	uintptr_t _unitObjectCountsSize; /**< number of entries allocated for _unitObjectCounts */
 
 protected:
 public:
@@ -63,6 +70,14 @@ public:
 	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
 
 	virtual void run(MM_EnvironmentBase* env);
+	virtual void masterCleanup(MM_EnvironmentBase* env);
+
+	/**
+	 * Count the marked objects of each work unit of the walk. Each unit is counted by the one thread which claims
+	 * it, and the counts are shared so that every thread merges sparse units into the same chunks.
+	 * @return the counts of the units of the walk in heap order, or NULL if they could not be allocated
+	 */
+	uintptr_t* countUnitObjects(MM_EnvironmentBase* env, MM_MarkMap* markMap, uintptr_t unitSize);
 
 	/*
 	 * Create a ParallelObjectAndVMSlotsDoTask object.
@@ -77,7 +92,9 @@ public:
 	          _function(function),
 	          _userData(userData),
 	          _walkFlags(walkFlags),
-	          _heapWalker(heapWalker)
+	          _heapWalker(heapWalker),
+	          _unitObjectCounts(NULL),
+	          _unitObjectCountsSize(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -111,21 +128,36 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase* env,
 {
 	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Entry(env->getLanguageVMThread());
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+	MM_Heap* heap = extensions->heap;
 
-	/* determine the size of the segment chunks to use for parallel walks */
+	/* Determine the work units of the parallel walk. The heap is split into fixed size units, sparse runs of
+	 * units are merged according to the mark map so that each unit holds a similar number of objects, and
+	 * threads claim the units dynamically. Without a valid mark map the walk can not be split.
+	 */
 	uintptr_t threadCount = env->_currentTask->getThreadCount();
-	uintptr_t heapChunkFactor = 1;
+	uintptr_t heapSize = heap->getMemorySize();
+	uintptr_t unitSize = heapSize;
+	uintptr_t maximumUnitSize = heapSize;
+	uintptr_t unitObjects = 0;
 	if ((threadCount > 1) && _markMap->isMarkMapValid()) {
-		heapChunkFactor = threadCount * 8;
+		unitSize = OMR_MIN(extensions->parallelHeapWalkUnitSize, heapSize / threadCount);
+		uintptr_t minimumUnitCount = threadCount * PARALLEL_HEAP_WALK_MINIMUM_UNITS_PER_THREAD;
+		maximumUnitSize = OMR_MAX(unitSize, heapSize / minimumUnitCount);
+		unitObjects = extensions->parallelHeapWalkUnitObjects;
 	}
-	uintptr_t parallelChunkSize = extensions->heap->getMemorySize() / heapChunkFactor;
-	parallelChunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, parallelChunkSize);
+	unitSize = MM_Math::roundToCeiling(extensions->heapAlignment, OMR_MAX(unitSize, 1));
+	maximumUnitSize = MM_Math::roundToCeiling(extensions->heapAlignment, maximumUnitSize);
 
 	/* Perform the parallel object heap iteration */
 	uintptr_t objectsWalked = 0;
-	MM_Heap* heap = extensions->heap;
+	uintptr_t unitsWalked = 0;
 	MM_HeapRegionManager* regionManager = heap->getHeapRegionManager();
 	regionManager->lock();
+	uintptr_t* unitObjectCounts = NULL;
+	if (0 != unitObjects) {
+		MM_ParallelObjectDoTask* task = (MM_ParallelObjectDoTask*)env->_currentTask;
+		unitObjectCounts = task->countUnitObjects(env, _markMap, unitSize);
+	}
 	GC_HeapRegionIterator regionIterator(regionManager);
 	MM_HeapRegionDescriptor* region = NULL;
 	OMR_VMThread* omrVMThread = env->getOmrVMThread();
@@ -133,18 +165,22 @@ MM_ParallelHeapWalker::allObjectsDoParallel(MM_EnvironmentBase* env,
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if (walkFlags == (region->getTypeFlags() & walkFlags)) {
 			GC_ParallelObjectHeapIterator objectHeapIterator(env, region, region->getLowAddress(),
-			                                                 region->getHighAddress(), _markMap,
-			                                                 parallelChunkSize);
+			                                                 region->getHighAddress(), _markMap, unitSize,
+			                                                 maximumUnitSize, unitObjects, unitObjectCounts);
 			omrobjectptr_t object = NULL;
 			while ((object = objectHeapIterator.nextObject()) != NULL) {
 				function(omrVMThread, region, object, userData);
 				objectsWalked += 1;
 			}
+			unitsWalked += objectHeapIterator.getChunksClaimed();
+			if (NULL != unitObjectCounts) {
+				unitObjectCounts += MM_Math::roundToCeiling(unitSize, region->getSize()) / unitSize;
+			}
 		}
 	}
 	regionManager->unlock();
-	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_Exit(env->getLanguageVMThread(), heapChunkFactor,
-	                                                    parallelChunkSize, objectsWalked);
+	Trc_MM_ParallelHeapWalker_allObjectsDoParallel_ExitUnits(env->getLanguageVMThread(), unitSize, maximumUnitSize,
+	                                                         unitsWalked, objectsWalked);
 }
 
 /**
@@ -161,18 +197,37 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase* env,
                                     bool prepareHeapForWalk)
 {
 	if (parallel) {
-		GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
-		if (prepareHeapForWalk) {
-			_globalCollector->prepareHeapForWalk(env);
-		}
-
-		MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, parallel);
-		env->getExtensions()->dispatcher->run(env, &objectDoTask);
+		allObjectsDoWithThreadCount(env, function, userData, walkFlags, UDATA_MAX, prepareHeapForWalk);
 	} else {
 		MM_HeapWalker::allObjectsDo(env, function, userData, walkFlags, parallel, prepareHeapForWalk);
 	}
 }
 
+/**
+ * Walk through all live objects of the heap in parallel with at most the given number of GC threads.
+ */
+void
+MM_ParallelHeapWalker::allObjectsDoWithThreadCount(MM_EnvironmentBase* env,
+                                                   MM_HeapWalkerObjectFunc function,
+                                                   void* userData,
+                                                   uintptr_t walkFlags,
+                                                   uintptr_t threadCount,
+                                                   bool prepareHeapForWalk)
+{
+	GC_OMRVMInterface::flushCachesForWalk(env->getOmrVM());
+	bool markMapWasValid = _markMap->isMarkMapValid();
+	if (prepareHeapForWalk) {
+		_globalCollector->prepareHeapForWalk(env);
+		/* the mark just performed describes every object of the heap, so it can be used to split the walk */
+		_markMap->setMarkMapValid(true);
+	}
+
+	MM_ParallelObjectDoTask objectDoTask(env, this, function, userData, walkFlags, true);
+	env->getExtensions()->dispatcher->run(env, &objectDoTask, threadCount);
+
+	_markMap->setMarkMapValid(markMapWasValid);
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -181,3 +236,65 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase* env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+void
+MM_ParallelObjectDoTask::masterCleanup(MM_EnvironmentBase* env)
+{
+	if (NULL != _unitObjectCounts) {
+		env->getForge()->free(_unitObjectCounts);
+		_unitObjectCounts = NULL;
+		_unitObjectCountsSize = 0;
+	}
+	MM_ParallelTask::masterCleanup(env);
+}
+
+uintptr_t*
+MM_ParallelObjectDoTask::countUnitObjects(MM_EnvironmentBase* env, MM_MarkMap* markMap, uintptr_t unitSize)
+{
+	MM_HeapRegionManager* regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	if (synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		uintptr_t unitCount = 0;
+		GC_HeapRegionIterator regionIterator(regionManager);
+		MM_HeapRegionDescriptor* region = NULL;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (_walkFlags == (region->getTypeFlags() & _walkFlags)) {
+				unitCount += MM_Math::roundToCeiling(unitSize, region->getSize()) / unitSize;
+			}
+		}
+		if (unitCount > _unitObjectCountsSize) {
+			if (NULL != _unitObjectCounts) {
+				env->getForge()->free(_unitObjectCounts);
+			}
+			_unitObjectCounts = (uintptr_t*)env->getForge()->allocate(
+			        unitCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::OTHER, OMR_GET_CALLSITE());
+			_unitObjectCountsSize = (NULL == _unitObjectCounts) ? 0 : unitCount;
+		}
+		releaseSynchronizedGCThreads(env);
+	}
+
+	/* every thread sees the same allocation result, so either all of them count or none does */
+	uintptr_t* unitObjectCounts = _unitObjectCounts;
+	if (NULL != unitObjectCounts) {
+		uintptr_t unitIndex = 0;
+		GC_HeapRegionIterator regionIterator(regionManager);
+		MM_HeapRegionDescriptor* region = NULL;
+		while (NULL != (region = regionIterator.nextRegion())) {
+			if (_walkFlags == (region->getTypeFlags() & _walkFlags)) {
+				uint8_t* unitBase = (uint8_t*)region->getLowAddress();
+				uint8_t* regionTop = (uint8_t*)region->getHighAddress();
+				while (unitBase < regionTop) {
+					uint8_t* unitTop = unitBase + OMR_MIN(unitSize, (uintptr_t)(regionTop - unitBase));
+					if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+						unitObjectCounts[unitIndex] =
+						        GC_MarkMapSegmentChunkIterator::countMarkedObjects(markMap, unitBase, unitTop);
+					}
+					unitIndex += 1;
+					unitBase = unitTop;
+				}
+			}
+		}
+		/* all units must be counted before any thread derives the chunk boundaries from the counts */
+		synchronizeGCThreads(env, UNIQUE_ID);
+	}
+	return unitObjectCounts;
+}
@@ -68,6 +68,17 @@ public:
 	                          bool parallel,
 	                          bool prepareHeapForWalk);
 
+	/**
+	 * Walk through all live objects of the heap in parallel with at most the given number of GC threads and
+	 * apply the provided function.
+	 */
+	void allObjectsDoWithThreadCount(MM_EnvironmentBase* env,
+	                                 MM_HeapWalkerObjectFunc function,
+	                                 void* userData,
+	                                 uintptr_t walkFlags,
+	                                 uintptr_t threadCount,
+	                                 bool prepareHeapForWalk);
+
 	MM_MarkMap* getMarkMap() { return _markMap; }
 	void setMarkMap(MM_MarkMap* markMap) { _markMap = markMap; }
 
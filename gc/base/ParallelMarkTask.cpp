@@ -24,6 +24,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "MarkingScheme.hpp"
+#include "WorkPackets.hpp"
 #include "WorkStack.hpp"
 #include "modronopt.h"
 #include "omrcfg.h"
@@ -61,6 +62,19 @@ MM_ParallelMarkTask::setup(MM_EnvironmentBase* env)
 	}
 }
 
+void
+MM_ParallelMarkTask::masterSetup(MM_EnvironmentBase* env)
+{
+	/* GC threads may only use their work stealing deques while they have unique slave IDs within this task */
+	_markingScheme->getWorkPackets()->setWorkStealingActive(env, true);
+}
+
+void
+MM_ParallelMarkTask::masterCleanup(MM_EnvironmentBase* env)
+{
+	_markingScheme->getWorkPackets()->setWorkStealingActive(env, false);
+}
+
 void
 MM_ParallelMarkTask::cleanup(MM_EnvironmentBase* env)
 {
@@ -85,6 +99,11 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase* env)
 	        (uint32_t)env->_markStats._syncStallCount, env->_workPacketStats.workPacketsAcquired,
 	        env->_workPacketStats.workPacketsReleased, env->_workPacketStats.workPacketsExchanged,
 	        0 /* TODO CRG figure out to get the array split size*/);
+	Trc_MM_ParallelMarkTask_workStealingStats(env->getLanguageVMThread(), (uint32_t)env->getSlaveID(),
+	                                          env->_workPacketStats.workPacketsPushedLocal,
+	                                          env->_workPacketStats.workPacketsPoppedLocal,
+	                                          env->_workPacketStats.workPacketsStolen,
+	                                          env->_workPacketStats.workPacketStealAttempts);
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -48,6 +48,7 @@ GC_ParallelObjectHeapIterator::getNextChunk()
 			 * beginning of the first chunk are also iterated - it is guarantied by setting _chunkBase
 			 * for the first chunk to the segment base. */
 			_objectHeapIterator.reset(_chunkBase, (UDATA*)_topAddress);
+			_chunksClaimed += 1;
 			return true;
 		}
 	}
@@ -62,6 +62,7 @@ private:
 	MM_MarkMap* _markMap;
 	UDATA* _chunkBase;
 	UDATA* _chunkTop;
+	UDATA _chunksClaimed; /**< number of chunks this thread has walked */
 
 protected:
 public:
@@ -78,20 +79,36 @@ public:
 	virtual void advance(UDATA size);
 	virtual void reset(UDATA* base, UDATA* top);
 
+	/**
+	 * @return the number of chunks this thread has claimed so far
+	 */
+	UDATA getChunksClaimed() { return _chunksClaimed; }
+
+	/**
+	 * @param parallelChunkSize the size of the units chunks are built from
+	 * @param maximumChunkSize the size a chunk is not extended beyond
+	 * @param chunkObjects the number of marked objects a chunk is extended to hold
+	 * @param unitObjectCounts the number of marked objects in each parallelChunkSize unit, NULL for fixed size chunks
+	 */
 	GC_ParallelObjectHeapIterator(MM_EnvironmentBase* env,
 	                              MM_HeapRegionDescriptor* region,
 	                              void* base,
 	                              void* top,
 	                              MM_MarkMap* markMap,
-	                              UDATA parallelChunkSize)
+	                              UDATA parallelChunkSize,
+	                              UDATA maximumChunkSize = 0,
+	                              UDATA chunkObjects = 0,
+	                              const UDATA* unitObjectCounts = NULL)
 	        : GC_ObjectHeapIterator(),
 	          _env(env),
-	          _objectHeapIterator(env->getExtensions(), region, base, top, false, 1),
-	          _segmentChunkIterator(env->getExtensions(), base, top, parallelChunkSize),
+	          _objectHeapIterator(env->getExtensions(), region, base, top, false),
+	          _segmentChunkIterator(env->getExtensions(), base, top, parallelChunkSize, maximumChunkSize,
+	                                chunkObjects, unitObjectCounts),
 	          _topAddress(top),
 	          _markMap(markMap),
 	          _chunkBase(NULL),
-	          _chunkTop(NULL)
+	          _chunkTop(NULL),
+	          _chunksClaimed(0)
 	{
 		/* Metronome currently has no notion of address-ordered-list */
 		Assert_MM_true(!env->getExtensions()->isMetronomeGC());
@@ -25,11 +25,16 @@
 #include "AtomicOperations.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "ModronAssertions.h"
+#include "SpinLimiter.hpp"
 #include "modronopt.h"
 #include "omr.h"
 #include "omrcfg.h"
 
+/* Number of spins between clock reads while waiting at a synchronization point */
+#define SYNCHRONIZE_SPINS_BETWEEN_CLOCK_READS 64
+
 bool
 MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase* env)
 {
@@ -81,6 +86,7 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase* env, const char* id)
 		if (0 == _synchronizeCount) {
 			_syncPointUniqueId = id;
 			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
+			recordFirstArrival(env);
 		} else {
 			Assert_GC_true_with_message4(
 			        env, _syncPointUniqueId == id,
@@ -96,17 +102,18 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase* env, const char* id)
 		_synchronizeCount += 1;
 
 		if (_synchronizeCount == _threadCount) {
+			recordLastArrival(env, id);
 			_synchronizeCount = 0;
+			/* spinning threads read the index without the mutex, so publish the work done before the release */
+			MM_AtomicOperations::storeSync();
 			_synchronizeIndex += 1;
-			omrthread_monitor_notify_all(_synchronizeMutex);
+			notifyParkedThreads();
+			omrthread_monitor_exit(_synchronizeMutex);
 		} else {
-			volatile uintptr_t index = _synchronizeIndex;
-
-			do {
-				omrthread_monitor_wait(_synchronizeMutex);
-			} while (index == _synchronizeIndex);
+			uintptr_t index = _synchronizeIndex;
+			omrthread_monitor_exit(_synchronizeMutex);
+			waitForRelease(env, index, false);
 		}
-		omrthread_monitor_exit(_synchronizeMutex);
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -129,6 +136,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase* env, c
 		if (0 == _synchronizeCount) {
 			_syncPointUniqueId = id;
 			_syncPointWorkUnitIndex = env->getWorkUnitIndex();
+			recordFirstArrival(env);
 		} else {
 			Assert_GC_true_with_message4(
 			        env, _syncPointUniqueId == id,
@@ -141,27 +149,28 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase* env, c
 			                             _syncPointWorkUnitIndex);
 		}
 
+		/* a spinning master is released by the count */
+		MM_AtomicOperations::storeSync();
 		_synchronizeCount += 1;
 		if (_synchronizeCount == _threadCount) {
+			recordLastArrival(env, id);
 			if (env->isMasterThread()) {
 				omrthread_monitor_exit(_synchronizeMutex);
 				isMasterThread = true;
 				_synchronized = true;
 				goto done;
 			}
-			omrthread_monitor_notify_all(_synchronizeMutex);
+			/* wake the master */
+			notifyParkedThreads();
 		}
+		omrthread_monitor_exit(_synchronizeMutex);
 
-		while (index == _synchronizeIndex) {
-			if (env->isMasterThread() && (_synchronizeCount == _threadCount)) {
-				omrthread_monitor_exit(_synchronizeMutex);
-				isMasterThread = true;
-				_synchronized = true;
-				goto done;
-			}
-			omrthread_monitor_wait(_synchronizeMutex);
+		/* the master is released once all threads have arrived, the others once the master releases them */
+		waitForRelease(env, index, env->isMasterThread());
+		if (env->isMasterThread()) {
+			isMasterThread = true;
+			_synchronized = true;
 		}
-		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
 		isMasterThread = true;
@@ -190,6 +199,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase*
 		if (0 == _synchronizeCount) {
 			_syncPointUniqueId = id;
 			_syncPointWorkUnitIndex = workUnitIndex;
+			recordFirstArrival(env);
 		} else {
 			Assert_GC_true_with_message4(env, _syncPointUniqueId == id,
 			                             "%s at %p from synchronizeGCThreadsAndReleaseSingleThread: call "
@@ -204,16 +214,15 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase*
 
 		_synchronizeCount += 1;
 		if (_synchronizeCount == _threadCount) {
+			recordLastArrival(env, id);
 			omrthread_monitor_exit(_synchronizeMutex);
 			isReleasedThread = true;
 			_synchronized = true;
 			goto done;
 		}
-
-		do {
-			omrthread_monitor_wait(_synchronizeMutex);
-		} while (index == _synchronizeIndex);
 		omrthread_monitor_exit(_synchronizeMutex);
+
+		waitForRelease(env, index, false);
 	} else {
 		_synchronized = true;
 		isReleasedThread = true;
@@ -239,11 +248,67 @@ MM_ParallelTask::releaseSynchronizedGCThreads(MM_EnvironmentBase* env)
 	_synchronized = false;
 	omrthread_monitor_enter(_synchronizeMutex);
 	_synchronizeCount = 0;
+	MM_AtomicOperations::storeSync();
 	_synchronizeIndex += 1;
-	omrthread_monitor_notify_all(_synchronizeMutex);
+	notifyParkedThreads();
 	omrthread_monitor_exit(_synchronizeMutex);
 }
 
+void
+MM_ParallelTask::waitForRelease(MM_EnvironmentBase* env, uintptr_t index, bool releaseOnArrivals)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	uint64_t waitStartTime = omrtime_hires_clock();
+
+	/* Threads usually arrive within microseconds of each other, so spin before paying for a park and wake up */
+	if (0 != extensions->synchronizeGCThreadsSpinMicros) {
+		MM_SpinLimiter spinLimiter(env, extensions->synchronizeGCThreadsSpinMicros,
+		                           SYNCHRONIZE_SPINS_BETWEEN_CLOCK_READS);
+		while (!isReleased(index, releaseOnArrivals) && spinLimiter.spin()) {
+			MM_AtomicOperations::yieldCPU();
+		}
+	}
+
+	if (isReleased(index, releaseOnArrivals)) {
+		/* order the reads of the work done by the other threads after the release */
+		MM_AtomicOperations::loadSync();
+	} else {
+		omrthread_monitor_enter(_synchronizeMutex);
+		_parkedThreadCount += 1;
+		extensions->dispatcherStats._parkCount += 1;
+		while (!isReleased(index, releaseOnArrivals)) {
+			omrthread_monitor_wait(_synchronizeMutex);
+		}
+		_parkedThreadCount -= 1;
+		omrthread_monitor_exit(_synchronizeMutex);
+	}
+
+	MM_AtomicOperations::addU64(&_synchronizeStallTime, omrtime_hires_clock() - waitStartTime);
+}
+
+void
+MM_ParallelTask::recordFirstArrival(MM_EnvironmentBase* env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	_syncPointFirstArrivalTime = omrtime_hires_clock();
+}
+
+void
+MM_ParallelTask::recordLastArrival(MM_EnvironmentBase* env, const char* id)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_DispatcherStats* dispatcherStats = &env->getExtensions()->dispatcherStats;
+	uint64_t arrivalSpread = omrtime_hires_clock() - _syncPointFirstArrivalTime;
+
+	if (arrivalSpread > dispatcherStats->_maxArrivalSpread) {
+		dispatcherStats->_maxArrivalSpread = arrivalSpread;
+		dispatcherStats->_maxArrivalSpreadSyncPoint = id;
+	}
+	Trc_MM_ParallelTask_recordLastArrival(env->getLanguageVMThread(), getBaseVirtualTypeId(), env->getSlaveID(), id,
+	                                      omrtime_hires_delta(0, arrivalSpread, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+}
+
 void
 MM_ParallelTask::complete(MM_EnvironmentBase* env)
 {
@@ -287,9 +352,16 @@ MM_ParallelTask::complete(MM_EnvironmentBase* env)
 
 		if (env->isMasterThread()) {
 			/* Synchronization on exit - cannot delete the task object until all threads are done with it */
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			uint64_t waitStartTime = omrtime_hires_clock();
 			while (0 != _threadCount) {
 				omrthread_monitor_wait(_synchronizeMutex);
 			}
+			_synchronizeStallTime += omrtime_hires_clock() - waitStartTime;
+
+			/* All other threads are done with the task */
+			env->getExtensions()->dispatcherStats._syncTime += _synchronizeStallTime;
+			_synchronizeStallTime = 0;
 		} else {
 			if (0 == _threadCount) {
 				omrthread_monitor_notify_all(_synchronizeMutex);
@@ -58,11 +58,45 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+	uint64_t _synchronizeStallTime; /**< time in hi-res ticks threads spent waiting for each other, updated atomically */
+	volatile uintptr_t _parkedThreadCount; /**< threads waiting on _synchronizeMutex after spinning at a synchronization point */
+	uint64_t _syncPointFirstArrivalTime; /**< time the first thread arrived at the current synchronization point */
 
 public:
 	/*
 	 * Function members
 	 */
+private:
+	/**
+	 * Wait, without holding _synchronizeMutex, for the release of the synchronization point the thread arrived at.
+	 * The thread spins for up to synchronizeGCThreadsSpinMicros and only then parks on _synchronizeMutex.
+	 * @param index value of _synchronizeIndex when the thread arrived, which the release increments
+	 * @param releaseOnArrivals true if the thread is also released once all threads have arrived
+	 */
+	void waitForRelease(MM_EnvironmentBase* env, uintptr_t index, bool releaseOnArrivals);
+
+	MMINLINE bool isReleased(uintptr_t index, bool releaseOnArrivals)
+	{
+		return (index != _synchronizeIndex) || (releaseOnArrivals && (_synchronizeCount == _threadCount));
+	}
+
+	/**
+	 * Wake the threads which stopped spinning. Called with _synchronizeMutex held.
+	 */
+	MMINLINE void notifyParkedThreads()
+	{
+		if (0 != _parkedThreadCount) {
+			omrthread_monitor_notify_all(_synchronizeMutex);
+		}
+	}
+
+	/**
+	 * Record the times of the first and the last arrival at a synchronization point, so that slow arrivals
+	 * can be spotted. Called with _synchronizeMutex held.
+	 */
+	void recordFirstArrival(MM_EnvironmentBase* env);
+	void recordLastArrival(MM_EnvironmentBase* env, const char* id);
+
 public:
 	virtual bool handleNextWorkUnit(MM_EnvironmentBase* env);
 	virtual void synchronizeGCThreads(MM_EnvironmentBase* env, const char* id);
@@ -103,7 +137,10 @@ public:
 	          _workUnitIndex(0),
 	          _synchronizeIndex(0),
 	          _synchronizeCount(0),
-	          _synchronizeMutex(NULL)
+	          _synchronizeMutex(NULL),
+	          _synchronizeStallTime(0),
+	          _parkedThreadCount(0),
+	          _syncPointFirstArrivalTime(0)
 	{
 		_typeId = __FUNCTION__;
 	}
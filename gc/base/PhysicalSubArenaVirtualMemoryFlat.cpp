@@ -224,6 +224,8 @@ MM_PhysicalSubArenaVirtualMemoryFlat::expandNoCheck(MM_EnvironmentBase* env, uin
 		}
 
 		_subSpace->heapReconfigured(env);
+
+		_heap->pretouchMemory(env, HEAP_PRETOUCH_EXPAND, lowExpandAddress, highExpandAddress);
 	}
 
 	Assert_MM_true(_lowAddress == _region->getLowAddress());
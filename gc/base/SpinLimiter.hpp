@@ -32,15 +32,15 @@
  * - from MAXIMUM_LOOPS_THRESHOLD to FREE_LOOPS_THRESHOLD spin without extra delay
  * - from FREE_LOOPS_THRESHOLD to 0 spin with dealy
  * - stop spinning if counter reach 0
+ *
+ * The spin time and the number of spins between clock reads can be set by the user, so that
+ * short waits (e.g. GC thread synchronization) can spin for microseconds rather than milliseconds.
  */
 
-/* Maximum number of sequential spins before reading clock */
+/* Default maximum number of sequential spins before reading clock and between reading clock */
 #define FREE_LOOPS_THRESHOLD 10000
 
-/* Maximum number of sequential spins between reading clock */
-#define FREE_LOOPS_BETWEEN_THRESHOLD 10000
-
-/* Maximum allowed spin time in milliseconds */
+/* Default maximum allowed spin time in milliseconds */
 #define MAX_SPIN_TIME_MILLIS 100
 
 class MM_SpinLimiter
@@ -51,6 +51,8 @@ private:
 	MM_EnvironmentBase* _env; /**< thread environment */
 	U_64 _startTime; /**< spinning start time (except time of first pre-spin) */
 	UDATA _counter; /**< number of sequential loops */
+	U_64 _maxSpinTimeMicros; /**< maximum allowed spin time in microseconds */
+	UDATA _freeLoops; /**< number of sequential spins before and between reading clock */
 
 public:
 	/**
@@ -68,13 +70,13 @@ public:
 			U_64 time = omrtime_hires_clock();
 			if (0 == _startTime) {
 				_startTime = time;
-				_counter = FREE_LOOPS_BETWEEN_THRESHOLD;
+				_counter = _freeLoops;
 			} else {
-				if (MAX_SPIN_TIME_MILLIS <= (UDATA)omrtime_hires_delta(
-				            _startTime, time, OMRPORT_TIME_DELTA_IN_MILLISECONDS)) {
+				if (_maxSpinTimeMicros <= omrtime_hires_delta(
+				            _startTime, time, OMRPORT_TIME_DELTA_IN_MICROSECONDS)) {
 					result = false;
 				} else {
-					_counter = FREE_LOOPS_BETWEEN_THRESHOLD;
+					_counter = _freeLoops;
 				}
 			}
 		}
@@ -83,11 +85,29 @@ public:
 
 	MMINLINE void reset()
 	{
-		_counter = FREE_LOOPS_THRESHOLD;
+		_counter = _freeLoops;
 		_startTime = 0;
 	}
 
-	MMINLINE MM_SpinLimiter(MM_EnvironmentBase* env) : _env(env), _startTime(0), _counter(FREE_LOOPS_THRESHOLD) {}
+	MMINLINE MM_SpinLimiter(MM_EnvironmentBase* env)
+	        : _env(env),
+	          _startTime(0),
+	          _counter(FREE_LOOPS_THRESHOLD),
+	          _maxSpinTimeMicros(MAX_SPIN_TIME_MILLIS * 1000),
+	          _freeLoops(FREE_LOOPS_THRESHOLD)
+	{}
+
+	/**
+	 * @param maxSpinTimeMicros maximum allowed spin time in microseconds
+	 * @param freeLoops number of sequential spins before and between reading clock
+	 */
+	MMINLINE MM_SpinLimiter(MM_EnvironmentBase* env, U_64 maxSpinTimeMicros, UDATA freeLoops)
+	        : _env(env),
+	          _startTime(0),
+	          _counter(freeLoops),
+	          _maxSpinTimeMicros(maxSpinTimeMicros),
+	          _freeLoops(freeLoops)
+	{}
 
 protected:
 private:
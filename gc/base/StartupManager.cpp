@@ -47,6 +47,12 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCVERBOSE_BINARY_FORMAT "-Xgc:verboseBinaryFormat"
+#define OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH 24
+#define OMR_XGCADAPTIVE_THREADS "-Xgc:adaptiveGCThreads"
+#define OMR_XGCADAPTIVE_THREADS_LENGTH 22
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -273,6 +279,12 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase* extensions, char* option)
 		}
 	} else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
+	} else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	} else if (0 == strncmp(option, OMR_XGCVERBOSE_BINARY_FORMAT, OMR_XGCVERBOSE_BINARY_FORMAT_LENGTH)) {
+		extensions->verboseBinaryFormat = true;
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVE_THREADS, OMR_XGCADAPTIVE_THREADS_LENGTH)) {
+		extensions->adaptiveGCThreadCount = true;
 	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
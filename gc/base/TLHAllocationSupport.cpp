@@ -43,6 +43,7 @@
 #include "ObjectHeapIteratorAddressOrderedList.hpp"
 #include "objectdescription.h"
 #include "omrcfg.h"
+#include "omrport.h"
 #include "omrutil.h"
 #include <string.h>
 
@@ -118,7 +119,11 @@ MM_TLHAllocationSupport::reconnect(MM_EnvironmentBase* env, bool shouldFlush)
 		setAllZeroes();
 	}
 
-	_tlh->refreshSize = extensions->tlhInitialSize;
+	/* the time until the next refresh would include the disconnected period, so start a fresh sample */
+	_lastRefreshTime = 0;
+	if (!extensions->tlhAdaptiveSizing || (0.0f == _allocationRate)) {
+		_tlh->refreshSize = extensions->tlhInitialSize;
+	}
 }
 
 /**
@@ -141,7 +146,57 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase* env)
 	/* Clear current information accumulated */
 	setAllZeroes();
 
-	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	_lastRefreshTime = 0;
+	if (extensions->tlhAdaptiveSizing && (0.0f != _allocationRate)) {
+		/* the refresh size already tracks the allocation rate of this thread */
+		_tlh->refreshSize = refreshSize;
+	} else {
+		_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
+	}
+}
+
+/**
+ * Recalculate the refresh size from the allocation rate of the owning thread.
+ * The rate is measured as the bytes allocated from the retiring TLH over the time since the previous
+ * refresh, and smoothed so that a single burst does not dominate. The refresh size is then chosen so
+ * that, at that rate, the thread refreshes about once every tlhAdaptiveRefreshInterval microseconds.
+ * Slow or idle threads therefore hold small TLHs, while hot threads get large ones and refresh less often.
+ *
+ * @param bytesAllocated the number of bytes allocated from the TLH being retired
+ */
+void
+MM_TLHAllocationSupport::updateAdaptiveRefreshSize(MM_EnvironmentBase* env, uintptr_t bytesAllocated)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t now = omrtime_hires_clock();
+	uintptr_t interval = extensions->tlhAdaptiveRefreshInterval;
+
+	if (0 != _lastRefreshTime) {
+		uint64_t elapsed = omrtime_hires_delta(_lastRefreshTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		/* sub-microsecond intervals carry no useful rate information */
+		if (0 != elapsed) {
+			float sampleRate = ((float)bytesAllocated * 1000.0f) / (float)elapsed;
+			if ((0.0f == _allocationRate) || (elapsed > (uint64_t)(interval * 16))) {
+				/* first sample, or the thread was quiet for a long time and its history no longer applies */
+				_allocationRate = sampleRate;
+			} else {
+				_allocationRate = MM_Math::weightedAverage(_allocationRate, sampleRate, 0.5f);
+			}
+		}
+	}
+	_lastRefreshTime = now;
+
+	if (0.0f != _allocationRate) {
+		/* _allocationRate is in bytes per millisecond, the interval in microseconds */
+		float desiredSize = (_allocationRate * (float)interval) / 1000.0f;
+		uintptr_t refreshSize = extensions->tlhMaximumSize;
+		if (desiredSize < (float)refreshSize) {
+			refreshSize = MM_Math::roundToCeiling(extensions->tlhIncrementSize, (uintptr_t)desiredSize);
+		}
+		refreshSize = OMR_MAX(extensions->tlhMinimumSize, OMR_MIN(refreshSize, extensions->tlhMaximumSize));
+		setRefreshSize(refreshSize);
+	}
 }
 
 /**
@@ -164,8 +219,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase* env,
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
-		/* increase thread hungriness if we did not refresh */
-		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
+		/* increase thread hungriness if we did not refresh (adaptive sizing follows the allocation rate instead) */
+		if (!extensions->tlhAdaptiveSizing && getRefreshSize() < tlhMaximumSize
+		    && sizeInBytesRequired < tlhMaximumSize) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 		}
 		return false;
@@ -173,6 +229,18 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase* env,
 
 	MM_AllocationStats* stats = _objectAllocationInterface->getAllocationStats();
 
+	if (extensions->tlhAdaptiveSizing) {
+		uintptr_t bytesAllocated = 0;
+		if (NULL != getRealAlloc()) {
+			bytesAllocated = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+		}
+		updateAdaptiveRefreshSize(env, bytesAllocated);
+		stats->_tlhAllocationRate = (uintptr_t)_allocationRate;
+		if (getRefreshSize() > stats->_tlhMaxRefreshSize) {
+			stats->_tlhMaxRefreshSize = getRefreshSize();
+		}
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -283,7 +351,7 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase* env,
 			 * may not give you the size requested */
 			/* Increase thread hungriness */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -82,6 +82,9 @@ private:
 	MM_HeapLinkedFreeHeaderTLH* _abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
 
+	uint64_t _lastRefreshTime; /**< hires clock at the last refresh, used by adaptive sizing (0 if none yet) */
+	float _allocationRate; /**< weighted average of the bytes per millisecond allocated from this TLH */
+
 	const bool
 	        _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
@@ -184,6 +187,8 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase* env);
 
+	void updateAdaptiveRefreshSize(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -197,6 +202,8 @@ private:
 	          _objectAllocationInterface(NULL),
 	          _abandonedList(NULL),
 	          _abandonedListSize(0),
+	          _lastRefreshTime(0),
+	          _allocationRate(0.0f),
 	          _zeroTLH(zeroTLH){};
 
 	/*
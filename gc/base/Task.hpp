@@ -75,6 +75,14 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Estimate how many threads the work of this task can keep busy. The dispatcher does not run the task
+	 * with more threads than this when the thread count is adaptive.
+	 * @note This should not be called by anyone but Dispatcher or ParallelDispatcher
+	 * @return the recommended number of threads, UDATA_MAX if the task has no estimate
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads(MM_EnvironmentBase* env) { return UDATA_MAX; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -120,6 +120,20 @@ MM_WorkPackets::initialize(MM_EnvironmentBase* env)
 		return false;
 	}
 
+	if (_extensions->workStealingMarking) {
+		_workStealingDequeCount = _extensions->gcThreadCount;
+		_workStealingDeques = (MM_WorkStealingDeque*)env->getForge()->allocate(
+		        sizeof(MM_WorkStealingDeque) * _workStealingDequeCount, OMR::GC::AllocationCategory::WORK_PACKETS,
+		        OMR_GET_CALLSITE());
+		if (NULL == _workStealingDeques) {
+			return false;
+		}
+		for (uintptr_t i = 0; i < _workStealingDequeCount; i++) {
+			new (&_workStealingDeques[i]) MM_WorkStealingDeque();
+			_workStealingDeques[i].reset(i + 1);
+		}
+	}
+
 	if (0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -226,6 +240,12 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase* env)
 		_overflowHandler = NULL;
 	}
 
+	if (NULL != _workStealingDeques) {
+		env->getForge()->free(_workStealingDeques);
+		_workStealingDeques = NULL;
+		_workStealingDequeCount = 0;
+	}
+
 	for (uintptr_t i = 0; i < _packetsBlocksTop; i++) {
 		if (NULL != _packetsStart[i]) {
 			env->getForge()->free(_packetsStart[i]);
@@ -265,6 +285,14 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase* env)
 {
 	MM_Packet* packet;
 
+	for (uintptr_t i = 0; i < _workStealingDequeCount; i++) {
+		while (NULL != (packet = _workStealingDeques[i].steal())) {
+			packet->resetData(env);
+			putPacket(env, packet);
+		}
+		_workStealingDeques[i].reset(i + 1);
+	}
+
 	while (NULL != (packet = getPacket(env, &_fullPacketList))) {
 		packet->resetData(env);
 		putPacket(env, packet);
@@ -332,11 +360,85 @@ bool
 MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase* env)
 {
 	bool res = ((!_fullPacketList.isEmpty()) || (!_relativelyFullPacketList.isEmpty())
-	            || (!_nonEmptyPacketList.isEmpty()) || (!_overflowHandler->isEmpty()));
+	            || (!_nonEmptyPacketList.isEmpty()) || (!_overflowHandler->isEmpty()) || stealablePacketAvailable());
 
 	return res;
 }
 
+void
+MM_WorkPackets::setWorkStealingActive(MM_EnvironmentBase* env, bool active)
+{
+	if (NULL != _workStealingDeques) {
+		if (!active) {
+			/* all threads must have drained their deques before the task completed */
+			Assert_MM_false(stealablePacketAvailable());
+		}
+		_workStealingActive = active;
+	}
+}
+
+MM_WorkStealingDeque*
+MM_WorkPackets::getWorkStealingDeque(MM_EnvironmentBase* env)
+{
+	MM_WorkStealingDeque* deque = NULL;
+
+	if (_workStealingActive) {
+		uintptr_t slaveID = env->getSlaveID();
+		if (slaveID < _workStealingDequeCount) {
+			deque = &_workStealingDeques[slaveID];
+		}
+	}
+
+	return deque;
+}
+
+bool
+MM_WorkPackets::stealablePacketAvailable()
+{
+	if (_workStealingActive) {
+		for (uintptr_t i = 0; i < _workStealingDequeCount; i++) {
+			if (!_workStealingDeques[i].isEmpty()) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+MM_Packet*
+MM_WorkPackets::stealPacket(MM_EnvironmentBase* env)
+{
+	MM_Packet* packet = NULL;
+
+	if (_workStealingActive) {
+		MM_WorkStealingDeque* ownDeque = getWorkStealingDeque(env);
+		uintptr_t victim = (NULL != ownDeque) ? ownDeque->nextVictim(_workStealingDequeCount)
+		                                      : (env->getSlaveID() % _workStealingDequeCount);
+
+		/* Start at a random victim to spread thieves out, then sweep so that any available packet is found */
+		for (uintptr_t i = 0; (NULL == packet) && (i < _workStealingDequeCount); i++) {
+			MM_WorkStealingDeque* deque = &_workStealingDeques[victim];
+			if ((deque != ownDeque) && !deque->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.workPacketStealAttempts += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				packet = deque->steal();
+			}
+			victim = (victim + 1) % _workStealingDequeCount;
+		}
+
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsStolen += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+
+	return packet;
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -385,6 +487,17 @@ MM_Packet*
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase* env)
 {
 	MM_Packet* packet;
+	MM_WorkStealingDeque* deque = getWorkStealingDeque(env);
+
+	/* Packets this thread produced itself are the cheapest (and most cache friendly) to consume */
+	if ((NULL != deque) && (NULL != (packet = deque->pop()))) {
+		packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+		env->_workPacketStats.workPacketsPoppedLocal += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		return packet;
+	}
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
@@ -404,6 +517,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase* env)
 		}
 	}
 
+	if (NULL == packet) {
+		packet = stealPacket(env);
+	}
+
 	if (NULL == packet) {
 		packet = getInputPacketFromOverflow(env);
 	}
@@ -766,6 +883,22 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase* env, MM_Packet* packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	MM_WorkStealingDeque* deque = getWorkStealingDeque(env);
+	if ((NULL != deque) && !packet->isEmpty()) {
+		/* Keep the packet local; idle threads will steal it if this thread does not get back to it first */
+		packet->resetOwner();
+		if (deque->push(packet)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsPushedLocal += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			if (_inputListWaitCount > 0) {
+				notifyWaitingThreads(env);
+			}
+			return;
+		}
+	}
+
 	putPacket(env, packet);
 }
 
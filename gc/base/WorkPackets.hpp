@@ -32,6 +32,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 #include "modronopt.h"
 #include "omr.h"
 #include "omrcfg.h"
@@ -89,6 +90,10 @@ protected:
 	MM_WorkPacketOverflow* _overflowHandler;
 	MM_GCExtensionsBase* _extensions;
 
+	MM_WorkStealingDeque* _workStealingDeques; /**< Per GC thread deques of output packets, indexed by slave ID (NULL if work stealing is disabled) */
+	uintptr_t _workStealingDequeCount; /**< Number of entries in _workStealingDeques */
+	volatile bool _workStealingActive; /**< True while a parallel mark task is allowed to use the work stealing deques */
+
 	void emptyToOverflow(MM_EnvironmentBase* env, MM_Packet* packet, MM_OverflowType type);
 	virtual MM_Packet* getInputPacketFromOverflow(MM_EnvironmentBase* env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase* env);
@@ -101,6 +106,24 @@ protected:
 
 	virtual MM_WorkPacketOverflow* createOverflowHandler(MM_EnvironmentBase* env, MM_WorkPackets* workPackets);
 
+	/**
+	 * Return the work stealing deque owned by the current thread.
+	 * @return the deque, or NULL if work stealing is not active for this thread
+	 */
+	MM_WorkStealingDeque* getWorkStealingDeque(MM_EnvironmentBase* env);
+
+	/**
+	 * Determine whether any thread has a packet in its work stealing deque.
+	 * @return true if a packet may be stolen, false otherwise
+	 */
+	bool stealablePacketAvailable();
+
+	/**
+	 * Steal a packet from the deque of another thread, starting at a random victim.
+	 * @return a packet, or NULL if none could be stolen
+	 */
+	MM_Packet* stealPacket(MM_EnvironmentBase* env);
+
 private:
 	/* Methods */
 public:
@@ -124,6 +147,14 @@ public:
 	 */
 	bool inputPacketAvailable(MM_EnvironmentBase* env);
 
+	/**
+	 * Allow or disallow GC threads to exchange output packets through their work stealing deques.
+	 * Must be called by the master thread while no other thread is using the packets.
+	 * Has no effect unless work stealing was enabled at initialization.
+	 * @param active true to start using the deques, false to stop
+	 */
+	void setWorkStealingActive(MM_EnvironmentBase* env, bool active);
+
 	/**
 	 * Returns TRUE if all packets are empty, FALSE otherwise.
 	 * @ingroup GC_Base
@@ -215,7 +246,10 @@ public:
 	          _inputListMonitor(NULL),
 	          _inputListWaitCount(0),
 	          _inputListDoneIndex(0),
-	          _overflowHandler(NULL)
+	          _overflowHandler(NULL),
+	          _workStealingDeques(NULL),
+	          _workStealingDequeCount(0),
+	          _workStealingActive(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "modronopt.h"
+#include "omrcfg.h"
+
+class MM_Packet;
+
+/**
+ * Fixed capacity Chase-Lev work stealing deque of work packets.
+ *
+ * Only the owning thread may call push() and pop(), which operate on the bottom of the
+ * deque without taking any lock. Any thread may call steal(), which removes the oldest
+ * entry from the top of the deque with a single compare and swap. When the deque is full,
+ * push() fails and the caller is expected to fall back to the shared packet lists.
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+	/* Data members / types */
+public:
+	enum
+	{
+		_capacity = 64 /**< Maximum number of packets held by a deque, must be a power of 2 */
+	};
+
+protected:
+private:
+	volatile uintptr_t _top; /**< Index of the oldest entry, only ever incremented (by thieves or the owner taking the last entry) */
+	volatile uintptr_t _bottom; /**< Index one past the newest entry, only written by the owner */
+	MM_Packet* volatile _packets[_capacity]; /**< Circular buffer of packets */
+	uintptr_t _stealSeed; /**< Random state used by the owner when selecting a victim to steal from */
+
+	/* Methods */
+public:
+	/**
+	 * Push a packet on the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet the packet to push
+	 * @return true if the packet was pushed, false if the deque is full
+	 */
+	MMINLINE bool push(MM_Packet* packet)
+	{
+		uintptr_t bottom = _bottom;
+		uintptr_t top = _top;
+
+		if ((bottom - top) >= _capacity) {
+			return false;
+		}
+
+		_packets[bottom & (_capacity - 1)] = packet;
+		/* the packet must be visible before a thief can observe the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet off the bottom of the deque. Must only be called by the owning thread.
+	 * @return a packet, or NULL if the deque is empty or the last packet was stolen
+	 */
+	MMINLINE MM_Packet* pop()
+	{
+		uintptr_t bottom = _bottom - 1;
+		_bottom = bottom;
+		/* publish the reservation of the bottom slot before reading top */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+
+		if ((intptr_t)(bottom - top) < 0) {
+			/* deque was empty */
+			_bottom = bottom + 1;
+			return NULL;
+		}
+
+		MM_Packet* packet = _packets[bottom & (_capacity - 1)];
+		if (bottom == top) {
+			/* last entry - race any thieves for it */
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+			_bottom = top + 1;
+		}
+
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet from the top of the deque. May be called by any thread.
+	 * @return a packet, or NULL if the deque was empty or another thread won the race
+	 */
+	MMINLINE MM_Packet* steal()
+	{
+		uintptr_t top = _top;
+		/* top must be read before bottom */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+
+		if ((intptr_t)(bottom - top) <= 0) {
+			return NULL;
+		}
+
+		MM_Packet* packet = _packets[top & (_capacity - 1)];
+		if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+			return NULL;
+		}
+
+		return packet;
+	}
+
+	/**
+	 * @return true if the deque appears empty (the answer may be stale by the time it is used)
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	/**
+	 * Select the next victim to steal from. Must only be called by the owning thread.
+	 * @param range the number of candidate victims
+	 * @return a pseudo-random index in [0, range)
+	 */
+	MMINLINE uintptr_t nextVictim(uintptr_t range)
+	{
+		/* xorshift - cheap and good enough to spread thieves over victims */
+		uintptr_t seed = _stealSeed;
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		_stealSeed = seed;
+		return seed % range;
+	}
+
+	/**
+	 * Reset the deque to empty. Must only be called when no other thread is accessing the deque.
+	 * @param seed initial value for the victim selection random state
+	 */
+	void reset(uintptr_t seed)
+	{
+		_top = 0;
+		_bottom = 0;
+		_stealSeed = (0 == seed) ? 1 : seed;
+	}
+
+	/**
+	 * Create a WorkStealingDeque object.
+	 */
+	MM_WorkStealingDeque() : MM_BaseNonVirtual(), _top(0), _bottom(0), _stealSeed(1)
+	{
+		_typeId = __FUNCTION__;
+		for (uintptr_t i = 0; i < _capacity; i++) {
+			_packets[i] = NULL;
+		}
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -151,6 +151,7 @@ getContractReasonAsString(ContractReason reason)
 	case SATISFY_EXPAND: return "enable expansion";
 	case HEAP_RESIZE: return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT: return "forced nursery contract";
+	case SCAV_PAUSE_ABOVE_TARGET: return "scavenge pause above target";
 	default: return "unknown";
 	}
 }
@@ -170,6 +171,7 @@ getExpandReasonAsString(ExpandReason reason)
 	case EXPAND_DESPERATE: return "satisfy allocation request";
 	case FORCED_NURSERY_EXPAND: return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS: return "hint from previous runs";
+	case PROMOTION_HEADROOM: return "insufficient free space for promotion";
 	default: return "unknown";
 	}
 }
@@ -203,4 +205,46 @@ getSystemGCReasonAsString(uint32_t gcCode)
 	}
 }
 
+const char*
+getRootScannerEntityAsString(RootScannerEntity entity)
+{
+	switch (entity) {
+	case RootScannerEntity_None: return "none";
+	case RootScannerEntity_ScavengeRememberedSet: return "scavenge remembered set";
+	case RootScannerEntity_Classes: return "classes";
+	case RootScannerEntity_VMClassSlots: return "vm class slots";
+	case RootScannerEntity_PermanentClasses: return "permanent classes";
+	case RootScannerEntity_ClassLoaders: return "class loaders";
+	case RootScannerEntity_Threads: return "threads";
+	case RootScannerEntity_FinalizableObjects: return "finalizable objects";
+	case RootScannerEntity_UnfinalizedObjects: return "unfinalized objects";
+	case RootScannerEntity_OwnableSynchronizerObjects: return "ownable synchronizer objects";
+	case RootScannerEntity_StringTable: return "string table";
+	case RootScannerEntity_JNIGlobalReferences: return "jni global references";
+	case RootScannerEntity_JNIWeakGlobalReferences: return "jni weak global references";
+	case RootScannerEntity_DoubleMappedObjects: return "double mapped objects";
+	case RootScannerEntity_DebuggerReferences: return "debugger references";
+	case RootScannerEntity_DebuggerClassReferences: return "debugger class references";
+	case RootScannerEntity_MonitorReferences: return "monitor references";
+	case RootScannerEntity_WeakReferenceObjects: return "weak reference objects";
+	case RootScannerEntity_SoftReferenceObjects: return "soft reference objects";
+	case RootScannerEntity_PhantomReferenceObjects: return "phantom reference objects";
+	case RootScannerEntity_JVMTIObjectTagTables: return "jvmti object tag tables";
+	case RootScannerEntity_NonCollectableObjects: return "non collectable objects";
+	case RootScannerEntity_RememberedSet: return "remembered set";
+	case RootScannerEntity_MemoryAreaObjects: return "memory area objects";
+	case RootScannerEntity_MetronomeRememberedSet: return "metronome remembered set";
+	case RootScannerEntity_ClassesComplete: return "classes complete";
+	case RootScannerEntity_WeakReferenceObjectsComplete: return "weak reference objects complete";
+	case RootScannerEntity_SoftReferenceObjectsComplete: return "soft reference objects complete";
+	case RootScannerEntity_PhantomReferenceObjectsComplete: return "phantom reference objects complete";
+	case RootScannerEntity_UnfinalizedObjectsComplete: return "unfinalized objects complete";
+	case RootScannerEntity_OwnableSynchronizerObjectsComplete: return "ownable synchronizer objects complete";
+	case RootScannerEntity_MonitorLookupCaches: return "monitor lookup caches";
+	case RootScannerEntity_MonitorLookupCachesComplete: return "monitor lookup caches complete";
+	case RootScannerEntity_MonitorReferenceObjectsComplete: return "monitor reference objects complete";
+	default: return "unknown";
+	}
+}
+
 } /* extern "C" */
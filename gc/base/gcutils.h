@@ -28,6 +28,7 @@
 #if !defined(GCUTILS_H_)
 #define GCUTILS_H_
 
+#include "RootScannerTypes.h"
 #include "j9nongenerated.h"
 #include "modronbase.h"
 #include "omrcfg.h"
@@ -69,6 +70,9 @@ getLoaResizeReasonAsString(LoaResizeReason reason);
 const char*
 getSystemGCReasonAsString(uint32_t gcCode);
 
+const char*
+getRootScannerEntityAsString(RootScannerEntity entity);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif /* __cplusplus */
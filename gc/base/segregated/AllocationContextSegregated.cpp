@@ -25,6 +25,7 @@
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "HeapRegionQueue.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -51,6 +52,7 @@ MM_AllocationContextSegregated::newInstance(MM_EnvironmentBase* env,
 	        sizeof(MM_AllocationContextSegregated), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
 	if (allocCtxt) {
 		new (allocCtxt) MM_AllocationContextSegregated(env, gam, regionPool);
+		allocCtxt->_magazineDepot = gam->getMagazineDepot();
 		if (!allocCtxt->initialize(env)) {
 			allocCtxt->kill(env);
 			allocCtxt = NULL;
@@ -282,6 +284,11 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase* env, uintpt
 	uintptr_t replenishSize = segregatedAllocationInterface->getReplenishSize(env, sizeInBytesRequired);
 	uintptr_t preAllocatedBytes = 0;
 
+	/* Another thread may have parked a magazine of this size class, which is cheaper than going to the region */
+	if (segregatedAllocationInterface->replenishCacheFromDepot(env, sizeInBytesRequired, _magazineDepot)) {
+		return (uintptr_t*)segregatedAllocationInterface->allocateFromCache(env, sizeInBytesRequired);
+	}
+
 	while (!done) {
 
 		/* If we have a region, attempt to replenish the ACL's cache */
@@ -295,6 +302,8 @@ MM_AllocationContextSegregated::preAllocateSmall(MM_EnvironmentBase* env, uintpt
 				if (shouldPreMarkSmallCells(env)) {
 					_markingScheme->preMarkSmallCells(env, region, cellList, preAllocatedBytes);
 				}
+				preAllocatedBytes = segregatedAllocationInterface->parkMagazines(
+				        env, sizeInBytesRequired, cellList, preAllocatedBytes, _magazineDepot);
 				segregatedAllocationInterface->replenishCache(env, sizeInBytesRequired, cellList,
 				                                              preAllocatedBytes);
 				result = (uintptr_t*)segregatedAllocationInterface->allocateFromCache(
@@ -37,6 +37,7 @@ class MM_GlobalAllocationManagerSegregated;
 class MM_HeapRegionDescriptorSegregated;
 class MM_HeapRegionQueue;
 class MM_HeapRegionDescriptorSegregated;
+class MM_SegregatedMagazineDepot;
 class MM_SegregatedMarkingScheme;
 class MM_RegionPoolSegregated;
 
@@ -52,6 +53,7 @@ protected:
 private:
 	MM_HeapRegionDescriptorSegregated* _arrayletRegion;
 	MM_SegregatedMarkingScheme* _markingScheme;
+	MM_SegregatedMagazineDepot* _magazineDepot; /**< Depot shared by all contexts, checked before taking the small allocation lock */
 	omrthread_monitor_t _mutexSmallAllocations; /**< Allocation lock for small size class */
 	omrthread_monitor_t _mutexArrayletAllocations; /**< Allocation lock for arraylet size class */
 	volatile uint32_t _count; /**< how many threads are attached to me */
@@ -114,6 +116,7 @@ protected:
 	          _regionPool(regionPool),
 	          _arrayletRegion(NULL),
 	          _markingScheme(NULL),
+	          _magazineDepot(NULL),
 	          _mutexSmallAllocations(NULL),
 	          _mutexArrayletAllocations(NULL),
 	          _count(0),
@@ -177,4 +177,11 @@ MM_GlobalAllocationManagerSegregated::flushCachedFullRegions(MM_EnvironmentBase*
 	}
 }
 
+void
+MM_GlobalAllocationManagerSegregated::flushAllocationContexts(MM_EnvironmentBase* env)
+{
+	MM_GlobalAllocationManager::flushAllocationContexts(env);
+	_magazineDepot.flush();
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -24,6 +24,7 @@
 #define GLOBALALLOCATIONMANAGERSEGREGATED_HPP_
 
 #include "GlobalAllocationManager.hpp"
+#include "SegregatedMagazineDepot.hpp"
 #include "omrcfg.h"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -41,6 +42,7 @@ class MM_GlobalAllocationManagerSegregated : public MM_GlobalAllocationManager
 	 */
 private:
 	MM_RegionPoolSegregated* _regionPool;
+	MM_SegregatedMagazineDepot _magazineDepot; /**< Magazines of pre-allocated cells shared by all contexts */
 
 protected:
 public:
@@ -96,7 +98,14 @@ public:
 	 */
 	void flushCachedFullRegions(MM_EnvironmentBase* env);
 
+	/**
+	 * Flush each context and drop the magazines parked in the depot, since they may have been carved
+	 * from regions which are about to be swept.
+	 */
+	virtual void flushAllocationContexts(MM_EnvironmentBase* env);
+
 	MM_RegionPoolSegregated* getRegionPool() { return _regionPool; }
+	MM_SegregatedMagazineDepot* getMagazineDepot() { return &_magazineDepot; }
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
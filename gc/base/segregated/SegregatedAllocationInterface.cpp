@@ -34,6 +34,7 @@
 #include "MemorySubSpace.hpp"
 #include "ModronAssertions.h"
 #include "ObjectHeapIteratorSegregated.hpp"
+#include "SegregatedMagazineDepot.hpp"
 #include "SizeClasses.hpp"
 #include "objectdescription.h"
 
@@ -370,13 +371,100 @@ MM_SegregatedAllocationInterface::getReplenishSize(MM_EnvironmentBase* env, uint
 {
 	/* If cached allocations are disabled, we only allow a replenish the size of the requested allocation. */
 	if (_cachedAllocationsEnabled) {
+		MM_GCExtensionsBase* extensions = env->getExtensions();
 		uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+		if (0 != extensions->allocationCacheMagazineSize) {
+			/* carve a whole batch of magazines at once, all but one are handed to other threads through the depot */
+			return getMagazineSize(env, sizeClass) * OMR_MAX(1, extensions->allocationCacheMagazineBatch);
+		}
 		return _replenishSizes[sizeClass];
 	} else {
 		return sizeInBytes;
 	}
 }
 
+/**
+ * Replenishes the empty cache for the size class of the given sizeInBytes with a magazine taken from the depot.
+ * This does not take any lock, so it is attempted before going to the allocation context's regions.
+ * @param sizeInBytes The size in bytes of a single cell
+ * @param depot The depot to take the magazine from
+ * @return true if the cache was replenished, false if magazines are disabled or the depot had none for the size class
+ */
+bool
+MM_SegregatedAllocationInterface::replenishCacheFromDepot(MM_EnvironmentBase* env,
+                                                          uintptr_t sizeInBytes,
+                                                          MM_SegregatedMagazineDepot* depot)
+{
+	if (!_cachedAllocationsEnabled || (0 == env->getExtensions()->allocationCacheMagazineSize)) {
+		return false;
+	}
+
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	void* magazine = depot->pop(sizeClass);
+	if (NULL == magazine) {
+		return false;
+	}
+
+	/* the magazine was made walkable when it was parked, so its header holds the size of the run */
+	uintptr_t magazineSize = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(magazine)->getSize();
+	replenishCache(env, sizeInBytes, magazine, magazineSize);
+	_stats._magazineDepotRefillCount += 1;
+	return true;
+}
+
+/**
+ * Parks whole magazines from the end of a freshly pre-allocated run of cells in the depot, so that other
+ * threads can refill their caches without going to the regions. At least one magazine is always kept and
+ * whatever could not be parked (the depot being full) stays with the caller.
+ * @param sizeInBytes The size in bytes of a single cell
+ * @param cellList The first cell of the pre-allocated run
+ * @param cellListSize The total size of the pre-allocated run
+ * @param depot The depot to park magazines in
+ * @return The size of the run starting at cellList which is left for the caller's cache
+ */
+uintptr_t
+MM_SegregatedAllocationInterface::parkMagazines(MM_EnvironmentBase* env,
+                                                uintptr_t sizeInBytes,
+                                                void* cellList,
+                                                uintptr_t cellListSize,
+                                                MM_SegregatedMagazineDepot* depot)
+{
+	if (!_cachedAllocationsEnabled || (0 == env->getExtensions()->allocationCacheMagazineSize)) {
+		return cellListSize;
+	}
+
+	bool const compressed = env->compressObjectReferences();
+	uintptr_t sizeClass = _sizeClasses->getSizeClass(sizeInBytes);
+	uintptr_t magazineSize = getMagazineSize(env, sizeClass);
+	uintptr_t cacheSize = cellListSize;
+
+	_stats._magazineRegionRefillCount += 1;
+
+	while (cacheSize >= (2 * magazineSize)) {
+		MM_HeapLinkedFreeHeader* magazine = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(
+		        (void*)((uintptr_t)cellList + cacheSize - magazineSize));
+		/* make the magazine walkable before it becomes visible to other threads */
+		magazine->setSize(magazineSize);
+		magazine->setNext(NULL, compressed);
+		if (!depot->push(sizeClass, magazine)) {
+			break;
+		}
+		cacheSize -= magazineSize;
+	}
+
+	return cacheSize;
+}
+
+/**
+ * @return The size in bytes of a magazine of the given size class, a whole number of cells and at least one cell.
+ */
+uintptr_t
+MM_SegregatedAllocationInterface::getMagazineSize(MM_EnvironmentBase* env, uintptr_t sizeClass)
+{
+	uintptr_t cellSize = _sizeClasses->getCellSize(sizeClass);
+	return OMR_MAX(1, env->getExtensions()->allocationCacheMagazineSize / cellSize) * cellSize;
+}
+
 void
 MM_SegregatedAllocationInterface::enableCachedAllocations(MM_EnvironmentBase* env)
 {
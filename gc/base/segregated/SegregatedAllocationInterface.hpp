@@ -30,6 +30,7 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+class MM_SegregatedMagazineDepot;
 class MM_SizeClasses;
 
 typedef struct SegregatedAllocationCacheStats
@@ -112,6 +113,12 @@ public:
 	void* allocateFromCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
 	void replenishCache(MM_EnvironmentBase* env, uintptr_t sizeInBytes, void* cacheMemory, uintptr_t cacheSize);
 	uintptr_t getReplenishSize(MM_EnvironmentBase* env, uintptr_t sizeInBytes);
+	bool replenishCacheFromDepot(MM_EnvironmentBase* env, uintptr_t sizeInBytes, MM_SegregatedMagazineDepot* depot);
+	uintptr_t parkMagazines(MM_EnvironmentBase* env,
+	                        uintptr_t sizeInBytes,
+	                        void* cellList,
+	                        uintptr_t cellListSize,
+	                        MM_SegregatedMagazineDepot* depot);
 
 	virtual void enableCachedAllocations(MM_EnvironmentBase* env);
 	virtual void disableCachedAllocations(MM_EnvironmentBase* env);
@@ -130,6 +137,7 @@ protected:
 
 private:
 	void updateFrequentObjectsStats(MM_EnvironmentBase* env, uintptr_t sizeClass);
+	uintptr_t getMagazineSize(MM_EnvironmentBase* env, uintptr_t sizeClass);
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDMAGAZINEDEPOT_HPP_)
+#define SEGREGATEDMAGAZINEDEPOT_HPP_
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "modronopt.h"
+#include "omrcfg.h"
+#include "sizeclasses.h"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+/**
+ * Global depot of cell magazines, shared by all threads without taking any lock.
+ *
+ * A magazine is a contiguous run of pre-allocated (and, if required, pre-marked) cells of a single
+ * size class which was carved from a region but not yet installed in a thread's allocation cache.
+ * The depot only stores the address of the first cell; the owner of a magazine must make it walkable
+ * (a hole carrying the size of the run) before pushing it, so the depot itself never touches the heap.
+ *
+ * Each size class has a small fixed array of slots. push() and pop() linearly probe the slots and
+ * claim one with a single compare and swap. When all slots are full, push() fails and the caller keeps
+ * the cells for itself.
+ * @ingroup GC_Modron_Base
+ */
+class MM_SegregatedMagazineDepot : public MM_BaseNonVirtual
+{
+	/* Data members / types */
+public:
+	enum
+	{
+		_slotsPerSizeClass = 16 /**< Maximum number of magazines parked in the depot per size class */
+	};
+
+protected:
+private:
+	volatile uintptr_t _magazines[OMR_SIZECLASSES_NUM_SMALL + 1]
+	                             [_slotsPerSizeClass]; /**< Parked magazines per size class, 0 for an empty slot */
+
+	/* Methods */
+public:
+	/**
+	 * Park a magazine in the depot. May be called by any thread.
+	 * @param sizeClass the size class of the cells in the magazine
+	 * @param magazine the first cell of the magazine, already made walkable
+	 * @return true if the magazine was parked, false if the depot is full for the size class
+	 */
+	MMINLINE bool push(uintptr_t sizeClass, void* magazine)
+	{
+		volatile uintptr_t* slots = _magazines[sizeClass];
+		for (uintptr_t i = 0; i < _slotsPerSizeClass; i++) {
+			if ((0 == slots[i])
+			    && (0 == MM_AtomicOperations::lockCompareExchange(&slots[i], 0, (uintptr_t)magazine))) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Take a magazine out of the depot. May be called by any thread.
+	 * @param sizeClass the size class of the cells wanted
+	 * @return the first cell of a magazine, or NULL if the depot is empty for the size class
+	 */
+	MMINLINE void* pop(uintptr_t sizeClass)
+	{
+		volatile uintptr_t* slots = _magazines[sizeClass];
+		for (uintptr_t i = 0; i < _slotsPerSizeClass; i++) {
+			uintptr_t magazine = slots[i];
+			if ((0 != magazine)
+			    && (magazine == MM_AtomicOperations::lockCompareExchange(&slots[i], magazine, 0))) {
+				return (void*)magazine;
+			}
+		}
+		return NULL;
+	}
+
+	/**
+	 * Drop every parked magazine. The cells are already walkable, so they are simply left for the
+	 * next sweep to reclaim. Must be called before the regions the magazines were carved from are swept.
+	 */
+	void flush()
+	{
+		for (uintptr_t sizeClass = 0; sizeClass <= OMR_SIZECLASSES_NUM_SMALL; sizeClass++) {
+			for (uintptr_t i = 0; i < _slotsPerSizeClass; i++) {
+				MM_AtomicOperations::set(&_magazines[sizeClass][i], 0);
+			}
+		}
+	}
+
+	/**
+	 * Create a SegregatedMagazineDepot object.
+	 */
+	MM_SegregatedMagazineDepot() : MM_BaseNonVirtual()
+	{
+		_typeId = __FUNCTION__;
+		for (uintptr_t sizeClass = 0; sizeClass <= OMR_SIZECLASSES_NUM_SMALL; sizeClass++) {
+			for (uintptr_t i = 0; i < _slotsPerSizeClass; i++) {
+				_magazines[sizeClass][i] = 0;
+			}
+		}
+	}
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDMAGAZINEDEPOT_HPP_ */
@@ -45,6 +45,7 @@
 #include "HeapStats.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
+#include "Math.hpp"
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -263,6 +264,17 @@ public:
 bool
 MM_CompactScheme::initialize(MM_EnvironmentBase* env)
 {
+	/* keep the phase times of every GC thread, so that verbose output can show how evenly the work was spread */
+	MM_CompactStats* compactStats = &_extensions->globalGCStats.compactStats;
+	uintptr_t threadStatsSize = sizeof(MM_CompactThreadStats) * _extensions->gcThreadCount;
+	compactStats->_threadStats = (MM_CompactThreadStats*)env->getForge()->allocate(
+	        threadStatsSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == compactStats->_threadStats) {
+		return false;
+	}
+	memset(compactStats->_threadStats, 0, threadStatsSize);
+	compactStats->_threadStatsCount = _extensions->gcThreadCount;
+
 	return _delegate.initialize(env, _omrVM, _markMap, this);
 }
 
@@ -270,6 +282,13 @@ void
 MM_CompactScheme::tearDown(MM_EnvironmentBase* env)
 {
 	_delegate.tearDown(env);
+
+	MM_CompactStats* compactStats = &_extensions->globalGCStats.compactStats;
+	if (NULL != compactStats->_threadStats) {
+		env->getForge()->free(compactStats->_threadStats);
+		compactStats->_threadStats = NULL;
+		compactStats->_threadStatsCount = 0;
+	}
 }
 
 /**
@@ -366,9 +385,11 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard* env, bool singleThr
 	GC_HeapRegionIteratorStandard regionCounter(_rootManager);
 	MM_HeapRegionDescriptorStandard* region = NULL;
 	uintptr_t number_of_regions = 0;
+	uintptr_t committedSize = 0;
 	while (NULL != (region = regionCounter.nextRegion())) {
 		if (region->isCommitted()) {
 			number_of_regions += 1;
+			committedSize += region->getSize();
 		}
 	}
 
@@ -381,7 +402,13 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard* env, bool singleThr
 	} else {
 		min_subarea_size = _heap->getMaximumPhysicalRange();
 	}
-	uintptr_t size = (DESIRED_SUBAREA_SIZE >= min_subarea_size) ? DESIRED_SUBAREA_SIZE : min_subarea_size;
+	/* Threads claim subareas one at a time, so cut the heap finely enough that every thread gets
+	 * several of them and no single large subarea holds the phase barriers back.
+	 */
+	uintptr_t balancedSize = committedSize / (env->_currentTask->getThreadCount() * DESIRED_SUBAREAS_PER_COMPACT_THREAD);
+	balancedSize = MM_Math::roundToCeiling(sizeof_page, OMR_MAX(balancedSize, MINIMUM_SUBAREA_SIZE));
+	uintptr_t size = OMR_MIN(balancedSize, DESIRED_SUBAREA_SIZE);
+	size = OMR_MAX(size, min_subarea_size);
 
 	/* Single threaded pass to set tentative sub area limits tentative limits are
 	 * listed in freeChunk field. This field will be reset during the third pass.
@@ -494,9 +521,11 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard* env)
 {
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		MM_HeapRegionDescriptorStandard* region = NULL;
+		uintptr_t i = 0;
 
 		/* Finally iterate over all memory pools and reset in preparation for
-		 * rebuild of free list at end of compaction
+		 * rebuild of free list at end of compaction. Also record the region of each subarea,
+		 * so that the move and fixup phases can hand out subareas from a single index.
 		 */
 		GC_HeapRegionIteratorStandard regionIterator2(_rootManager);
 		while (NULL != (region = regionIterator2.nextRegion())) {
@@ -506,7 +535,17 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard* env)
 			MM_MemorySubSpace* subspace = region->getSubSpace();
 			MM_MemoryPool* memoryPool = subspace->getMemoryPool();
 			memoryPool->reset(MM_MemoryPool::forCompact);
+
+			uintptr_t segmentStart = i;
+			do {
+				_subAreaTable[i].region = region;
+				_subAreaTable[i].segmentStart = segmentStart;
+			} while (SubAreaEntry::end_segment != _subAreaTable[i++].state);
 		}
+		Assert_MM_true(SubAreaEntry::end_heap == _subAreaTable[i].state);
+		_subAreaCount = i;
+		_moveSubAreaIndex = 0;
+		_fixupSubAreaIndex = 0;
 
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
@@ -549,6 +588,8 @@ MM_CompactScheme::compact(MM_EnvironmentBase* envBase, bool rebuildMarkBits, boo
 		singleThreaded = true;
 	}
 
+	env->_compactStats._compactThreads = 1;
+	env->_compactStats._slaveID = env->getSlaveID();
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
@@ -560,6 +601,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase* envBase, bool rebuildMarkBits, boo
 		env->_compactStats._moveStartTime = omrtime_hires_clock();
 		moveObjects(env, objectCount, byteCount, skippedObjectCount);
 		env->_compactStats._moveEndTime = omrtime_hires_clock();
+		env->_compactStats._moveTime = omrtime_hires_delta(env->_compactStats._moveStartTime,
+		                                                   env->_compactStats._moveEndTime,
+		                                                   OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		env->_compactStats._maxMoveTime = env->_compactStats._moveTime;
 
 		if (!singleThreaded) {
 			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
@@ -571,6 +616,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase* envBase, bool rebuildMarkBits, boo
 		fixupObjects(env, fixupObjectsCount);
 
 		env->_compactStats._fixupEndTime = omrtime_hires_clock();
+		env->_compactStats._fixupTime = omrtime_hires_delta(env->_compactStats._fixupStartTime,
+		                                                    env->_compactStats._fixupEndTime,
+		                                                    OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		env->_compactStats._maxFixupTime = env->_compactStats._fixupTime;
 
 		if (singleThreaded) {
 			env->_currentTask->releaseSynchronizedGCThreads(env);
@@ -581,6 +630,10 @@ MM_CompactScheme::compact(MM_EnvironmentBase* envBase, bool rebuildMarkBits, boo
 	env->_compactStats._rootFixupStartTime = omrtime_hires_clock();
 	_delegate.fixupRoots(env, this);
 	env->_compactStats._rootFixupEndTime = omrtime_hires_clock();
+	env->_compactStats._rootFixupTime = omrtime_hires_delta(env->_compactStats._rootFixupStartTime,
+	                                                        env->_compactStats._rootFixupEndTime,
+	                                                        OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	env->_compactStats._maxRootFixupTime = env->_compactStats._rootFixupTime;
 
 	MM_AtomicOperations::sync();
 
@@ -805,25 +858,20 @@ MM_CompactScheme::moveObjects(MM_EnvironmentStandard* env,
                               uintptr_t& byteCount,
                               uintptr_t& skippedObjectCount)
 {
-	MM_HeapRegionManager* regionManager = _heap->getHeapRegionManager();
-	GC_HeapRegionIteratorStandard regionIterator(regionManager);
-	MM_HeapRegionDescriptorStandard* region = NULL;
-	SubAreaEntry* subAreaTable = _subAreaTable;
+	uintptr_t index = 0;
 
-	while (NULL != (region = regionIterator.nextRegion())) {
-		if (!region->isCommitted() || (0 == region->getSize())) {
-			continue;
-		}
-		intptr_t i;
-		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
-			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::evacuating)) {
-				evacuateSubArea(env, region, subAreaTable, i, objectCount, byteCount,
-				                skippedObjectCount);
-			}
+	/* Subareas are claimed in address order, so a subarea is only evacuated after every
+	 * lower subarea of its region (a potential destination) has been claimed.
+	 */
+	while (_subAreaCount != (index = claimSubArea(&_moveSubAreaIndex))) {
+		SubAreaEntry* entry = &_subAreaTable[index];
+		if (SubAreaEntry::end_segment != entry->state) {
+			SubAreaEntry* subAreaTable = &_subAreaTable[entry->segmentStart];
+			entry->currentAction = SubAreaEntry::evacuating;
+			evacuateSubArea(env, entry->region, subAreaTable, index - entry->segmentStart, objectCount,
+			                byteCount, skippedObjectCount);
+			env->_compactStats._movedSubAreas += 1;
 		}
-		/* Number of regions in regionTable, including
-         * the end_segment region, is i+1 */
-		subAreaTable += (i + 1);
 	}
 }
 
@@ -1386,25 +1434,17 @@ MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 void
 MM_CompactScheme::fixupObjects(MM_EnvironmentStandard* env, uintptr_t& objectCount)
 {
-	MM_HeapRegionManager* regionManager = _heap->getHeapRegionManager();
-	GC_HeapRegionIteratorStandard regionIterator(regionManager);
-	MM_HeapRegionDescriptorStandard* region = NULL;
-	SubAreaEntry* subAreaTable = _subAreaTable;
-
-	while (NULL != (region = regionIterator.nextRegion())) {
-		if (!region->isCommitted() || (0 == region->getSize())) {
-			continue;
+	uintptr_t index = 0;
+
+	/* Forwarding addresses are final once the move phase is over, so subareas are fixed up independently */
+	while (_subAreaCount != (index = claimSubArea(&_fixupSubAreaIndex))) {
+		SubAreaEntry* entry = &_subAreaTable[index];
+		if (SubAreaEntry::end_segment != entry->state) {
+			entry->currentAction = SubAreaEntry::fixing_up;
+			fixupSubArea(env, entry->firstObject, _subAreaTable[index + 1].firstObject,
+			             SubAreaEntry::fixup_only == entry->state, objectCount);
+			env->_compactStats._fixupSubAreas += 1;
 		}
-		intptr_t i;
-		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
-			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_up)) {
-				fixupSubArea(env, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject,
-				             subAreaTable[i].state == SubAreaEntry::fixup_only, objectCount);
-			}
-		}
-		/* Number of regions in regionTable, including
-         * the end_segment region, is i+1 */
-		subAreaTable += (i + 1);
 	}
 }
 
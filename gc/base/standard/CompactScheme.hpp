@@ -28,6 +28,7 @@
 
 #if defined(OMR_GC_MODRON_COMPACTION)
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "CompactDelegate.hpp"
 #include "Debug.hpp"
@@ -94,6 +95,8 @@ private:
 		omrobjectptr_t freeChunk;
 		volatile uintptr_t state;
 		volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		MM_HeapRegionDescriptorStandard* region; /**< the region containing the subarea */
+		uintptr_t segmentStart; /**< table index of the first subarea of the containing region */
 
 		/* legal values for currentAction */
 		enum
@@ -144,6 +147,9 @@ protected:
 	omrobjectptr_t _compactFrom;
 	omrobjectptr_t _compactTo;
 	MM_CompactDelegate _delegate;
+	uintptr_t _subAreaCount; /**< Number of entries in the subAreaTable, up to but not including the end_heap entry */
+	volatile uintptr_t _moveSubAreaIndex; /**< Index of the next subarea to be claimed by a thread for evacuation */
+	volatile uintptr_t _fixupSubAreaIndex; /**< Index of the next subarea to be claimed by a thread for fixup */
 
 public:
 	/*
@@ -313,6 +319,25 @@ protected:
      */
 	bool changeSubAreaAction(MM_EnvironmentBase* env, SubAreaEntry* entry, uintptr_t newAction);
 
+	/**
+     * Claim the next subarea of a phase. Subareas are handed out in address order, one at a time,
+     * so that threads which finish early keep taking work instead of waiting at the phase barrier.
+     *
+     * @param[in/out] subAreaIndex the shared claim index of the phase
+     * @return the table index of the claimed subarea, or _subAreaCount if all have been claimed
+     */
+	MMINLINE uintptr_t claimSubArea(volatile uintptr_t* subAreaIndex)
+	{
+		uintptr_t index = _subAreaCount;
+		if (*subAreaIndex < _subAreaCount) {
+			index = MM_AtomicOperations::add(subAreaIndex, 1) - 1;
+			if (index >= _subAreaCount) {
+				index = _subAreaCount;
+			}
+		}
+		return index;
+	}
+
 public:
 	static MM_CompactScheme* newInstance(MM_EnvironmentBase* env, MM_MarkingScheme* markingScheme);
 
@@ -346,7 +371,10 @@ public:
 	          _markMap(markingScheme->getMarkMap()),
 	          _subAreaTableSize(0),
 	          _subAreaTable(NULL),
-	          _delegate()
+	          _delegate(),
+	          _subAreaCount(0),
+	          _moveSubAreaIndex(0),
+	          _fixupSubAreaIndex(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -642,6 +642,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase* env, void* heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			summarizeCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -1102,6 +1103,10 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase* env, uintptr_t* byte
 
 	MM_MarkMap* markMap = _markingScheme->getMarkMap();
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t cleanStartTime = omrtime_hires_clock();
+	uintptr_t cardsSkippedBefore = env->_cardCleaningStats._cardsSkipped;
+
 	for (; (nextDirtyCard = getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
@@ -1117,6 +1122,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase* env, uintptr_t* byte
 		/* Clean the card before we trace into it */
 		finalCleanCard(nextDirtyCard);
 		cards += 1;
+		env->_cardCleaningStats._cardsCleaned += 1;
 
 		/* Calculate address of first slot heap for the card to be cleaned... */
 		uintptr_t* heapBase = (uintptr_t*)cardAddrToHeapAddr(env, nextDirtyCard);
@@ -1143,6 +1149,8 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase* env, uintptr_t* byte
 	 * First update number of dirty cards cleaned
 	 */
 	incFinalCleanedCards(cards, phase2);
+	incFinalSkippedCards(env->_cardCleaningStats._cardsSkipped - cardsSkippedBefore);
+	env->_cardCleaningStats.addToCardCleaningTime(cleanStartTime, omrtime_hires_clock());
 
 	/* ..tell caller how many bytes we traced */
 	*bytesTraced = traceCount;
@@ -1679,6 +1687,16 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase* env, Card cardMask,
 	 		 * scan the card table.
 	 		 */
 			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
+				/* Let the card table summary skip whole cache lines of clean cards first */
+				if (isSummaryBoundary(currentCard)) {
+					Card* summaryCard = skipCleanCards(currentCard, lastCardToClean);
+					env->_cardCleaningStats._cardsSkipped += summaryCard - currentCard;
+					currentCard = summaryCard;
+					if (currentCard >= lastCardToClean) {
+						break;
+					}
+				}
+
 				uintptr_t* nextSlot = (uintptr_t*)currentCard;
 				/* Last card may be in middle of a slot so only scan up to an including last
 				 * complete slots worth of cards; then go card at a time
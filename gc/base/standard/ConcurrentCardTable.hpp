@@ -298,6 +298,13 @@ protected:
 		}
 	}
 
+	MMINLINE void incFinalSkippedCards(uintptr_t numCards)
+	{
+		if (0 != numCards) {
+			_cardTableStats.incFinalSkippedCards(numCards);
+		}
+	}
+
 public:
 	/**
 	 * Creates and returns a new instance of the card table.
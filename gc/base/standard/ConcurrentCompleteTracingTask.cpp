@@ -26,6 +26,8 @@
 
 #include "ConcurrentCompleteTracingTask.hpp"
 #include "ConcurrentGC.hpp"
+#include "MarkingScheme.hpp"
+#include "WorkPackets.hpp"
 
 void
 MM_ConcurrentCompleteTracingTask::run(MM_EnvironmentBase* envBase)
@@ -34,6 +36,13 @@ MM_ConcurrentCompleteTracingTask::run(MM_EnvironmentBase* envBase)
 	_collector->completeTracing(env);
 }
 
+uintptr_t
+MM_ConcurrentCompleteTracingTask::getRecommendedWorkingThreads(MM_EnvironmentBase* env)
+{
+	uintptr_t nonEmptyPackets = _collector->getMarkingScheme()->getWorkPackets()->getNonEmptyPacketCount();
+	return 1 + (nonEmptyPackets / env->getExtensions()->markPacketsPerThread);
+}
+
 void
 MM_ConcurrentCompleteTracingTask::setup(MM_EnvironmentBase* env)
 {
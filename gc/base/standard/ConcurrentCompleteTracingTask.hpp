@@ -54,6 +54,12 @@ public:
 	virtual void setup(MM_EnvironmentBase* env);
 	virtual void cleanup(MM_EnvironmentBase* env);
 
+	/**
+	 * Tracing is completed from the packets left by the concurrent phase, so dispatch threads in
+	 * proportion to the number of non-empty packets.
+	 */
+	virtual uintptr_t getRecommendedWorkingThreads(MM_EnvironmentBase* env);
+
 	/**
 	 * Create a ConcurrentCompleteTracingTask object
 	 */
@@ -273,6 +273,7 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase* env, u
 	        cardTable->getCardTableStats()->getFinalCleanedCardsPhase1(),
 	        cardTable->getCardTableStats()->getFinalCleanedCardsPhase2(),
 	        cardTable->getCardTableStats()->getFinalCleanedCards(),
+	        cardTable->getCardTableStats()->getFinalSkippedCards(),
 	        _stats.getFinalTraceCount() + _stats.getFinalCardCleanCount(),
 	        cardTable->getCardTableStats()->getConcurrentCleanedCardsPhase1(),
 	        cardTable->getCardTableStats()->getConcurrentCleanedCardsPhase2(),
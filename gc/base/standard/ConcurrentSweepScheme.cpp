@@ -445,6 +445,8 @@ MM_ConcurrentSweepScheme::reportCompletedConcurrentSweep(MM_EnvironmentBase* env
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	Trc_MM_CompletedConcurrentSweep(env->getLanguageVMThread(), _stats._completeConnectPhaseBytesConnected);
+	Trc_MM_CompletedConcurrentSweep_published(env->getLanguageVMThread(), _stats._publishedBytesConnected,
+	                                          _stats._timeToFirstAllocation);
 	TRIGGER_J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP(
 	        _extensions->privateHookInterface, env->getOmrVMThread(), omrtime_hires_clock(),
 	        J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP,
@@ -453,7 +455,8 @@ MM_ConcurrentSweepScheme::reportCompletedConcurrentSweep(MM_EnvironmentBase* env
 	        _stats._completeSweepPhaseBytesSwept,
 	        omrtime_hires_delta(_stats._completeConnectPhaseTimeStart, _stats._completeConnectPhaseTimeEnd,
 	                            OMRPORT_TIME_DELTA_IN_MICROSECONDS),
-	        _stats._completeConnectPhaseBytesConnected, reason);
+	        _stats._completeConnectPhaseBytesConnected, _stats._publishedBytesConnected, _stats._timeToFirstAllocation,
+	        reason);
 }
 
 /**
@@ -577,6 +580,8 @@ MM_ConcurrentSweepScheme::postConnectChunk(MM_EnvironmentBase* env, MM_ParallelS
 	/* update the total heap size connected for the subspace */
 	sweepState->_heapSizeConnected += chunk->size();
 
+	recordFirstAllocatable(env);
+
 	/* Calculate and set the new approximation of free memory still to be connected into this pool */
 	calculateApproximateFree(env, memoryPool, sweepState);
 
@@ -974,6 +979,46 @@ MM_ConcurrentSweepScheme::incrementalConnectChunk(MM_EnvironmentStandard* env,
 	return false;
 }
 
+/**
+ * Publish the swept chunks at the head of the connection order into the memory pool free list.
+ * Called by a sweeping thread after it sweeps a chunk, so that allocating threads can use freshly swept memory
+ * without waiting for an allocation failure (or the end of the sweep) to connect it.  Chunks must be connected
+ * in address order, so only the contiguous run of swept chunks starting at the current connect chunk is published.
+ * @note The caller must not hold the memory pool allocation lock.
+ */
+void
+MM_ConcurrentSweepScheme::publishSweptChunks(MM_EnvironmentStandard* env, MM_ConcurrentSweepPoolState* sweepState)
+{
+	/* Unlocked peek - the lock is only worth taking when the next chunk in connection order is ready */
+	MM_ParallelSweepChunk* chunk = sweepState->_connectCurrentChunk;
+	if ((NULL == chunk) || (modron_concurrentsweep_state_swept != chunk->_concurrentSweepState)) {
+		return;
+	}
+
+	MM_MemoryPoolAddressOrderedList* memoryPool = (MM_MemoryPoolAddressOrderedList*)sweepState->_memoryPool;
+	memoryPool->_heapLock.acquire();
+
+	/* An allocating thread may have connected chunks while the lock was being acquired */
+	chunk = sweepState->_connectCurrentChunk;
+	if ((NULL != chunk) && (modron_concurrentsweep_state_swept == chunk->_concurrentSweepState)) {
+		initializeStateForConnections(env, memoryPool, sweepState, chunk);
+
+		while ((NULL != chunk) && (modron_concurrentsweep_state_swept == chunk->_concurrentSweepState)) {
+			getNextConnectChunk(env, sweepState);
+			incrementalConnectChunk(env, chunk, sweepState, memoryPool);
+			MM_AtomicOperations::add((UDATA*)&_stats._publishedBytesConnected, chunk->size());
+			chunk = sweepState->_connectCurrentChunk;
+		}
+
+		/* Connecting only ever adds free entries, so the largest one is still valid if it grew */
+		if (sweepState->_largestFreeEntry > memoryPool->getLargestFreeEntry()) {
+			memoryPool->setLargestFreeEntry(sweepState->_largestFreeEntry);
+		}
+	}
+
+	memoryPool->_heapLock.release();
+}
+
 /**
  * Initialize any state information preceeding a round of connections.
  * Find the free entries of the pool that surround the specified chunk and update the state to treat these
@@ -1197,6 +1242,9 @@ MM_ConcurrentSweepScheme::sweepPool(MM_EnvironmentBase* envModron, MM_MemoryPool
 			/* We swept another chunk */
 			taxPaid++;
 
+			/* Make what has been swept so far available to allocating threads */
+			publishSweptChunks(MM_EnvironmentStandard::getEnvironment(envModron), sweepState);
+
 #if defined(CONCURRENT_SWEEP_TRACE)
 			OMRPORT_ACCESS_FROM_OMRPORT(envModron->getPortLibrary());
 			omrtty_printf("T");
@@ -1237,8 +1285,13 @@ MM_ConcurrentSweepScheme::completeSweep(MM_EnvironmentBase* envBase, SweepComple
 
 	/* First complete the sweep of all chunks */
 	_stats._completeSweepPhaseTimeStart = omrtime_hires_clock();
+	MM_SweepStats* sweepStats = &_extensions->globalGCStats.sweepStats;
 	if (reason == ABOUT_TO_GC) {
-		_extensions->globalGCStats.sweepStats.clear();
+		/* The sweep stats still belong to the cycle being completed - keep its first allocation time for the report */
+		_stats._timeToFirstAllocation = sweepStats->_timeToFirstAllocation;
+		sweepStats->clear();
+		/* Memory connected from here on must not be timed against the sweep start of the previous cycle */
+		sweepStats->_startTime = 0;
 	}
 	MM_ConcurrentSweepCompleteSweepTask completeSweepTask(envBase, dispatcher, this);
 	dispatcher->run(envBase, &completeSweepTask);
@@ -1284,6 +1337,10 @@ MM_ConcurrentSweepScheme::completeSweep(MM_EnvironmentBase* envBase, SweepComple
 	}
 	_stats._completeConnectPhaseTimeEnd = omrtime_hires_clock();
 
+	if (reason != ABOUT_TO_GC) {
+		_stats._timeToFirstAllocation = sweepStats->_timeToFirstAllocation;
+	}
+
 	/* Report that we have completed concurrent sweep  */
 	reportCompletedConcurrentSweep(env, reason);
 
@@ -1584,6 +1641,7 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase* envMo
 			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 			omrtty_printf("C");
 #endif /* CONCURRENT_SWEEP_TRACE */
+			publishSweptChunks(env, sweepState);
 		}
 	}
 
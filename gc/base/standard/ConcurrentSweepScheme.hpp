@@ -120,6 +120,7 @@ private:
 	                             MM_ParallelSweepChunk* chunk,
 	                             MM_ConcurrentSweepPoolState* sweepState,
 	                             MM_MemoryPoolAddressOrderedList* memoryPool);
+	void publishSweptChunks(MM_EnvironmentStandard* env, MM_ConcurrentSweepPoolState* sweepState);
 
 	void workThreadCompleteSweep(MM_EnvironmentBase* env);
 
@@ -159,7 +159,8 @@ MM_ConfigurationStandard::createMemoryPool(MM_EnvironmentBase* env, bool appendC
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	uintptr_t minimumFreeEntrySize = extensions->tlhMinimumSize;
 
-	bool doSplit = 1 < extensions->splitFreeListSplitAmount;
+	/* TLH allocation caches take the place of split free lists in relieving contention on the pool lock */
+	bool doSplit = (1 < extensions->splitFreeListSplitAmount) && (0 == extensions->tlhAllocationCacheCount);
 	bool doHybrid = extensions->enableHybridMemoryPool;
 
 #if defined(OMR_GC_CONCURRENT_SWEEP)
@@ -62,6 +62,8 @@ public:
 	bool _loaAllocation; /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void* _survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void* _survivorTLHRemainderTop;
+	uintptr_t _scanCacheListIndex; /**< index of the scavenger scan list local to this thread's NUMA node */
+	uintptr_t _scanCacheNumaNode; /**< j9NodeNumber of the NUMA node this thread scavenges on (0 if unknown) */
 
 protected:
 private:
@@ -99,7 +101,9 @@ public:
 	          _tenureTLHRemainderTop(NULL),
 	          _loaAllocation(false),
 	          _survivorTLHRemainderBase(NULL),
-	          _survivorTLHRemainderTop(NULL)
+	          _survivorTLHRemainderTop(NULL),
+	          _scanCacheListIndex(0),
+	          _scanCacheNumaNode(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -44,6 +44,12 @@ MM_ParallelScavengeTask::masterSetup(MM_EnvironmentBase* env)
 	_collector->setAliasThreshold(calculatedAliasThreshold);
 }
 
+uintptr_t
+MM_ParallelScavengeTask::getRecommendedWorkingThreads(MM_EnvironmentBase* env)
+{
+	return _collector->getRecommendedWorkingThreads(env);
+}
+
 void
 MM_ParallelScavengeTask::setup(MM_EnvironmentBase* env)
 {
@@ -23,6 +23,7 @@
 #include "ParallelSweepScheme.hpp"
 
 #include "AllocateDescription.hpp"
+#include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
@@ -715,6 +716,26 @@ MM_ParallelSweepScheme::connectAllChunks(MM_EnvironmentBase* env, uintptr_t tota
 
 	/* Walk all memory spaces flushing the previous free entry */
 	flushAllFinalChunks(env);
+
+	recordFirstAllocatable(env);
+}
+
+void
+MM_ParallelSweepScheme::recordFirstAllocatable(MM_EnvironmentBase* env)
+{
+	MM_SweepStats* sweepStats = &_extensions->globalGCStats.sweepStats;
+
+	/* No start time means the stats were cleared for a collection that has not started its sweep yet */
+	if ((0 == sweepStats->_firstAllocatableTime) && (0 != sweepStats->_startTime)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t now = omrtime_hires_clock();
+		if (0 == MM_AtomicOperations::lockCompareExchangeU64(&sweepStats->_firstAllocatableTime, 0, now)) {
+			sweepStats->_timeToFirstAllocation =
+			        omrtime_hires_delta(sweepStats->_startTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			Trc_MM_ParallelSweepScheme_recordFirstAllocatable(env->getLanguageVMThread(),
+			                                                  sweepStats->_timeToFirstAllocation);
+		}
+	}
 }
 
 /**
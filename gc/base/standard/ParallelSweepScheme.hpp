@@ -138,6 +138,12 @@ protected:
 	virtual void connectChunk(MM_EnvironmentBase* env, MM_ParallelSweepChunk* chunk);
 	void connectAllChunks(MM_EnvironmentBase* env, uintptr_t totalChunkCount);
 
+	/**
+	 * Record the first time in this cycle at which swept memory became available for allocation.
+	 * Only the first call per cycle has any effect.
+	 */
+	void recordFirstAllocatable(MM_EnvironmentBase* env);
+
 	void initializeSweepStates(MM_EnvironmentBase* env);
 
 	void flushFinalChunk(MM_EnvironmentBase* env, MM_MemoryPool* memoryPool);
@@ -1271,6 +1271,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase* env
 		_subSpace->heapAddRange(env, _subSpace, splitExpandSize, newLowAddress,
 		                        (void*)(((uintptr_t)newLowAddress) + splitExpandSize));
 		_subSpace->heapReconfigured(env);
+		_heap->pretouchMemory(env, HEAP_PRETOUCH_EXPAND, newLowAddress,
+		                      (void*)(((uintptr_t)newLowAddress) + splitExpandSize));
 
 		/* Include the memory into the free lists */
 		if (debug) {
@@ -1334,6 +1336,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase* env
 		_subSpace->heapAddRange(env, _subSpace, splitExpandSize, newLowAddress,
 		                        (void*)(((uintptr_t)newLowAddress) + splitExpandSize));
 		_subSpace->heapReconfigured(env);
+		_heap->pretouchMemory(env, HEAP_PRETOUCH_EXPAND, newLowAddress,
+		                      (void*)(((uintptr_t)newLowAddress) + splitExpandSize));
 
 		/* Include the memory into the free lists. */
 		if (debug) {
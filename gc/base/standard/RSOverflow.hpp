@@ -78,6 +78,13 @@ public:
 		return _markedObjectIterator.nextObject();
 	}
 
+	/**
+	 * Get the mark map the remembered objects are recorded in, so that several threads can mark and search it.
+	 * Threads marking in parallel must use atomicSetBit(), and no thread may search before marking has completed.
+	 * @return the mark map taken over from the global collector
+	 */
+	MMINLINE MM_MarkMap* getMarkMap() { return _markMap; }
+
 	/**
 	 * Construct a new RSOverflow
 	 */
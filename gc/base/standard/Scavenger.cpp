@@ -58,6 +58,7 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapStats.hpp"
 #include "IndexableObjectScanner.hpp"
@@ -100,6 +101,10 @@
 
 #define INITIAL_FREE_HISTORY_WEIGHT ((float)0.8)
 #define TENURE_BYTES_HISTORY_WEIGHT ((float)0.9)
+#define SURVIVAL_RATE_HISTORY_WEIGHT 0.7
+#define REMEMBERED_OBJECT_WORK_BYTES 256
+/* Size of the heap chunk whose remembered objects are rescanned as one work unit after a remembered set overflow */
+#define REMEMBERED_SET_OVERFLOW_SCAN_CHUNK_SIZE ((uintptr_t)64 * 1024)
 
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
@@ -230,7 +235,7 @@ MM_Scavenger::initialize(MM_EnvironmentBase* env)
 		return false;
 	}
 
-	if (!_scavengeCacheScanList.initialize(env, &_cachedEntryCount)) {
+	if (!initializeScanLists(env)) {
 		return false;
 	}
 
@@ -303,7 +308,14 @@ MM_Scavenger::tearDown(MM_EnvironmentBase* env)
 	_delegate.tearDown(env);
 
 	_scavengeCacheFreeList.tearDown(env);
-	_scavengeCacheScanList.tearDown(env);
+	if (NULL != _scavengeCacheScanList) {
+		for (uintptr_t i = 0; i < _scavengeCacheScanListCount; i++) {
+			_scavengeCacheScanList[i].tearDown(env);
+		}
+		env->getForge()->free(_scavengeCacheScanList);
+		_scavengeCacheScanList = NULL;
+		_scavengeCacheScanListCount = 0;
+	}
 
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
@@ -409,6 +421,12 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard* env)
 	_survivorMemorySubSpace = _activeSubSpace->getMemorySubSpaceSurvivor();
 	_tenureMemorySubSpace = _activeSubSpace->getTenureMemorySubSpace();
 
+	/* Record the size of the work ahead, used to decide how many threads to dispatch */
+	uintptr_t evacuateActiveSize = _evacuateMemorySubSpace->getActiveMemorySize();
+	uintptr_t evacuateFreeSize = _evacuateMemorySubSpace->getApproximateActiveFreeMemorySize();
+	_evacuateOccupiedBytes = (evacuateActiveSize > evacuateFreeSize) ? (evacuateActiveSize - evacuateFreeSize) : 0;
+	_rememberedSetElementCount = _extensions->rememberedSet.countConsumedElements();
+
 	/* Accumulate pre-scavenge allocation statistics */
 	MM_HeapStats heapStatsSemiSpace;
 	MM_HeapStats heapStatsTenureSpace;
@@ -456,6 +474,14 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard* env)
 	/* record that this thread is participating in this cycle */
 	env->_scavengerStats._gcCount = _extensions->scavengerStats._gcCount;
 
+	/* affinity may change between cycles, so look up the local scan list every time */
+	env->_scanCacheListIndex = getScanListIndexForThread(env);
+	if (_extensions->_numaManager.isPhysicalNUMAEnabled()) {
+		env->_scanCacheNumaNode = env->getNumaAffinity();
+	} else {
+		env->_scanCacheNumaNode = getScanListNode(env->_scanCacheListIndex);
+	}
+
 	/* Reset the local remembered set fragment */
 	env->_scavengerRememberedSet.count = 0;
 	env->_scavengerRememberedSet.fragmentCurrent = NULL;
@@ -615,6 +641,7 @@ void
 MM_Scavenger::clearThreadGCStats(MM_EnvironmentBase* env, bool firstIncrement)
 {
 	env->_scavengerStats.clear(firstIncrement);
+	env->_rootScannerStats.clear();
 }
 
 void
@@ -655,6 +682,9 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase* env, MM_ScavengerStats* final
 	        OMR_MAX(scavStats->_failedTenureLargest, finalGCStats->_failedTenureLargest);
 	finalGCStats->_failedFlipCount += scavStats->_failedFlipCount;
 	finalGCStats->_failedFlipBytes += scavStats->_failedFlipBytes;
+	finalGCStats->_localNodeScanCacheCount += scavStats->_localNodeScanCacheCount;
+	finalGCStats->_scanCacheStealCount += scavStats->_scanCacheStealCount;
+	finalGCStats->_crossNodeScanCacheStealCount += scavStats->_crossNodeScanCacheStealCount;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	finalGCStats->_acquireFreeListCount += scavStats->_acquireFreeListCount;
@@ -693,6 +723,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase* env, MM_ScavengerStats* final
 	finalGCStats->_tenureExpandedBytes += scavStats->_tenureExpandedBytes;
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
+	finalGCStats->_rememberedSetDuplicates += scavStats->_rememberedSetDuplicates;
+	finalGCStats->_rememberedSetScanTime =
+	        OMR_MAX(finalGCStats->_rememberedSetScanTime, scavStats->_rememberedSetScanTime);
+	finalGCStats->_rootScannerStats.merge(&scavStats->_rootScannerStats);
 
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_DISTANCE_BINS; i++) {
@@ -723,6 +757,7 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase* env)
 	MM_ScavengerStats* scavStats = &env->_scavengerStats;
 
 	mergeGCStatsBase(env, &_extensions->incrementScavengerStats, scavStats);
+	_extensions->incrementScavengerStats._rootScannerStats.merge(&env->_rootScannerStats);
 
 	/* Merge language specific statistics. No known interesting data per increment - they are merged directly to aggregate cycle stats */
 	_delegate.mergeGCStats_mergeLangStats(env);
@@ -738,6 +773,11 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase* env)
 	        (uint32_t)scavStats->_workStallCount, (uint32_t)scavStats->_completeStallCount,
 	        (uint32_t)scavStats->_syncStallCount, scavStats->_acquireFreeListCount,
 	        scavStats->_releaseFreeListCount, scavStats->_acquireScanListCount, scavStats->_releaseScanListCount);
+	Trc_MM_ParallelScavenger_scanListNodeStats(env->getLanguageVMThread(), (uint32_t)env->getSlaveID(),
+	                                           MM_EnvironmentStandard::getEnvironment(env)->_scanCacheListIndex,
+	                                           MM_EnvironmentStandard::getEnvironment(env)->_scanCacheNumaNode,
+	                                           scavStats->_localNodeScanCacheCount, scavStats->_scanCacheStealCount,
+	                                           scavStats->_crossNodeScanCacheStealCount);
 }
 
 void
@@ -877,6 +917,19 @@ MM_Scavenger::calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize,
 	return MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), cacheSize);
 }
 
+uintptr_t
+MM_Scavenger::getRecommendedWorkingThreads(MM_EnvironmentBase* env)
+{
+	if (_isRememberedSetInOverflowAtTheBeginning) {
+		/* the whole tenure space has to be scanned for remembered objects */
+		return UDATA_MAX;
+	}
+
+	uintptr_t copyWork = (uintptr_t)((double)_evacuateOccupiedBytes * _expectedSurvivalRate);
+	uintptr_t rememberedSetWork = _rememberedSetElementCount * REMEMBERED_OBJECT_WORK_BYTES;
+	return 1 + ((copyWork + rememberedSetWork) / _extensions->scavengerWorkPerThread);
+}
+
 /**
  * Calculate optimum copyscancache size.
  *
@@ -886,7 +939,9 @@ MM_Scavenger::calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize,
 MMINLINE uintptr_t
 MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard* env)
 {
-	uintptr_t threadCount = _dispatcher->threadCount();
+	/* mutators copying on behalf of a concurrent scavenge have no task */
+	uintptr_t threadCount =
+	        (NULL != env->_currentTask) ? env->_currentTask->getThreadCount() : _dispatcher->threadCount();
 	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
 	uintptr_t cacheSize = maxCacheSize;
 	uintptr_t waitingThreads = _waitingCount;
@@ -896,7 +951,7 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard* env)
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount();
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount =
 		        calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
@@ -1686,7 +1741,7 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 	                                                          &(env->_scavengerStats._slotsCopied), _waitingCount);
 	if (0 != updateResult) {
 		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount,
-		                                       _scavengeCacheScanList.getApproximateEntryCount());
+		                                       getApproximateScanCacheCount());
 	}
 }
 
@@ -1740,13 +1795,48 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard* env,
 	GC_SlotObject* slotObject = NULL;
 
 	MM_CopyScanCacheStandard** copyCache = &(env->_effectiveCopyScanCache);
-	while (NULL != (slotObject = objectScanner->getNextSlot())) {
-		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
-		shouldRemember |= isSlotObjectInNewSpace;
-		if (NULL != *copyCache) {
-			slotsCopied += 1;
+	uintptr_t prefetchDepth = OMR_MIN(_extensions->scavengerSlotPrefetchDepth, MAXIMUM_SCAVENGER_SLOT_PREFETCH_DEPTH);
+	if (1 < prefetchDepth) {
+		/* Gather a batch of slots, prefetching the header of each evacuate object referenced, before copying any of
+		 * them. The cache misses on the forwarding headers then overlap instead of stalling each copy in turn. */
+		OMR_VM* omrVM = env->getOmrVM();
+		fomrobject_t* slotBatch[MAXIMUM_SCAVENGER_SLOT_PREFETCH_DEPTH];
+		bool moreSlots = true;
+		while (moreSlots) {
+			uintptr_t batchSize = 0;
+			while (batchSize < prefetchDepth) {
+				slotObject = objectScanner->getNextSlot();
+				if (NULL == slotObject) {
+					moreSlots = false;
+					break;
+				}
+				omrobjectptr_t slotReference = slotObject->readReferenceFromSlot();
+				if ((NULL != slotReference) && isObjectInEvacuateMemory(slotReference)) {
+					MM_AtomicOperations::prefetch(slotReference);
+				}
+				/* the scanner reuses its slot object, so only the slot address can be retained */
+				slotBatch[batchSize] = slotObject->readAddressFromSlot();
+				batchSize += 1;
+			}
+			for (uintptr_t i = 0; i < batchSize; i++) {
+				GC_SlotObject batchedSlotObject(omrVM, slotBatch[i]);
+				bool isSlotObjectInNewSpace = copyAndForward(env, &batchedSlotObject);
+				shouldRemember |= isSlotObjectInNewSpace;
+				if (NULL != *copyCache) {
+					slotsCopied += 1;
+				}
+				slotsScanned += 1;
+			}
+		}
+	} else {
+		while (NULL != (slotObject = objectScanner->getNextSlot())) {
+			bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
+			shouldRemember |= isSlotObjectInNewSpace;
+			if (NULL != *copyCache) {
+				slotsCopied += 1;
+			}
+			slotsScanned += 1;
 		}
-		slotsScanned += 1;
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
 
@@ -2518,22 +2608,51 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard* env)
 
 		clearRememberedSetLists(env);
 
-		/* Creation of this class will Abort Global Collector */
+		/* Creation of this class will Abort Global Collector and clear its mark map for our use */
 		MM_RSOverflow rememberedSetOverflow(env);
+		_rememberedSetOverflowMap = rememberedSetOverflow.getMarkMap();
 
-		addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 
-		/*
-		 * Scan any remembered objects, but don't adjust their remembered bit.
-		 * Objects that no longer need remembering will be pruned at the end of the scavenge.
-		 */
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
-			scavengeRememberedObject(env, objectPtr);
+	/*
+	 * Mark every remembered object before any is scanned: scanning copies objects into tenure space, which
+	 * can then be neither walked nor told apart from the objects remembered before the scavenge.
+	 * A region can only be walked from its base, so each tenure region is a work unit.
+	 */
+	MM_HeapRegionDescriptorStandard* region = NULL;
+	GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					_rememberedSetOverflowMap->atomicSetBit(objectPtr);
+				}
+			}
 		}
+	}
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
 
-		env->_currentTask->releaseSynchronizedGCThreads(env);
+	/*
+	 * Scan any remembered objects, one chunk of the heap per work unit, but don't adjust their remembered bit.
+	 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+	 */
+	uintptr_t heapBase = (uintptr_t)_extensions->heapBaseForBarrierRange0;
+	uintptr_t heapTop = heapBase + _extensions->heapSizeForBarrierRange0;
+	MM_HeapMapIterator markedObjectIterator(_extensions);
+	for (uintptr_t chunkBase = heapBase; chunkBase < heapTop; chunkBase += REMEMBERED_SET_OVERFLOW_SCAN_CHUNK_SIZE) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t chunkTop = chunkBase + OMR_MIN(REMEMBERED_SET_OVERFLOW_SCAN_CHUNK_SIZE, heapTop - chunkBase);
+			markedObjectIterator.reset(_rememberedSetOverflowMap, (uintptr_t*)chunkBase, (uintptr_t*)chunkTop);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				scavengeRememberedObject(env, objectPtr);
+			}
+		}
 	}
+	env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
 }
 
 MMINLINE void
@@ -2574,10 +2693,14 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard* env)
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
 
-		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
-		MM_HeapRegionDescriptorStandard* region = NULL;
-		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
-		while ((region = regionIterator.nextRegion()) != NULL) {
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	/* Walk the tenure memory subspace finding all tenured objects flagged as remembered, a region per work unit */
+	MM_HeapRegionDescriptorStandard* region = NULL;
+	GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+	while ((region = regionIterator.nextRegion()) != NULL) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 			/* Verify or clear remembered bits for each tenured object currently flagged as remembered */
 			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
 			omrobjectptr_t objectPtr;
@@ -2617,18 +2740,20 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard* env)
 				}
 			}
 		}
+	}
+
+	/* Objects may have been remembered during scan, fragment must be flushed */
+	flushRememberedSet(env);
 
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 #if defined(OMR_SCAVENGER_TRACE_REMEMBERED_SET)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 		if (isRememberedSetInOverflowState()) {
 			omrtty_printf("{SCAV: Pruned remembered set still in overflow}\n");
 		} else {
 			omrtty_printf("{SCAV: Pruned remembered set no longer in overflow}\n");
 		}
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
-
-		/* Objects may have been remembered during scan, fragment must be flushed */
-		flushRememberedSet(env);
-
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
@@ -2802,6 +2927,13 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard* env)
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
 
+	/* Direct mapped filter of the objects most recently scanned by this thread, used to drop duplicate entries */
+	omrobjectptr_t duplicateFilter[OMR_SCV_REMSET_FILTER_SIZE];
+	bool deduplicate = _extensions->scavengerRememberedSetDeduplication;
+	if (deduplicate) {
+		memset(duplicateFilter, 0, sizeof(duplicateFilter));
+	}
+
 	/* Remembered set walk */
 	MM_SublistPuddle* puddle = NULL;
 	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
@@ -2812,6 +2944,18 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard* env)
 		while ((slotPtr = (omrobjectptr_t*)remSetSlotIterator.nextSlot()) != NULL) {
 			omrobjectptr_t objectPtr = *slotPtr;
 
+			if (deduplicate && (NULL != objectPtr)) {
+				uintptr_t filterIndex =
+				        ((uintptr_t)objectPtr >> OMR_MINIMUM_OBJECT_ALIGNMENT_SHIFT) % OMR_SCV_REMSET_FILTER_SIZE;
+				if (objectPtr == duplicateFilter[filterIndex]) {
+					/* Already scanned (and kept or flagged for removal) through an earlier entry */
+					env->_scavengerStats._rememberedSetDuplicates += 1;
+					objectPtr = NULL;
+				} else {
+					duplicateFilter[filterIndex] = objectPtr;
+				}
+			}
+
 			if (NULL != objectPtr) {
 				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 				numElements += 1;
@@ -2853,6 +2997,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard* env)
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard* env)
 {
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -2877,6 +3024,10 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard* env)
 		}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	}
+
+	uint64_t scanTime = omrtime_hires_clock() - startTime;
+	env->_scavengerStats._rememberedSetScanTime += scanTime;
+	env->_rootScannerStats.addEntityScanTime(RootScannerEntity_ScavengeRememberedSet, scanTime);
 }
 
 void
@@ -3295,7 +3446,8 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard* env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard* env, MM_CopyScanCacheStandard* newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
+	/* the cache was filled by this thread, so it is (most likely) backed by memory local to this thread's node */
+	_scavengeCacheScanList[env->_scanCacheListIndex].pushCache(env, newCacheEntry);
 	if (0 != _waitingCount) {
 		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
 		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
@@ -3377,7 +3529,95 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard* env,
 MMINLINE MM_CopyScanCacheStandard*
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard* env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	uintptr_t localIndex = env->_scanCacheListIndex;
+	MM_CopyScanCacheStandard* cache = _scavengeCacheScanList[localIndex].popCache(env);
+
+	if (NULL != cache) {
+		env->_scavengerStats._localNodeScanCacheCount += 1;
+	} else {
+		/* local node is drained - steal from the other nodes, nearest index first */
+		for (uintptr_t i = 1; (NULL == cache) && (i < _scavengeCacheScanListCount); i++) {
+			uintptr_t remoteIndex = (localIndex + i) % _scavengeCacheScanListCount;
+			cache = _scavengeCacheScanList[remoteIndex].popCache(env);
+			if (NULL != cache) {
+				env->_scavengerStats._scanCacheStealCount += 1;
+				/* a steal crosses nodes only if both nodes are known and differ */
+				uintptr_t victimNode = getScanListNode(remoteIndex);
+				if ((0 != victimNode) && (0 != env->_scanCacheNumaNode) && (victimNode != env->_scanCacheNumaNode)) {
+					env->_scavengerStats._crossNodeScanCacheStealCount += 1;
+				}
+			}
+		}
+	}
+
+	return cache;
+}
+
+bool
+MM_Scavenger::initializeScanLists(MM_EnvironmentBase* env)
+{
+	/* all lists share _cachedEntryCount, so termination in getNextScanCache() sees work on any node */
+	_scavengeCacheScanListCount = _extensions->_numaManager.getAffinityLeaderCount() + 1;
+	_scavengeCacheScanList = (MM_CopyScanCacheList*)env->getForge()->allocate(
+	        sizeof(MM_CopyScanCacheList) * _scavengeCacheScanListCount, OMR::GC::AllocationCategory::FIXED,
+	        OMR_GET_CALLSITE());
+	if (NULL == _scavengeCacheScanList) {
+		_scavengeCacheScanListCount = 0;
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < _scavengeCacheScanListCount; i++) {
+		new (&_scavengeCacheScanList[i]) MM_CopyScanCacheList();
+	}
+	for (uintptr_t i = 0; i < _scavengeCacheScanListCount; i++) {
+		if (!_scavengeCacheScanList[i].initialize(env, &_cachedEntryCount)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uintptr_t
+MM_Scavenger::getScanListIndexForThread(MM_EnvironmentStandard* env)
+{
+	uintptr_t index = 0;
+
+	if (1 < _scavengeCacheScanListCount) {
+		MM_NUMAManager* numaManager = &_extensions->_numaManager;
+		if (numaManager->isPhysicalNUMAEnabled()) {
+			uintptr_t j9NodeNumber = env->getNumaAffinity();
+			uintptr_t leaderCount = 0;
+			J9MemoryNodeDetail const* leaders = numaManager->getAffinityLeaders(&leaderCount);
+			for (uintptr_t i = 0; i < leaderCount; i++) {
+				if (leaders[i].j9NodeNumber == j9NodeNumber) {
+					index = i + 1;
+					break;
+				}
+			}
+		} else {
+			/* simulated NUMA - no physical affinity, so spread the GC threads over the logical nodes */
+			index = (env->getSlaveID() % (_scavengeCacheScanListCount - 1)) + 1;
+		}
+	}
+
+	return index;
+}
+
+uintptr_t
+MM_Scavenger::getScanListNode(uintptr_t index)
+{
+	uintptr_t j9NodeNumber = 0;
+
+	if (0 != index) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const* leaders = _extensions->_numaManager.getAffinityLeaders(&leaderCount);
+		if (index <= leaderCount) {
+			j9NodeNumber = leaders[index - 1].j9NodeNumber;
+		}
+	}
+
+	return j9NodeNumber;
 }
 
 /**
@@ -3809,8 +4049,10 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard* env)
 			/* 1) Flush copy scan caches */
 			MM_CopyScanCacheStandard* cache = NULL;
 
-			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
-				flushCache(env, cache);
+			for (uintptr_t i = 0; i < _scavengeCacheScanListCount; i++) {
+				while (NULL != (cache = _scavengeCacheScanList[i].popCache(env))) {
+					flushCache(env, cache);
+				}
 			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
@@ -4010,6 +4252,16 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase* envBase,
 			/* Defer to collector language interface */
 			_delegate.masterThreadGarbageCollect_scavengeSuccess(env);
 
+			if (0 != _evacuateOccupiedBytes) {
+				MM_ScavengerStats* scavengerStats = &_extensions->scavengerStats;
+				uintptr_t survivedBytes =
+				        scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes;
+				double survivalRate = (double)survivedBytes / (double)_evacuateOccupiedBytes;
+				survivalRate = OMR_MIN(1.0, survivalRate);
+				_expectedSurvivalRate = (_expectedSurvivalRate * SURVIVAL_RATE_HISTORY_WEIGHT)
+				                        + (survivalRate * (1.0 - SURVIVAL_RATE_HISTORY_WEIGHT));
+			}
+
 			if (_extensions->scvTenureStrategyAdaptive) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize =
@@ -5061,7 +5313,7 @@ MM_Scavenger::threadReleaseCaches(MM_EnvironmentBase* envBase, bool final)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 			env->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-			_scavengeCacheScanList.pushCache(env, env->_deferredScanCache);
+			_scavengeCacheScanList[env->_scanCacheListIndex].pushCache(env, env->_deferredScanCache);
 			env->_deferredScanCache = NULL;
 		}
 
@@ -5072,7 +5324,7 @@ MM_Scavenger::threadReleaseCaches(MM_EnvironmentBase* envBase, bool final)
 			env->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 			clearCache(env, env->_survivorCopyScanCache);
-			_scavengeCacheScanList.pushCache(env, env->_survivorCopyScanCache);
+			_scavengeCacheScanList[env->_scanCacheListIndex].pushCache(env, env->_survivorCopyScanCache);
 			env->_survivorCopyScanCache = NULL;
 		}
 		if (NULL != env->_deferredCopyCache) {
@@ -5082,7 +5334,7 @@ MM_Scavenger::threadReleaseCaches(MM_EnvironmentBase* envBase, bool final)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 			env->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-			_scavengeCacheScanList.pushCache(env, env->_deferredCopyCache);
+			_scavengeCacheScanList[env->_scanCacheListIndex].pushCache(env, env->_deferredCopyCache);
 			env->_deferredCopyCache = NULL;
 		}
 		if (NULL != env->_tenureCopyScanCache) {
@@ -5092,7 +5344,7 @@ MM_Scavenger::threadReleaseCaches(MM_EnvironmentBase* envBase, bool final)
 			env->_scavengerStats._releaseScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 			clearCache(env, env->_tenureCopyScanCache);
-			_scavengeCacheScanList.pushCache(env, env->_tenureCopyScanCache);
+			_scavengeCacheScanList[env->_scanCacheListIndex].pushCache(env, env->_tenureCopyScanCache);
 			env->_tenureCopyScanCache = NULL;
 		}
 
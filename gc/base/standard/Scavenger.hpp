@@ -49,6 +49,7 @@ class MM_CollectorLanguageInterface;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_MarkMap;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
@@ -72,6 +73,7 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes; /**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	MM_MarkMap* _rememberedSetOverflowMap; /**< Remembered objects being rescanned after a remembered set overflow */
 
 	MM_GCExtensionsBase* _extensions;
 
@@ -99,11 +101,17 @@ private:
 	uintptr_t _minTenureFailureSize;
 	uintptr_t _minSemiSpaceFailureSize;
 
+	uintptr_t _evacuateOccupiedBytes; /**< bytes in use in evacuate space when the scavenge started */
+	uintptr_t _rememberedSetElementCount; /**< remembered objects when the scavenge started */
+	double _expectedSurvivalRate; /**< weighted history of the fraction of the occupied evacuate space surviving a scavenge */
+
 	MM_CycleState _cycleState; /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
-	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
+	MM_CopyScanCacheList*
+	        _scavengeCacheScanList; /**< scan lists, one per NUMA node (index 0 is used by threads without node affinity) */
+	uintptr_t _scavengeCacheScanListCount; /**< number of scan lists (1 if NUMA is not in use) */
 	volatile uintptr_t
 	        _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
@@ -404,6 +412,37 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard* getNextScanCacheFromList(MM_EnvironmentStandard* env);
+
+	/**
+	 * Allocate the scan lists, one for each NUMA affinity leader plus one for threads without affinity.
+	 * @return true on success, false otherwise
+	 */
+	bool initializeScanLists(MM_EnvironmentBase* env);
+
+	/**
+	 * Determine which scan list is local to the NUMA node the given GC thread is running on.
+	 * @return index into _scavengeCacheScanList
+	 */
+	uintptr_t getScanListIndexForThread(MM_EnvironmentStandard* env);
+
+	/**
+	 * Determine the NUMA node whose GC threads push to the given scan list.
+	 * @return j9NodeNumber of the node, or 0 for the list of threads without node affinity
+	 */
+	uintptr_t getScanListNode(uintptr_t index);
+
+	/**
+	 * Walk all scan lists and count the number of cache entries (approximate, see MM_CopyScanCacheList::getApproximateEntryCount).
+	 * @return approximate number of caches waiting to be scanned
+	 */
+	MMINLINE uintptr_t getApproximateScanCacheCount()
+	{
+		uintptr_t count = 0;
+		for (uintptr_t i = 0; i < _scavengeCacheScanListCount; i++) {
+			count += _scavengeCacheScanList[i].getApproximateEntryCount();
+		}
+		return count;
+	}
 	void addCopyCachesToFreeList(MM_EnvironmentStandard* env);
 	MMINLINE void
 	addCacheEntryToScanListAndNotify(MM_EnvironmentStandard* env, MM_CopyScanCacheStandard* newCacheEntry);
@@ -851,6 +890,13 @@ public:
 	virtual bool canCollectorExpand(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace, uintptr_t expandSize);
 	virtual uintptr_t getCollectorExpandSize(MM_EnvironmentBase* env);
 
+	/**
+	 * Estimate how many threads the work of the current scavenge can keep busy, from the evacuate space
+	 * occupancy, the history of survival rates and the size of the remembered set.
+	 * @return the recommended number of threads, at least 1
+	 */
+	uintptr_t getRecommendedWorkingThreads(MM_EnvironmentBase* env);
+
 	virtual void heapReconfigured(MM_EnvironmentBase* env);
 
 	MM_Scavenger(MM_EnvironmentBase* env, MM_HeapRegionManager* regionManager)
@@ -858,6 +904,7 @@ public:
 	          _delegate(env),
 	          _objectAlignmentInBytes(env->getObjectAlignmentInBytes()),
 	          _isRememberedSetInOverflowAtTheBeginning(false),
+	          _rememberedSetOverflowMap(NULL),
 	          _extensions(env->getExtensions()),
 	          _dispatcher(_extensions->dispatcher),
 	          _doneIndex(0),
@@ -876,8 +923,13 @@ public:
 	          _expandTenureOnFailedAllocate(true),
 	          _minTenureFailureSize(UDATA_MAX),
 	          _minSemiSpaceFailureSize(UDATA_MAX),
+	          _evacuateOccupiedBytes(0),
+	          _rememberedSetElementCount(0),
+	          _expectedSurvivalRate(1.0),
 	          _cycleState(),
 	          _collectionStatistics(),
+	          _scavengeCacheScanList(NULL),
+	          _scavengeCacheScanListCount(0),
 	          _cachedEntryCount(0),
 	          _cachesPerThread(0),
 	          _scanCacheMonitor(NULL),
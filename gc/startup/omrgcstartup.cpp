@@ -225,6 +225,10 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 	if (!extensions->dispatcher->startUpThreads()) {
 		extensions->dispatcher->shutDownThreads();
 		rc = OMR_ERROR_INTERNAL;
+	} else {
+		/* the initial heap was committed before there were GC threads to touch it */
+		extensions->heap->pretouchMemory(MM_EnvironmentBase::getEnvironment(omrVMThread), HEAP_PRETOUCH_STARTUP,
+		                                 NULL, NULL);
 	}
 
 	return rc;
@@ -35,7 +35,15 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhRefreshLockCount = 0;
+	_tlhRefreshCacheCount = 0;
+	_tlhAllocationRate = 0;
+	_tlhMaxRefreshSize = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_magazineRegionRefillCount = 0;
+	_magazineDepotRefillCount = 0;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
 	_arrayletLeafAllocationBytes = 0;
@@ -58,6 +66,13 @@ MM_AllocationStats::merge(MM_AllocationStats* stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhRefreshLockCount, stats->_tlhRefreshLockCount);
+	MM_AtomicOperations::add(&_tlhRefreshCacheCount, stats->_tlhRefreshCacheCount);
+	MM_AtomicOperations::add(&_tlhAllocationRate, stats->_tlhAllocationRate);
+	/* looping to set a maximum value in _tlhMaxRefreshSize */
+	for (uintptr_t prevMax = _tlhMaxRefreshSize; prevMax < stats->_tlhMaxRefreshSize; prevMax = _tlhMaxRefreshSize) {
+		MM_AtomicOperations::lockCompareExchange(&_tlhMaxRefreshSize, prevMax, stats->_tlhMaxRefreshSize);
+	}
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (uintptr_t prevMax = _tlhMaxAbandonedListSize; prevMax < stats->_tlhMaxAbandonedListSize;
 	     prevMax = _tlhMaxAbandonedListSize) {
@@ -65,6 +80,10 @@ MM_AllocationStats::merge(MM_AllocationStats* stats)
 		                                         stats->_tlhMaxAbandonedListSize);
 	}
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	MM_AtomicOperations::add(&_magazineRegionRefillCount, stats->_magazineRegionRefillCount);
+	MM_AtomicOperations::add(&_magazineDepotRefillCount, stats->_magazineDepotRefillCount);
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 	MM_AtomicOperations::add(&_arrayletLeafAllocationCount, stats->_arrayletLeafAllocationCount);
 	MM_AtomicOperations::add(&_arrayletLeafAllocationBytes, stats->_arrayletLeafAllocationBytes);
@@ -39,7 +39,15 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhRefreshLockCount; /**< Number of memory pool lock acquisitions made to refresh TLHs. */
+	uintptr_t _tlhRefreshCacheCount; /**< Number of fresh TLHs taken from a memory pool allocation cache without locking. */
+	uintptr_t _tlhAllocationRate; /**< TLH allocation rate in bytes per millisecond, as last observed (summed when merged). */
+	uintptr_t _tlhMaxRefreshSize; /**< The largest refresh size chosen by adaptive TLH sizing. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t _magazineRegionRefillCount; /**< Number of cell cache refills carved from a region while magazines are enabled. */
+	uintptr_t _magazineDepotRefillCount; /**< Number of cell cache refills served by a parked magazine without locking. */
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount; /**< Number of arraylet leaf allocations */
 	uintptr_t _arrayletLeafAllocationBytes; /**< The amount of memory allocated for arraylet leafs */
@@ -84,7 +92,15 @@ public:
 	          _tlhRequestedBytes(0),
 	          _tlhDiscardedBytes(0),
 	          _tlhMaxAbandonedListSize(0),
+	          _tlhRefreshLockCount(0),
+	          _tlhRefreshCacheCount(0),
+	          _tlhAllocationRate(0),
+	          _tlhMaxRefreshSize(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	          _magazineRegionRefillCount(0),
+	          _magazineDepotRefillCount(0),
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	          _arrayletLeafAllocationCount(0),
 	          _arrayletLeafAllocationBytes(0),
 	          _allocationCount(0),
@@ -32,6 +32,7 @@ MM_CardCleaningStats::clear()
 {
 	_cardCleaningTime = 0;
 	_cardsCleaned = 0;
+	_cardsSkipped = 0;
 }
 
 void
@@ -39,4 +40,5 @@ MM_CardCleaningStats::merge(MM_CardCleaningStats* statsToMerge)
 {
 	_cardCleaningTime += statsToMerge->_cardCleaningTime;
 	_cardsCleaned += statsToMerge->_cardsCleaned;
+	_cardsSkipped += statsToMerge->_cardsSkipped;
 }
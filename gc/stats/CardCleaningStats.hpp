@@ -33,6 +33,7 @@ class MM_CardCleaningStats : public MM_Base
 public:
 	uint64_t _cardCleaningTime; /**< Time spent cleaning cards in hi-res clock resolution. */
 	uintptr_t _cardsCleaned; /**< The number of cards cleaned */
+	uintptr_t _cardsSkipped; /**< The number of cards skipped without being read because the card table summary showed them clean */
 
 	/* Function Members */
 public:
@@ -48,6 +48,21 @@ MM_CompactStats::clear()
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+
+	_compactThreads = 0;
+	_movedSubAreas = 0;
+	_fixupSubAreas = 0;
+	_moveTime = 0;
+	_maxMoveTime = 0;
+	_fixupTime = 0;
+	_maxFixupTime = 0;
+	_rootFixupTime = 0;
+	_maxRootFixupTime = 0;
+
+	_slaveID = 0;
+	for (uintptr_t i = 0; i < _threadStatsCount; i++) {
+		_threadStats[i]._compacted = false;
+	}
 };
 
 void
@@ -70,6 +85,27 @@ MM_CompactStats::merge(MM_CompactStats* statsToMerge)
 	        ? statsToMerge->_rootFixupStartTime
 	        : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+
+	/* per thread phase times are kept both as a total and as the longest single thread, whose difference shows imbalance */
+	_compactThreads += statsToMerge->_compactThreads;
+	_movedSubAreas += statsToMerge->_movedSubAreas;
+	_fixupSubAreas += statsToMerge->_fixupSubAreas;
+	_moveTime += statsToMerge->_moveTime;
+	_maxMoveTime = OMR_MAX(_maxMoveTime, statsToMerge->_maxMoveTime);
+	_fixupTime += statsToMerge->_fixupTime;
+	_maxFixupTime = OMR_MAX(_maxFixupTime, statsToMerge->_maxFixupTime);
+	_rootFixupTime += statsToMerge->_rootFixupTime;
+	_maxRootFixupTime = OMR_MAX(_maxRootFixupTime, statsToMerge->_maxRootFixupTime);
+
+	if (statsToMerge->_slaveID < _threadStatsCount) {
+		MM_CompactThreadStats* threadStats = &_threadStats[statsToMerge->_slaveID];
+		threadStats->_compacted = true;
+		threadStats->_movedSubAreas = statsToMerge->_movedSubAreas;
+		threadStats->_fixupSubAreas = statsToMerge->_fixupSubAreas;
+		threadStats->_moveTime = statsToMerge->_moveTime;
+		threadStats->_fixupTime = statsToMerge->_fixupTime;
+		threadStats->_rootFixupTime = statsToMerge->_rootFixupTime;
+	}
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -37,6 +37,20 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #include "Base.hpp"
 
+/**
+ * Phase times of a single GC thread during a compaction.
+ * @ingroup GC_Stats
+ */
+struct MM_CompactThreadStats
+{
+	bool _compacted; /**< True if the thread took part in the compaction */
+	uintptr_t _movedSubAreas; /**< Number of subareas evacuated by the thread */
+	uintptr_t _fixupSubAreas; /**< Number of subareas fixed up by the thread */
+	uint64_t _moveTime; /**< Time in microseconds the thread spent moving objects */
+	uint64_t _fixupTime; /**< Time in microseconds the thread spent fixing up heap objects */
+	uint64_t _rootFixupTime; /**< Time in microseconds the thread spent fixing up roots */
+};
+
 /**
  * Storage for stats relevant to the compaction phase of a collection.
  * @ingroup GC_Stats
@@ -59,6 +73,20 @@ public:
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
 
+	uintptr_t _compactThreads; /**< Number of threads whose stats have been merged */
+	uintptr_t _movedSubAreas; /**< Number of subareas evacuated */
+	uintptr_t _fixupSubAreas; /**< Number of subareas fixed up */
+	uint64_t _moveTime; /**< Time in microseconds spent by all threads moving objects */
+	uint64_t _maxMoveTime; /**< Longest time in microseconds spent by a single thread moving objects */
+	uint64_t _fixupTime; /**< Time in microseconds spent by all threads fixing up heap objects */
+	uint64_t _maxFixupTime; /**< Longest time in microseconds spent by a single thread fixing up heap objects */
+	uint64_t _rootFixupTime; /**< Time in microseconds spent by all threads fixing up roots */
+	uint64_t _maxRootFixupTime; /**< Longest time in microseconds spent by a single thread fixing up roots */
+
+	uintptr_t _slaveID; /**< Slave ID of the thread that gathered thread local stats */
+	MM_CompactThreadStats* _threadStats; /**< Per thread stats indexed by slave ID, or NULL if they are not kept */
+	uintptr_t _threadStatsCount; /**< Number of entries in _threadStats */
+
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
 
@@ -66,9 +94,18 @@ public:
 	uint64_t _endTime; /**< Compact end time */
 
 	void clear();
+	/**
+	 * Merge the stats gathered by one thread. If per thread stats are kept, the thread's phase times are
+	 * recorded in the entry for its slave ID as well.
+	 * @param statsToMerge thread local stats
+	 */
 	void merge(MM_CompactStats* statsToMerge);
 
-	MM_CompactStats() : MM_Base(), _lastHeapCompaction(0), _startTime(0), _endTime(0) { clear(); };
+	MM_CompactStats()
+	        : MM_Base(), _threadStats(NULL), _threadStatsCount(0), _lastHeapCompaction(0), _startTime(0), _endTime(0)
+	{
+		clear();
+	};
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
@@ -49,6 +49,8 @@ public:
 
 	volatile uintptr_t concurrentCleanedCardsPhase3;
 
+	volatile uintptr_t finalSkippedCards;
+
 	MMINLINE void setCount(volatile uintptr_t& counter, uintptr_t count)
 	{
 		MM_AtomicOperations::set((uintptr_t*)&counter, (uintptr_t)count);
@@ -74,6 +76,7 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+		setCount(finalSkippedCards, 0);
 	}
 
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -121,6 +124,12 @@ public:
 		incrementCount(finalCleanedCardsPhase2, numCards);
 	};
 
+	MMINLINE uintptr_t getFinalSkippedCards() { return finalSkippedCards; };
+	MMINLINE void incFinalSkippedCards(uintptr_t numCards)
+	{
+		incrementCount(finalSkippedCards, numCards);
+	};
+
 	/**
 	 * Create a CardTableStats object.
 	 */
@@ -131,7 +140,8 @@ public:
 	          finalCleanedCardsPhase1(0),
 	          concurrentCleanedCardsPhase2(0),
 	          finalCleanedCardsPhase2(0),
-	          concurrentCleanedCardsPhase3(0){};
+	          concurrentCleanedCardsPhase3(0),
+	          finalSkippedCards(0){};
 };
 
 #endif /* CARDTABLESTATS_HPP_ */
@@ -100,6 +100,17 @@ public:
 	 * @}
 	 */
 
+	/**
+	 * Incremental publication statistics.
+	 * @{
+	 */
+	volatile uintptr_t
+	        _publishedBytesConnected; /**< Bytes connected by sweeping threads as soon as they were swept, ahead of any allocation failure */
+	uint64_t _timeToFirstAllocation; /**< Microseconds from the sweep start until swept memory was first available for allocation (0 if none was before the sweep had to be completed for a collection) */
+	/**
+	 * @}
+	 */
+
 	/**
 	 * Force the concurrent sweep mode into a particular state.
 	 * @note This routine should only be used for initialization or clearing.
@@ -168,6 +179,8 @@ public:
 		_completeConnectPhaseTimeStart = 0;
 		_completeConnectPhaseTimeEnd = 0;
 		_completeConnectPhaseBytesConnected = 0;
+		_publishedBytesConnected = 0;
+		_timeToFirstAllocation = 0;
 	}
 
 	MM_ConcurrentSweepStats()
@@ -185,7 +198,9 @@ public:
 	          _completeSweepPhaseBytesSwept(0),
 	          _completeConnectPhaseTimeStart(0),
 	          _completeConnectPhaseTimeEnd(0),
-	          _completeConnectPhaseBytesConnected(0)
+	          _completeConnectPhaseBytesConnected(0),
+	          _publishedBytesConnected(0),
+	          _timeToFirstAllocation(0)
 	{}
 };
 
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(DISPATCHERSTATS_HPP_)
+#define DISPATCHERSTATS_HPP_
+
+#include "modronbase.h"
+#include "omrcomp.h"
+
+/**
+ * Storage for statistics on the tasks run by the dispatcher within a GC cycle.
+ * Times are in hi-res ticks.
+ * @ingroup GC_Stats_Core
+ */
+class MM_DispatcherStats
+{
+public:
+	uintptr_t _taskCount; /**< number of tasks dispatched */
+	uintptr_t _threadsAvailable; /**< sum over the tasks of the threads the dispatcher could have used */
+	uintptr_t _threadsDispatched; /**< sum over the tasks of the threads the tasks ran with */
+	uint64_t _wakeTime; /**< sum over the slave threads of the time from dispatch to the thread accepting its task */
+	uint64_t _maxWakeTime; /**< longest time any slave thread took to accept a task */
+	uint64_t _syncTime; /**< sum over the threads of the time spent waiting for other threads at synchronization points and at task completion */
+	uintptr_t _parkCount; /**< number of times a thread stopped spinning and parked at a synchronization point */
+	uint64_t _maxArrivalSpread; /**< longest time between the first and the last thread arriving at a synchronization point */
+	const char* _maxArrivalSpreadSyncPoint; /**< id of the synchronization point with the longest arrival spread */
+
+	MMINLINE void clear()
+	{
+		_taskCount = 0;
+		_threadsAvailable = 0;
+		_threadsDispatched = 0;
+		_wakeTime = 0;
+		_maxWakeTime = 0;
+		_syncTime = 0;
+		_parkCount = 0;
+		_maxArrivalSpread = 0;
+		_maxArrivalSpreadSyncPoint = NULL;
+	};
+
+	MM_DispatcherStats()
+	        : _taskCount(0),
+	          _threadsAvailable(0),
+	          _threadsDispatched(0),
+	          _wakeTime(0),
+	          _maxWakeTime(0),
+	          _syncTime(0),
+	          _parkCount(0),
+	          _maxArrivalSpread(0),
+	          _maxArrivalSpreadSyncPoint(NULL){};
+};
+
+#endif /* DISPATCHERSTATS_HPP_ */
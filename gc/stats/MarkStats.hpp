@@ -50,6 +50,9 @@ public:
 	uintptr_t
 	        _objectsScanned; /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _arraySplitCount; /**< The number of times the remainder of a large array was pushed to be scanned by any thread */
+	uintptr_t _arraySplitAmount; /**< The number of array elements scanned by the thread which split off the remainder */
+	uintptr_t _arraySplitThreadCount; /**< 1 if the owning thread scanned a split off array part (or, globally, the number of such threads) */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -105,6 +108,9 @@ public:
 	          _objectsMarked(0),
 	          _objectsScanned(0),
 	          _bytesScanned(0),
+	          _arraySplitCount(0),
+	          _arraySplitAmount(0),
+	          _arraySplitThreadCount(0),
 	          _startTime(0),
 	          _endTime(0)
 	{
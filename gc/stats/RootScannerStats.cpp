@@ -35,6 +35,7 @@ MM_RootScannerStats::clear()
 {
 	for (uintptr_t i = 0; i < RootScannerEntity_Count; i++) {
 		_entityScanTime[i] = 0;
+		_entityMaxThreadScanTime[i] = 0;
 	}
 	_statsUsed = false;
 	_maxIncrementTime = 0;
@@ -46,5 +47,7 @@ MM_RootScannerStats::merge(MM_RootScannerStats* statsToMerge)
 {
 	for (uintptr_t i = 0; i < RootScannerEntity_Count; i++) {
 		_entityScanTime[i] += statsToMerge->_entityScanTime[i];
+		_entityMaxThreadScanTime[i] =
+		        OMR_MAX(_entityMaxThreadScanTime[i], statsToMerge->_entityMaxThreadScanTime[i]);
 	}
 }
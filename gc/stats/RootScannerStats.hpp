@@ -32,6 +32,7 @@
 #include "RootScannerTypes.h"
 #include "omrcfg.h"
 #include "omrcomp.h"
+#include "omrgcconsts.h"
 
 class MM_RootScannerStats : public MM_Base
 {
@@ -40,6 +41,8 @@ public:
 	bool _statsUsed; /**< Flag that indicates if the owner thread used the stats for last increment (for any of its roots) */
 	uint64_t _entityScanTime
 	        [RootScannerEntity_Count]; /**< Time spent scanning each root scanner entity per thread.  Values of 0 indicate no time (regardless of clock resolution) spent scanning. */
+	uint64_t _entityMaxThreadScanTime
+	        [RootScannerEntity_Count]; /**< Longest time a single thread spent scanning each root scanner entity.  Compared with _entityScanTime it shows how evenly the entity was shared. */
 	uint64_t _maxIncrementTime; /**< Longest increment */
 	RootScannerEntity _maxIncrementEntity; /**< Entity of the longest increment */
 
@@ -51,9 +54,28 @@ public:
 	 */
 	void clear();
 
+	/**
+	 * Record time the owner thread spent scanning (part of) a root scanner entity.
+	 *
+	 * @param[in] entity	The entity scanned
+	 * @param[in] scanTime	The time spent, in hi-res ticks
+	 */
+	MMINLINE void addEntityScanTime(RootScannerEntity entity, uint64_t scanTime)
+	{
+		/* a scan which took less than the clock resolution still counts as a scan */
+		scanTime = OMR_MAX(scanTime, 1);
+		_statsUsed = true;
+		_entityScanTime[entity] += scanTime;
+		_entityMaxThreadScanTime[entity] = _entityScanTime[entity];
+		if (scanTime > _maxIncrementTime) {
+			_maxIncrementTime = scanTime;
+			_maxIncrementEntity = entity;
+		}
+	}
+
 	/**
 	 * Merges the results from the input MM_RootScannerStats with the statistics contained within
-	 * the instance.
+	 * the instance. Scan times are summed, the longest time of a single thread is kept.
 	 * 
 	 * @param[in] statsToMerge	Root scanner statistics
 	 */
@@ -41,6 +41,9 @@ MM_ScavengerStats::MM_ScavengerStats()
           _failedFlipCount(0),
           _failedFlipBytes(0),
           _tenureAge(0),
+          _localNodeScanCacheCount(0),
+          _scanCacheStealCount(0),
+          _crossNodeScanCacheStealCount(0),
           _startTime(0),
           _endTime(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -67,6 +70,8 @@ MM_ScavengerStats::MM_ScavengerStats()
           _avgInitialFree(0),
           _avgTenureBytes(0),
           _avgTenureBytesDeviation(0),
+          _avgSurvivalRate(0.0),
+          _avgCopyThroughput(0.0),
           _tiltRatio(0),
           _nextScavengeWillPercolate(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -87,6 +92,8 @@ MM_ScavengerStats::MM_ScavengerStats()
           _tenureExpandedBytes(0),
           _tenureExpandedCount(0),
           _tenureExpandedTime(0),
+          _rememberedSetDuplicates(0),
+          _rememberedSetScanTime(0),
           _leafObjectCount(0),
           _copy_cachesize_sum(0),
           _slotsCopied(0),
@@ -156,6 +163,9 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_failedFlipCount = 0;
 	_failedFlipBytes = 0;
 	_tenureAge = 0;
+	_localNodeScanCacheCount = 0;
+	_scanCacheStealCount = 0;
+	_crossNodeScanCacheStealCount = 0;
 	_nextScavengeWillPercolate = false;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_releaseScanListCount = 0;
@@ -192,6 +202,10 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_rememberedSetDuplicates = 0;
+	_rememberedSetScanTime = 0;
+	_rootScannerStats.clear();
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
@@ -26,6 +26,7 @@
 class MM_EnvironmentBase;
 
 #include "Math.hpp"
+#include "RootScannerStats.hpp"
 #include "modronbase.h"
 #include "modronopt.h"
 #include "objectdescription.h"
@@ -76,6 +77,9 @@ public:
 	uintptr_t _failedFlipCount;
 	uintptr_t _failedFlipBytes;
 	uintptr_t _tenureAge;
+	uintptr_t _localNodeScanCacheCount; /**< The number of scan caches taken from the scan list of the thread's own NUMA node */
+	uintptr_t _scanCacheStealCount; /**< The number of scan caches taken from the scan list of another node, or of threads without node affinity */
+	uintptr_t _crossNodeScanCacheStealCount; /**< The number of stolen scan caches whose list belongs to a different NUMA node than the thief's */
 	uint64_t _startTime;
 	uint64_t _endTime;
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -111,6 +115,8 @@ public:
 	uintptr_t _avgInitialFree;
 	uintptr_t _avgTenureBytes;
 	uintptr_t _avgTenureBytesDeviation; /**< The average, weighted deviation of the tenureBytes*/
+	double _avgSurvivalRate; /**< The average, weighted fraction of the evacuated allocate space which survived a scavenge */
+	double _avgCopyThroughput; /**< The average, weighted number of surviving bytes copied or tenured per millisecond of scavenge */
 
 	uintptr_t _tiltRatio; /**< use to pass tiltRatio to verbose */
 
@@ -142,6 +148,10 @@ public:
 	uint64_t
 	        _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
+	uintptr_t _rememberedSetDuplicates; /**< Number of duplicate remembered set entries filtered out instead of being scanned again */
+	uint64_t _rememberedSetScanTime; /**< Time taken by the slowest thread to scan its share of the remembered set, in hi-res ticks */
+	MM_RootScannerStats _rootScannerStats; /**< Time spent scanning each type of root, merged from the threads' MM_EnvironmentBase::_rootScannerStats */
+
 	uint64_t _leafObjectCount;
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
@@ -44,6 +44,9 @@ MM_SweepStats::clear()
 	mergeTime = 0;
 	sweepChunksProcessed = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	_firstAllocatableTime = 0;
+	_timeToFirstAllocation = 0;
 }
 
 void
@@ -55,6 +55,9 @@ public:
 	uint64_t _startTime; /**< Sweep start time */
 	uint64_t _endTime; /**< Sweep end time */
 
+	volatile uint64_t _firstAllocatableTime; /**< Time at which swept memory was first connected to a free list (0 until then) */
+	uint64_t _timeToFirstAllocation; /**< Microseconds from the sweep start until swept memory was first available for allocation */
+
 	void clear();
 	void merge(MM_SweepStats* statsToMerge);
 
@@ -63,7 +66,11 @@ public:
 	void addToMergeTime(uint64_t startTime, uint64_t endTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
-	MM_SweepStats() : MM_Base(), _gcCount(UDATA_MAX), _startTime(0), _endTime(0) { clear(); };
+	MM_SweepStats()
+	        : MM_Base(), _gcCount(UDATA_MAX), _startTime(0), _endTime(0), _firstAllocatableTime(0), _timeToFirstAllocation(0)
+	{
+		clear();
+	};
 };
 
 #endif /* OMR_GC_MODRON_STANDARD || OMR_GC_REALTIME */
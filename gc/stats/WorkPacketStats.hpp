@@ -48,6 +48,10 @@ public:
 	uintptr_t workPacketsReleased;
 	uintptr_t
 	        workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workPacketsPushedLocal; /**< The number of output packets pushed on the thread's own work stealing deque */
+	uintptr_t workPacketsPoppedLocal; /**< The number of input packets popped from the thread's own work stealing deque */
+	uintptr_t workPacketsStolen; /**< The number of input packets stolen from another thread's work stealing deque */
+	uintptr_t workPacketStealAttempts; /**< The number of attempts to steal from a non-empty deque of another thread */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t
 	        _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
@@ -77,6 +81,10 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketsPushedLocal = 0;
+		workPacketsPoppedLocal = 0;
+		workPacketsStolen = 0;
+		workPacketStealAttempts = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -97,6 +105,10 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketsPushedLocal += statsToMerge->workPacketsPushedLocal;
+		workPacketsPoppedLocal += statsToMerge->workPacketsPoppedLocal;
+		workPacketsStolen += statsToMerge->workPacketsStolen;
+		workPacketStealAttempts += statsToMerge->workPacketStealAttempts;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +159,10 @@ public:
 	          workPacketsAcquired(0),
 	          workPacketsReleased(0),
 	          workPacketsExchanged(0),
+	          workPacketsPushedLocal(0),
+	          workPacketsPoppedLocal(0),
+	          workPacketsStolen(0),
+	          workPacketStealAttempts(0),
 	          _workStallCount(0),
 	          _completeStallCount(0),
 	          _workStallTime(0),
@@ -399,6 +399,21 @@ MM_SublistPool::countElements()
 	return _count;
 }
 
+/**
+ * Count the number of elements consumed in the puddles of a sublist pool.
+ * Elements in fragments which have not been flushed back to their puddle are not counted,
+ * so the result is a lower bound while mutators are running.
+ */
+uintptr_t
+MM_SublistPool::countConsumedElements()
+{
+	uintptr_t consumedSize = 0;
+	for (MM_SublistPuddle* puddle = _list; NULL != puddle; puddle = puddle->getNext()) {
+		consumedSize += puddle->consumedSize();
+	}
+	return consumedSize / sizeof(uintptr_t);
+}
+
 void
 MM_SublistPool::startProcessingSublist()
 {
@@ -417,6 +432,52 @@ MM_SublistPool::startProcessingSublist()
 		/* if there is an _allocPuddle it must be empty at this point */
 		Assert_MM_true((NULL == _allocPuddle) || (_allocPuddle->isEmpty()));
 	}
+
+	_previousList = sortPuddlesBySize(_previousList);
+}
+
+MM_SublistPuddle*
+MM_SublistPool::sortPuddlesBySize(MM_SublistPuddle* list)
+{
+	if ((NULL == list) || (NULL == list->getNext())) {
+		return list;
+	}
+
+	/* split the list in two halves */
+	MM_SublistPuddle* slow = list;
+	MM_SublistPuddle* fast = list->getNext();
+	while ((NULL != fast) && (NULL != fast->getNext())) {
+		slow = slow->getNext();
+		fast = fast->getNext()->getNext();
+	}
+	MM_SublistPuddle* second = slow->getNext();
+	slow->setNext(NULL);
+
+	MM_SublistPuddle* first = sortPuddlesBySize(list);
+	second = sortPuddlesBySize(second);
+
+	/* merge the sorted halves, largest first */
+	MM_SublistPuddle* head = NULL;
+	MM_SublistPuddle* tail = NULL;
+	while ((NULL != first) && (NULL != second)) {
+		MM_SublistPuddle* next = NULL;
+		if (first->consumedSize() >= second->consumedSize()) {
+			next = first;
+			first = first->getNext();
+		} else {
+			next = second;
+			second = second->getNext();
+		}
+		if (NULL == tail) {
+			head = next;
+		} else {
+			tail->setNext(next);
+		}
+		tail = next;
+	}
+	tail->setNext((NULL != first) ? first : second);
+
+	return head;
 }
 
 MM_SublistPuddle*
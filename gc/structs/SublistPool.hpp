@@ -75,6 +75,13 @@ private:
 	MM_SublistPuddle* createNewPuddle(MM_EnvironmentBase* env);
 	void freePuddles(MM_EnvironmentBase* env, MM_SublistPuddle* list);
 
+	/**
+	 * Sort a list of puddles by the number of elements they hold, largest first.
+	 * @param list[in] the first puddle of a NULL terminated list
+	 * @return the first puddle of the sorted list
+	 */
+	static MM_SublistPuddle* sortPuddlesBySize(MM_SublistPuddle* list);
+
 protected:
 public:
 	bool initialize(MM_EnvironmentBase* env, OMR::GC::AllocationCategory::Enum category);
@@ -100,6 +107,7 @@ public:
 	}
 
 	uintptr_t countElements();
+	uintptr_t countConsumedElements();
 
 	MMINLINE bool isEmpty() { return _currentSize == 0 ? true : false; };
 
@@ -112,6 +120,7 @@ public:
 	/**
 	 * Prepare to process this sublist by moving all of its non-empty puddles onto
 	 * the list of previous puddles. The puddles may be retrieved by calling #popPreviousPuddle().
+	 * They are handed out largest first, so threads processing them in parallel finish at about the same time.
 	 */
 	void startProcessingSublist();
 
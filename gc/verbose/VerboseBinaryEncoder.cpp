@@ -0,0 +1,461 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseBinaryEncoder.hpp"
+
+#include "AtomicOperations.hpp"
+#include "GCExtensionsBase.hpp"
+#include "VerboseBinaryFormat.hpp"
+#include "VerboseBuffer.hpp"
+#include <string.h>
+
+/*
+ * Records whose length is only known once their body has been appended reserve a varint of this many bytes,
+ * padded with continuation bytes, and patch it afterwards.
+ */
+#define PADDED_LENGTH_SIZE 3
+#define PADDED_LENGTH_MAXIMUM ((1 << (7 * PADDED_LENGTH_SIZE)) - 1)
+
+/* C type of a value consumed by a format string; the signed types come first */
+enum
+{
+	ARGUMENT_INT = 0,
+	ARGUMENT_SCHAR,
+	ARGUMENT_SHORT,
+	ARGUMENT_LONG,
+	ARGUMENT_LONGLONG,
+	ARGUMENT_INTPTR,
+	ARGUMENT_INTMAX,
+	ARGUMENT_PTRDIFF,
+	ARGUMENT_UINT,
+	ARGUMENT_UCHAR,
+	ARGUMENT_USHORT,
+	ARGUMENT_ULONG,
+	ARGUMENT_ULONGLONG,
+	ARGUMENT_UINTPTR,
+	ARGUMENT_UINTMAX,
+	ARGUMENT_UPTRDIFF,
+	ARGUMENT_POINTER,
+	ARGUMENT_STRING,
+	ARGUMENT_DOUBLE
+};
+
+static uintptr_t
+hashFormat(const char* format)
+{
+	/* FNV-1a */
+	uintptr_t hash = (uintptr_t)2166136261U;
+	for (const char* cursor = format; '\0' != *cursor; cursor++) {
+		hash = (hash ^ (uint8_t)*cursor) * 16777619U;
+	}
+	return hash;
+}
+
+static uint8_t
+integerArgumentType(bool isSigned, uintptr_t lengthModifier)
+{
+	uint8_t type = isSigned ? ARGUMENT_INT : ARGUMENT_UINT;
+	switch (lengthModifier) {
+	case VERBOSE_BINARY_LENGTH_HH: type = isSigned ? ARGUMENT_SCHAR : ARGUMENT_UCHAR; break;
+	case VERBOSE_BINARY_LENGTH_H: type = isSigned ? ARGUMENT_SHORT : ARGUMENT_USHORT; break;
+	case VERBOSE_BINARY_LENGTH_L: type = isSigned ? ARGUMENT_LONG : ARGUMENT_ULONG; break;
+	case VERBOSE_BINARY_LENGTH_LL: type = isSigned ? ARGUMENT_LONGLONG : ARGUMENT_ULONGLONG; break;
+	case VERBOSE_BINARY_LENGTH_Z: type = isSigned ? ARGUMENT_INTPTR : ARGUMENT_UINTPTR; break;
+	case VERBOSE_BINARY_LENGTH_J: type = isSigned ? ARGUMENT_INTMAX : ARGUMENT_UINTMAX; break;
+	case VERBOSE_BINARY_LENGTH_T: type = isSigned ? ARGUMENT_PTRDIFF : ARGUMENT_UPTRDIFF; break;
+	default: break;
+	}
+	return type;
+}
+
+/**
+ * Work out the C type of every value consumed by a format string.
+ * @return true if the format string consumes at least one value and every conversion can be encoded
+ */
+static bool
+compileFormat(const char* format, uint8_t* argumentTypes, uintptr_t* argumentCount)
+{
+	uintptr_t count = 0;
+	const char* cursor = strchr(format, '%');
+
+	while (NULL != cursor) {
+		VerboseBinaryConversion conversion;
+		uintptr_t kind = verboseBinaryParseConversion(cursor, &conversion);
+		if (VERBOSE_BINARY_ARGUMENT_INVALID == kind) {
+			return false;
+		}
+		if (VERBOSE_BINARY_ARGUMENT_NONE != kind) {
+			/* a '*' width and precision each consume an int before the value */
+			uintptr_t needed = 1 + (conversion.widthFromArgument ? 1 : 0);
+			needed += conversion.precisionFromArgument ? 1 : 0;
+			if ((count + needed) > VERBOSE_BINARY_MAXIMUM_ARGUMENTS) {
+				return false;
+			}
+			if (conversion.widthFromArgument) {
+				argumentTypes[count++] = ARGUMENT_INT;
+			}
+			if (conversion.precisionFromArgument) {
+				argumentTypes[count++] = ARGUMENT_INT;
+			}
+			switch (kind) {
+			case VERBOSE_BINARY_ARGUMENT_SIGNED:
+				argumentTypes[count++] = integerArgumentType(true, conversion.lengthModifier);
+				break;
+			case VERBOSE_BINARY_ARGUMENT_UNSIGNED:
+				argumentTypes[count++] = integerArgumentType(false, conversion.lengthModifier);
+				break;
+			case VERBOSE_BINARY_ARGUMENT_POINTER: argumentTypes[count++] = ARGUMENT_POINTER; break;
+			case VERBOSE_BINARY_ARGUMENT_STRING: argumentTypes[count++] = ARGUMENT_STRING; break;
+			default: argumentTypes[count++] = ARGUMENT_DOUBLE; break;
+			}
+		}
+		cursor = strchr(cursor + conversion.length, '%');
+	}
+
+	*argumentCount = count;
+	return 0 != count;
+}
+
+MM_VerboseBinaryEncoder::MM_VerboseBinaryEncoder()
+        : MM_Base(), _formats(NULL), _formatCount(0), _formatIndex(NULL), _fileBuffer(NULL)
+{}
+
+MM_VerboseBinaryEncoder*
+MM_VerboseBinaryEncoder::newInstance(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	MM_VerboseBinaryEncoder* encoder = (MM_VerboseBinaryEncoder*)extensions->getForge()->allocate(
+	        sizeof(MM_VerboseBinaryEncoder), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != encoder) {
+		new (encoder) MM_VerboseBinaryEncoder();
+		if (!encoder->initialize(env)) {
+			encoder->kill(env);
+			encoder = NULL;
+		}
+	}
+	return encoder;
+}
+
+void
+MM_VerboseBinaryEncoder::kill(MM_EnvironmentBase* env)
+{
+	tearDown(env);
+	env->getExtensions()->getForge()->free(this);
+}
+
+bool
+MM_VerboseBinaryEncoder::initialize(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	_formats = (FormatEntry*)extensions->getForge()->allocate(sizeof(FormatEntry) * VERBOSE_BINARY_MAXIMUM_FORMATS,
+	                                                          OMR::GC::AllocationCategory::DIAGNOSTIC,
+	                                                          OMR_GET_CALLSITE());
+	if (NULL == _formats) {
+		return false;
+	}
+
+	_formatIndex = (uintptr_t*)extensions->getForge()->allocate(
+	        sizeof(uintptr_t) * VERBOSE_BINARY_FORMAT_INDEX_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC,
+	        OMR_GET_CALLSITE());
+	if (NULL == _formatIndex) {
+		return false;
+	}
+	memset(_formatIndex, 0, sizeof(uintptr_t) * VERBOSE_BINARY_FORMAT_INDEX_SIZE);
+
+	_fileBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	return NULL != _fileBuffer;
+}
+
+void
+MM_VerboseBinaryEncoder::tearDown(MM_EnvironmentBase* env)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	if (NULL != _formats) {
+		for (uintptr_t id = 0; id < _formatCount; id++) {
+			extensions->getForge()->free(_formats[id].format);
+		}
+		extensions->getForge()->free(_formats);
+		_formats = NULL;
+	}
+	_formatCount = 0;
+
+	extensions->getForge()->free(_formatIndex);
+	_formatIndex = NULL;
+
+	if (NULL != _fileBuffer) {
+		_fileBuffer->kill(env);
+		_fileBuffer = NULL;
+	}
+}
+
+uintptr_t
+MM_VerboseBinaryEncoder::findFormat(const char* format, uintptr_t hash)
+{
+	uintptr_t slot = hash & (VERBOSE_BINARY_FORMAT_INDEX_SIZE - 1);
+
+	while (0 != _formatIndex[slot]) {
+		FormatEntry* entry = &_formats[_formatIndex[slot] - 1];
+		if ((hash == entry->hash) && (0 == strcmp(format, entry->format))) {
+			return _formatIndex[slot] - 1;
+		}
+		slot = (slot + 1) & (VERBOSE_BINARY_FORMAT_INDEX_SIZE - 1);
+	}
+
+	return VERBOSE_BINARY_MAXIMUM_FORMATS;
+}
+
+uintptr_t
+MM_VerboseBinaryEncoder::internFormat(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, const char* format,
+                                      uintptr_t hash)
+{
+	uintptr_t id = _formatCount;
+	if (VERBOSE_BINARY_MAXIMUM_FORMATS == id) {
+		return VERBOSE_BINARY_MAXIMUM_FORMATS;
+	}
+
+	FormatEntry* entry = &_formats[id];
+	if (!compileFormat(format, entry->argumentTypes, &entry->argumentCount)) {
+		return VERBOSE_BINARY_MAXIMUM_FORMATS;
+	}
+
+	uintptr_t formatSize = strlen(format) + 1;
+	entry->format = (char*)env->getExtensions()->getForge()->allocate(
+	        formatSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == entry->format) {
+		return VERBOSE_BINARY_MAXIMUM_FORMATS;
+	}
+	memcpy(entry->format, format, formatSize);
+	entry->hash = hash;
+
+	/* the entry is not published until its definition is in the output */
+	uintptr_t definitionStart = buffer->currentSize();
+	if (!appendFormatDefinition(env, buffer, id)) {
+		buffer->truncate(definitionStart);
+		env->getExtensions()->getForge()->free(entry->format);
+		entry->format = NULL;
+		return VERBOSE_BINARY_MAXIMUM_FORMATS;
+	}
+
+	uintptr_t slot = hash & (VERBOSE_BINARY_FORMAT_INDEX_SIZE - 1);
+	while (0 != _formatIndex[slot]) {
+		slot = (slot + 1) & (VERBOSE_BINARY_FORMAT_INDEX_SIZE - 1);
+	}
+	_formatIndex[slot] = id + 1;
+
+	/* writer threads encoding a file start read entries below _formatCount without holding any lock */
+	MM_AtomicOperations::storeSync();
+	_formatCount = id + 1;
+
+	return id;
+}
+
+bool
+MM_VerboseBinaryEncoder::appendVarint(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uint64_t value)
+{
+	uint8_t encoding[VERBOSE_BINARY_MAXIMUM_VARINT_LENGTH];
+	uintptr_t length = verboseBinaryEncodeVarint(value, encoding);
+	return buffer->addBytes(env, encoding, length);
+}
+
+bool
+MM_VerboseBinaryEncoder::appendFormatDefinition(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t id)
+{
+	uint8_t encoding[VERBOSE_BINARY_MAXIMUM_VARINT_LENGTH];
+	const char* format = _formats[id].format;
+	uintptr_t formatLength = strlen(format);
+	uint8_t type = VERBOSE_BINARY_RECORD_FORMAT;
+
+	return appendVarint(env, buffer, 1 + verboseBinaryEncodeVarint(id, encoding) + formatLength)
+	       && buffer->addBytes(env, &type, 1) && appendVarint(env, buffer, id)
+	       && buffer->addBytes(env, format, formatLength);
+}
+
+bool
+MM_VerboseBinaryEncoder::appendText(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, const char* text)
+{
+	uintptr_t textLength = strlen(text);
+	uint8_t type = VERBOSE_BINARY_RECORD_TEXT;
+
+	return appendVarint(env, buffer, 1 + textLength) && buffer->addBytes(env, &type, 1)
+	       && buffer->addBytes(env, text, textLength);
+}
+
+bool
+MM_VerboseBinaryEncoder::completeRecord(MM_VerboseBuffer* buffer, uintptr_t recordStart)
+{
+	uintptr_t bodyLength = buffer->currentSize() - recordStart - PADDED_LENGTH_SIZE;
+	if (bodyLength > PADDED_LENGTH_MAXIMUM) {
+		return false;
+	}
+
+	uint8_t* length = (uint8_t*)buffer->contents() + recordStart;
+	length[0] = (uint8_t)(0x80 | (bodyLength & 0x7F));
+	length[1] = (uint8_t)(0x80 | ((bodyLength >> 7) & 0x7F));
+	length[2] = (uint8_t)((bodyLength >> 14) & 0x7F);
+	return true;
+}
+
+bool
+MM_VerboseBinaryEncoder::appendLiteral(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t indent,
+                                       const char* format, va_list args)
+{
+	static const uint8_t prefix[PADDED_LENGTH_SIZE + 1] = {0, 0, 0, VERBOSE_BINARY_RECORD_LITERAL};
+	uintptr_t recordStart = buffer->currentSize();
+
+	return buffer->addBytes(env, prefix, sizeof(prefix)) && appendVarint(env, buffer, indent)
+	       && buffer->vprintf(env, format, args) && completeRecord(buffer, recordStart);
+}
+
+bool
+MM_VerboseBinaryEncoder::appendArguments(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, FormatEntry* entry,
+                                         va_list args)
+{
+	bool result = true;
+	va_list argsCopy;
+
+	COPY_VA_LIST(argsCopy, args);
+	for (uintptr_t i = 0; result && (i < entry->argumentCount); i++) {
+		uint8_t type = entry->argumentTypes[i];
+		int64_t signedValue = 0;
+		uint64_t unsignedValue = 0;
+
+		switch (type) {
+		case ARGUMENT_INT: signedValue = va_arg(argsCopy, int); break;
+		case ARGUMENT_SCHAR: signedValue = (signed char)va_arg(argsCopy, int); break;
+		case ARGUMENT_SHORT: signedValue = (short)va_arg(argsCopy, int); break;
+		case ARGUMENT_LONG: signedValue = va_arg(argsCopy, long); break;
+		case ARGUMENT_LONGLONG: signedValue = va_arg(argsCopy, long long); break;
+		case ARGUMENT_INTPTR: signedValue = va_arg(argsCopy, intptr_t); break;
+		case ARGUMENT_INTMAX: signedValue = va_arg(argsCopy, intmax_t); break;
+		case ARGUMENT_PTRDIFF: signedValue = va_arg(argsCopy, ptrdiff_t); break;
+		case ARGUMENT_UINT: unsignedValue = va_arg(argsCopy, unsigned int); break;
+		case ARGUMENT_UCHAR: unsignedValue = (unsigned char)va_arg(argsCopy, unsigned int); break;
+		case ARGUMENT_USHORT: unsignedValue = (unsigned short)va_arg(argsCopy, unsigned int); break;
+		case ARGUMENT_ULONG: unsignedValue = va_arg(argsCopy, unsigned long); break;
+		case ARGUMENT_ULONGLONG: unsignedValue = va_arg(argsCopy, unsigned long long); break;
+		case ARGUMENT_UINTPTR: unsignedValue = va_arg(argsCopy, uintptr_t); break;
+		case ARGUMENT_UINTMAX: unsignedValue = va_arg(argsCopy, uintmax_t); break;
+		case ARGUMENT_UPTRDIFF: unsignedValue = (uintptr_t)va_arg(argsCopy, ptrdiff_t); break;
+		case ARGUMENT_POINTER: unsignedValue = (uintptr_t)va_arg(argsCopy, void*); break;
+		case ARGUMENT_STRING: {
+			const char* string = va_arg(argsCopy, const char*);
+			if (NULL == string) {
+				result = appendVarint(env, buffer, 0);
+			} else {
+				uintptr_t stringLength = strlen(string);
+				result = appendVarint(env, buffer, stringLength + 1)
+				         && buffer->addBytes(env, string, stringLength);
+			}
+			break;
+		}
+		case ARGUMENT_DOUBLE: {
+			double value = va_arg(argsCopy, double);
+			uint64_t bits = 0;
+			uint8_t encoding[sizeof(bits)];
+			memcpy(&bits, &value, sizeof(bits));
+			for (uintptr_t byte = 0; byte < sizeof(bits); byte++) {
+				encoding[byte] = (uint8_t)(bits >> (8 * byte));
+			}
+			result = buffer->addBytes(env, encoding, sizeof(encoding));
+			break;
+		}
+		default: Assert_VGC_true(false); break;
+		}
+
+		if (type < ARGUMENT_UINT) {
+			result = appendVarint(env, buffer, verboseBinaryZigzag(signedValue));
+		} else if (type <= ARGUMENT_POINTER) {
+			result = appendVarint(env, buffer, unsignedValue);
+		}
+	}
+	va_end(argsCopy);
+
+	return result;
+}
+
+bool
+MM_VerboseBinaryEncoder::encodeLine(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t indent,
+                                    const char* format, va_list args)
+{
+	uintptr_t hash = hashFormat(format);
+	uintptr_t id = findFormat(format, hash);
+	uintptr_t lineStart = buffer->currentSize();
+	bool result = true;
+
+	if (VERBOSE_BINARY_MAXIMUM_FORMATS == id) {
+		/* a new format string is defined ahead of the line and stays defined if the line is rolled back */
+		id = internFormat(env, buffer, format, hash);
+		lineStart = buffer->currentSize();
+	}
+
+	if (VERBOSE_BINARY_MAXIMUM_FORMATS == id) {
+		/* no conversions, or conversions which can not be encoded */
+		result = appendLiteral(env, buffer, indent, format, args);
+	} else {
+		static const uint8_t prefix[PADDED_LENGTH_SIZE + 1] = {0, 0, 0, VERBOSE_BINARY_RECORD_LINE};
+		result = buffer->addBytes(env, prefix, sizeof(prefix)) && appendVarint(env, buffer, indent)
+		         && appendVarint(env, buffer, id) && appendArguments(env, buffer, &_formats[id], args)
+		         && completeRecord(buffer, lineStart);
+	}
+
+	if (!result) {
+		buffer->truncate(lineStart);
+	}
+
+	return result;
+}
+
+const char*
+MM_VerboseBinaryEncoder::encodeFileStart(MM_EnvironmentBase* env, const char* header, uintptr_t* length)
+{
+	uint8_t fileHeader[VERBOSE_BINARY_FILE_HEADER_LENGTH];
+	bool result = true;
+
+	memcpy(fileHeader, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH);
+	fileHeader[VERBOSE_BINARY_MAGIC_LENGTH] = VERBOSE_BINARY_VERSION;
+	fileHeader[VERBOSE_BINARY_MAGIC_LENGTH + 1] = (uint8_t)sizeof(void*);
+
+	_fileBuffer->reset();
+	result = _fileBuffer->addBytes(env, fileHeader, sizeof(fileHeader)) && appendText(env, _fileBuffer, header);
+
+	uintptr_t formatCount = _formatCount;
+	MM_AtomicOperations::loadSync();
+	for (uintptr_t id = 0; result && (id < formatCount); id++) {
+		result = appendFormatDefinition(env, _fileBuffer, id);
+	}
+
+	*length = _fileBuffer->currentSize();
+	return result ? _fileBuffer->contents() : NULL;
+}
+
+const char*
+MM_VerboseBinaryEncoder::encodeFileText(MM_EnvironmentBase* env, const char* text, uintptr_t* length)
+{
+	_fileBuffer->reset();
+	bool result = appendText(env, _fileBuffer, text);
+
+	*length = _fileBuffer->currentSize();
+	return result ? _fileBuffer->contents() : NULL;
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYENCODER_HPP_)
+#define VERBOSEBINARYENCODER_HPP_
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+#include "modronbase.h"
+#include "omrcfg.h"
+#include "omrstdarg.h"
+
+class MM_VerboseBuffer;
+
+#define VERBOSE_BINARY_MAXIMUM_FORMATS 512
+#define VERBOSE_BINARY_FORMAT_INDEX_SIZE 1024
+#define VERBOSE_BINARY_MAXIMUM_ARGUMENTS 32
+
+/**
+ * Encodes verbose GC output in the binary format described in VerboseBinaryFormat.hpp.
+ *
+ * Format strings are interned by content in a table the first time they are used and written out once as a
+ * VERBOSE_BINARY_RECORD_FORMAT record; every later line only records the id of its format string and the raw
+ * values of its arguments. Lines whose format string has no conversions, or conversions which can not be
+ * encoded, are recorded as formatted text.
+ *
+ * Lines must be encoded by one thread at a time (the reporting thread holding the verbose lock). The file
+ * framing functions may be called by a writer thread concurrently with encodeLine, but not with each other.
+ */
+class MM_VerboseBinaryEncoder : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	struct FormatEntry
+	{
+		char* format; /**< copy of the format string */
+		uintptr_t hash; /**< hash of the format string */
+		uintptr_t argumentCount; /**< number of values consumed by the format string */
+		uint8_t argumentTypes[VERBOSE_BINARY_MAXIMUM_ARGUMENTS]; /**< C type of each value consumed */
+	};
+
+	FormatEntry* _formats; /**< interned format strings, indexed by id */
+	volatile uintptr_t _formatCount; /**< number of entries of _formats which are published */
+	uintptr_t* _formatIndex; /**< open addressed hash table of ids plus one, 0 for an empty slot */
+	MM_VerboseBuffer* _fileBuffer; /**< buffer the file framing records are encoded into */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseBinaryEncoder* newInstance(MM_EnvironmentBase* env);
+	virtual void kill(MM_EnvironmentBase* env);
+
+	/**
+	 * Append one line of output to the buffer. The line is the equivalent of the indent, the format string
+	 * expanded with the arguments and a newline.
+	 * @param env[in] the current thread
+	 * @param buffer[in] the buffer to append to
+	 * @param indent[in] the indentation level of the line
+	 * @param format[in] the printf style format string
+	 * @param args[in] the arguments of the format string
+	 * @return true on success, false if the buffer could not be expanded (nothing is appended)
+	 */
+	bool encodeLine(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t indent, const char* format,
+	                va_list args);
+
+	/**
+	 * Encode the start of a new file: the file header, the given text and the definitions of every
+	 * format string interned so far.
+	 * @param env[in] the current thread
+	 * @param header[in] the text to start the file with
+	 * @param length[out] the number of bytes returned
+	 * @return the encoding, valid until the next call to a file framing function, or NULL on failure
+	 */
+	const char* encodeFileStart(MM_EnvironmentBase* env, const char* header, uintptr_t* length);
+
+	/**
+	 * Encode text to be copied as is to the decoded output, such as a file footer.
+	 * @param env[in] the current thread
+	 * @param text[in] the text
+	 * @param length[out] the number of bytes returned
+	 * @return the encoding, valid until the next call to a file framing function, or NULL on failure
+	 */
+	const char* encodeFileText(MM_EnvironmentBase* env, const char* text, uintptr_t* length);
+
+protected:
+	MM_VerboseBinaryEncoder();
+	bool initialize(MM_EnvironmentBase* env);
+	void tearDown(MM_EnvironmentBase* env);
+
+private:
+	/**
+	 * Find the id of an interned format string.
+	 * @return the id, or VERBOSE_BINARY_MAXIMUM_FORMATS if the format string is not interned
+	 */
+	uintptr_t findFormat(const char* format, uintptr_t hash);
+
+	/**
+	 * Intern a format string which has conversions that can all be encoded, and append its definition.
+	 * @return the id, or VERBOSE_BINARY_MAXIMUM_FORMATS if the format string can not be interned
+	 */
+	uintptr_t internFormat(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, const char* format, uintptr_t hash);
+
+	bool appendVarint(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uint64_t value);
+	bool appendFormatDefinition(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t id);
+	bool appendLiteral(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, uintptr_t indent, const char* format,
+	                   va_list args);
+	bool appendArguments(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, FormatEntry* entry, va_list args);
+	bool appendText(MM_EnvironmentBase* env, MM_VerboseBuffer* buffer, const char* text);
+
+	/**
+	 * Patch the padded length reserved at the start of a record once its body has been appended.
+	 */
+	bool completeRecord(MM_VerboseBuffer* buffer, uintptr_t recordStart);
+};
+
+#endif /* VERBOSEBINARYENCODER_HPP_ */
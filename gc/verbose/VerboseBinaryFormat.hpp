@@ -0,0 +1,271 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEBINARYFORMAT_HPP_)
+#define VERBOSEBINARYFORMAT_HPP_
+
+/*
+ * Binary verbose GC format, written by MM_VerboseBinaryEncoder and read by the vgcdecode tool.
+ * This header is shared with the decoder and must not depend on anything but the C library.
+ *
+ * A file starts with VERBOSE_BINARY_MAGIC, one byte holding VERBOSE_BINARY_VERSION and one byte holding
+ * the size of a pointer on the writing platform. It is followed by records. Each record is a varint
+ * length followed by that many bytes of body; the first byte of the body is the record type.
+ *
+ * VERBOSE_BINARY_RECORD_TEXT: the rest of the body is text copied as is (e.g. the XML header and footer).
+ * VERBOSE_BINARY_RECORD_LITERAL: varint indent, then the text of a line without any conversions.
+ * VERBOSE_BINARY_RECORD_FORMAT: varint id, then a format string. Defines an entry of the string table.
+ * VERBOSE_BINARY_RECORD_LINE: varint indent, varint id of a format string, then one value for each
+ *   conversion of the format string in order. Integers are varints (zigzag encoded if signed) and
+ *   pointers are varints. Strings are a varint of the length plus one, 0 for NULL, followed by the text.
+ *   Doubles are the 8 bytes of their representation, least significant byte first. A '*' width or precision
+ *   is a signed value stored ahead of the value of its conversion.
+ *
+ * A line is rebuilt as two spaces per indent level, the formatted text and a newline. Varints are
+ * little endian base 128 and may have redundant leading continuation bytes. Every file holds the definitions
+ * of the format strings it uses, so each file of a rotating log can be decoded on its own.
+ */
+
+#include <stdint.h>
+
+#define VERBOSE_BINARY_MAGIC "OMRVGCB"
+#define VERBOSE_BINARY_MAGIC_LENGTH 7
+#define VERBOSE_BINARY_VERSION 1
+#define VERBOSE_BINARY_FILE_HEADER_LENGTH (VERBOSE_BINARY_MAGIC_LENGTH + 2)
+#define VERBOSE_BINARY_MAXIMUM_VARINT_LENGTH 10
+
+enum
+{
+	VERBOSE_BINARY_RECORD_TEXT = 1,
+	VERBOSE_BINARY_RECORD_LITERAL = 2,
+	VERBOSE_BINARY_RECORD_FORMAT = 3,
+	VERBOSE_BINARY_RECORD_LINE = 4
+};
+
+/**
+ * Encode a value as a varint.
+ * @param value the value to encode
+ * @param cursor where to write the encoding, which must have room for VERBOSE_BINARY_MAXIMUM_VARINT_LENGTH bytes
+ * @return the number of bytes written
+ */
+inline uintptr_t
+verboseBinaryEncodeVarint(uint64_t value, uint8_t* cursor)
+{
+	uintptr_t length = 0;
+	while (value >= 0x80) {
+		cursor[length++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	cursor[length++] = (uint8_t)value;
+	return length;
+}
+
+/**
+ * Decode a varint.
+ * @param cursor the encoding
+ * @param available the number of bytes available at cursor
+ * @param value[out] the decoded value
+ * @return the number of bytes consumed, or 0 if the encoding is incomplete or too long
+ */
+inline uintptr_t
+verboseBinaryDecodeVarint(const uint8_t* cursor, uintptr_t available, uint64_t* value)
+{
+	uint64_t result = 0;
+	uintptr_t shift = 0;
+	for (uintptr_t length = 0; (length < available) && (shift < 64); length++) {
+		result |= (uint64_t)(cursor[length] & 0x7F) << shift;
+		if (0 == (cursor[length] & 0x80)) {
+			*value = result;
+			return length + 1;
+		}
+		shift += 7;
+	}
+	return 0;
+}
+
+/**
+ * Map a signed value to an unsigned one so that values of small magnitude have short varints.
+ */
+inline uint64_t
+verboseBinaryZigzag(int64_t value)
+{
+	return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/**
+ * Inverse of verboseBinaryZigzag.
+ */
+inline int64_t
+verboseBinaryUnzigzag(uint64_t value)
+{
+	return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+/* Length modifiers of a conversion */
+enum
+{
+	VERBOSE_BINARY_LENGTH_NONE = 0,
+	VERBOSE_BINARY_LENGTH_HH,
+	VERBOSE_BINARY_LENGTH_H,
+	VERBOSE_BINARY_LENGTH_L,
+	VERBOSE_BINARY_LENGTH_LL,
+	VERBOSE_BINARY_LENGTH_Z,
+	VERBOSE_BINARY_LENGTH_J,
+	VERBOSE_BINARY_LENGTH_T,
+	VERBOSE_BINARY_LENGTH_LONG_DOUBLE
+};
+
+/* How the value consumed by a conversion is stored in a VERBOSE_BINARY_RECORD_LINE */
+enum
+{
+	VERBOSE_BINARY_ARGUMENT_INVALID = 0, /**< the conversion can not be encoded */
+	VERBOSE_BINARY_ARGUMENT_NONE, /**< %%, no value */
+	VERBOSE_BINARY_ARGUMENT_SIGNED, /**< zigzag varint */
+	VERBOSE_BINARY_ARGUMENT_UNSIGNED, /**< varint */
+	VERBOSE_BINARY_ARGUMENT_POINTER, /**< varint */
+	VERBOSE_BINARY_ARGUMENT_STRING, /**< varint length plus one, then the text */
+	VERBOSE_BINARY_ARGUMENT_DOUBLE /**< 8 bytes */
+};
+
+/**
+ * A conversion specification of a format string, as parsed by verboseBinaryParseConversion.
+ * Offsets are relative to the '%' starting the specification.
+ */
+struct VerboseBinaryConversion
+{
+	uintptr_t length; /**< length of the whole specification */
+	uintptr_t flagsLength; /**< length of the flags, which start at offset 1 */
+	uintptr_t widthOffset; /**< offset of the width digits */
+	uintptr_t widthLength; /**< number of width digits, 0 if there is no width or it is taken from an argument */
+	bool widthFromArgument; /**< true if the width is '*' */
+	bool hasPrecision; /**< true if a precision was specified */
+	uintptr_t precisionOffset; /**< offset of the precision digits */
+	uintptr_t precisionLength; /**< number of precision digits */
+	bool precisionFromArgument; /**< true if the precision is '*' */
+	uintptr_t lengthModifier; /**< one of VERBOSE_BINARY_LENGTH_* */
+	char conversion; /**< the conversion character */
+};
+
+/**
+ * Parse a printf style conversion specification. The encoder and the decoder both walk format strings
+ * with this function so that they agree on the values a format string consumes.
+ * @param format points at the '%' starting the specification
+ * @param conversion[out] the parsed specification
+ * @return the VERBOSE_BINARY_ARGUMENT_* kind of the value consumed by the conversion
+ */
+inline uintptr_t
+verboseBinaryParseConversion(const char* format, VerboseBinaryConversion* conversion)
+{
+	uintptr_t cursor = 1;
+
+	while (('-' == format[cursor]) || ('+' == format[cursor]) || (' ' == format[cursor]) || ('#' == format[cursor])
+	       || ('0' == format[cursor])) {
+		cursor += 1;
+	}
+	conversion->flagsLength = cursor - 1;
+
+	conversion->widthOffset = cursor;
+	conversion->widthFromArgument = ('*' == format[cursor]);
+	if (conversion->widthFromArgument) {
+		cursor += 1;
+	} else {
+		while (('0' <= format[cursor]) && ('9' >= format[cursor])) {
+			cursor += 1;
+		}
+	}
+	conversion->widthLength = conversion->widthFromArgument ? 0 : (cursor - conversion->widthOffset);
+
+	conversion->hasPrecision = ('.' == format[cursor]);
+	conversion->precisionFromArgument = false;
+	conversion->precisionLength = 0;
+	if (conversion->hasPrecision) {
+		cursor += 1;
+		conversion->precisionOffset = cursor;
+		conversion->precisionFromArgument = ('*' == format[cursor]);
+		if (conversion->precisionFromArgument) {
+			cursor += 1;
+		} else {
+			while (('0' <= format[cursor]) && ('9' >= format[cursor])) {
+				cursor += 1;
+			}
+			conversion->precisionLength = cursor - conversion->precisionOffset;
+		}
+	}
+
+	conversion->lengthModifier = VERBOSE_BINARY_LENGTH_NONE;
+	switch (format[cursor]) {
+	case 'h':
+		cursor += 1;
+		conversion->lengthModifier = VERBOSE_BINARY_LENGTH_H;
+		if ('h' == format[cursor]) {
+			cursor += 1;
+			conversion->lengthModifier = VERBOSE_BINARY_LENGTH_HH;
+		}
+		break;
+	case 'l':
+		cursor += 1;
+		conversion->lengthModifier = VERBOSE_BINARY_LENGTH_L;
+		if ('l' == format[cursor]) {
+			cursor += 1;
+			conversion->lengthModifier = VERBOSE_BINARY_LENGTH_LL;
+		}
+		break;
+	case 'z': cursor += 1; conversion->lengthModifier = VERBOSE_BINARY_LENGTH_Z; break;
+	case 'j': cursor += 1; conversion->lengthModifier = VERBOSE_BINARY_LENGTH_J; break;
+	case 't': cursor += 1; conversion->lengthModifier = VERBOSE_BINARY_LENGTH_T; break;
+	case 'L': cursor += 1; conversion->lengthModifier = VERBOSE_BINARY_LENGTH_LONG_DOUBLE; break;
+	default: break;
+	}
+
+	conversion->conversion = format[cursor];
+	conversion->length = ('\0' == format[cursor]) ? cursor : (cursor + 1);
+
+	switch (conversion->conversion) {
+	case '%': return (2 == conversion->length) ? VERBOSE_BINARY_ARGUMENT_NONE : VERBOSE_BINARY_ARGUMENT_INVALID;
+	case 'd':
+	case 'i': return VERBOSE_BINARY_ARGUMENT_SIGNED;
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X': return VERBOSE_BINARY_ARGUMENT_UNSIGNED;
+	case 'c':
+		return (VERBOSE_BINARY_LENGTH_NONE == conversion->lengthModifier) ? VERBOSE_BINARY_ARGUMENT_UNSIGNED
+		                                                                    : VERBOSE_BINARY_ARGUMENT_INVALID;
+	case 'p': return VERBOSE_BINARY_ARGUMENT_POINTER;
+	case 's':
+		return (VERBOSE_BINARY_LENGTH_NONE == conversion->lengthModifier) ? VERBOSE_BINARY_ARGUMENT_STRING
+		                                                                    : VERBOSE_BINARY_ARGUMENT_INVALID;
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+		/* long double has no portable encoding */
+		return (VERBOSE_BINARY_LENGTH_LONG_DOUBLE == conversion->lengthModifier)
+		               ? VERBOSE_BINARY_ARGUMENT_INVALID
+		               : VERBOSE_BINARY_ARGUMENT_DOUBLE;
+	default: return VERBOSE_BINARY_ARGUMENT_INVALID;
+	}
+}
+
+#endif /* VERBOSEBINARYFORMAT_HPP_ */
@@ -125,6 +125,23 @@ MM_VerboseBuffer::add(MM_EnvironmentBase* env, const char* string)
 	return result;
 }
 
+bool
+MM_VerboseBuffer::addBytes(MM_EnvironmentBase* env, const void* bytes, uintptr_t length)
+{
+	bool result = true;
+
+	if (ensureCapacity(env, length + 1)) {
+		memcpy(_bufferAlloc, bytes, length);
+		_bufferAlloc += length;
+		_bufferAlloc[0] = '\0';
+		result = true;
+	} else {
+		result = false;
+	}
+
+	return result;
+}
+
 bool
 MM_VerboseBuffer::ensureCapacity(MM_EnvironmentBase* env, uintptr_t spaceNeeded)
 {
@@ -148,9 +165,10 @@ MM_VerboseBuffer::ensureCapacity(MM_EnvironmentBase* env, uintptr_t spaceNeeded)
 			_bufferTop = _buffer + newSize;
 			reset();
 
-			/* Copy across the contents of the old buffer */
-			strcpy(_buffer, oldBuffer);
+			/* Copy across the contents of the old buffer, which may hold binary records */
+			memcpy(_buffer, oldBuffer, currentSize);
 			_bufferAlloc += currentSize;
+			_bufferAlloc[0] = '\0';
 
 			/* Delete the old buffer */
 			extensions->getForge()->free(oldBuffer);
@@ -89,6 +89,25 @@ public:
 	 */
 	bool add(MM_EnvironmentBase* env, const char* string);
 
+	/**
+	 * Append the specified bytes, which may include NUL bytes, to the buffer.
+	 * @param env[in] the current thread
+	 * @param bytes[in] the bytes to append
+	 * @param length[in] the number of bytes to append
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool addBytes(MM_EnvironmentBase* env, const void* bytes, uintptr_t length);
+
+	/**
+	 * Discard everything appended to the buffer after the given size.
+	 * @param size[in] a size previously returned by currentSize()
+	 */
+	MMINLINE void truncate(uintptr_t size)
+	{
+		_bufferAlloc = _buffer + size;
+		_bufferAlloc[0] = '\0';
+	}
+
 	/**
 	 * Format the specified data and append it to the buffer.
 	 * @param env[in] the current thread
@@ -39,6 +39,8 @@ static void
 verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void
 verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void
+verboseHandlerHeapPretouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput*
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase* env, MM_VerboseManager* manager)
@@ -107,6 +109,9 @@ MM_VerboseHandlerOutput::enableVerbose()
 	(*_mmPrivateHooks)
 	        ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize,
 	                                     OMR_GET_CALLSITE(), (void*)this);
+	(*_mmPrivateHooks)
+	        ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPretouch,
+	                                     OMR_GET_CALLSITE(), (void*)this);
 
 	return;
 }
@@ -118,6 +123,8 @@ MM_VerboseHandlerOutput::disableVerbose()
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, NULL);
 	(*_mmPrivateHooks)
 	        ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)
+	        ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPretouch, NULL);
 
 	return;
 }
@@ -829,6 +836,41 @@ MM_VerboseHandlerOutput::outputMemoryInfo(MM_EnvironmentBase* env, uintptr_t ind
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutput::outputDispatcherStats(MM_EnvironmentBase* env, uintptr_t indent)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_DispatcherStats* stats = &env->getExtensions()->dispatcherStats;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 != stats->_taskCount) {
+		uint64_t wakeTime = omrtime_hires_delta(0, stats->_wakeTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t maxWakeTime = omrtime_hires_delta(0, stats->_maxWakeTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t syncTime = omrtime_hires_delta(0, stats->_syncTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t arrivalSpread =
+		        omrtime_hires_delta(0, stats->_maxArrivalSpread, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (NULL == stats->_maxArrivalSpreadSyncPoint) {
+			writer->formatAndOutput(env, indent,
+			                        "<dispatcher-threads tasks=\"%zu\" available=\"%zu\" dispatched=\"%zu\" "
+			                        "waketotalms=\"%llu.%03llu\" wakemaxms=\"%llu.%03llu\" "
+			                        "synctotalms=\"%llu.%03llu\" parked=\"%zu\" />",
+			                        stats->_taskCount, stats->_threadsAvailable, stats->_threadsDispatched,
+			                        wakeTime / 1000, wakeTime % 1000, maxWakeTime / 1000, maxWakeTime % 1000,
+			                        syncTime / 1000, syncTime % 1000, stats->_parkCount);
+		} else {
+			writer->formatAndOutput(
+			        env, indent,
+			        "<dispatcher-threads tasks=\"%zu\" available=\"%zu\" dispatched=\"%zu\" "
+			        "waketotalms=\"%llu.%03llu\" wakemaxms=\"%llu.%03llu\" synctotalms=\"%llu.%03llu\" "
+			        "parked=\"%zu\" arrivalspreadmaxms=\"%llu.%03llu\" arrivalspreadmaxat=\"%s\" />",
+			        stats->_taskCount, stats->_threadsAvailable, stats->_threadsDispatched, wakeTime / 1000,
+			        wakeTime % 1000, maxWakeTime / 1000, maxWakeTime % 1000, syncTime / 1000,
+			        syncTime % 1000, stats->_parkCount, arrivalSpread / 1000, arrivalSpread % 1000,
+			        stats->_maxArrivalSpreadSyncPoint);
+		}
+	}
+}
+
 bool
 MM_VerboseHandlerOutput::hasOutputMemoryInfoInnerStanza()
 {
@@ -863,6 +905,30 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />",
 		                        systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (_extensions->tlhAdaptiveSizing) {
+			uintptr_t refreshCount = systemStats->_tlhRefreshCountFresh + systemStats->_tlhRefreshCountReused;
+			uintptr_t averageSize = 0;
+			if (0 != refreshCount) {
+				averageSize = (systemStats->_tlhAllocatedFresh + systemStats->_tlhAllocatedReused) / refreshCount;
+			}
+			writer->formatAndOutput(env, 1,
+			                        "<tlh-sizing refreshes=\"%zu\" averageSize=\"%zu\" maxSize=\"%zu\" "
+			                        "allocationRate=\"%zu\" discarded=\"%zu\" />",
+			                        refreshCount, averageSize, systemStats->_tlhMaxRefreshSize,
+			                        systemStats->_tlhAllocationRate, systemStats->_tlhDiscardedBytes);
+		}
+		if (0 != _extensions->tlhAllocationCacheCount) {
+			writer->formatAndOutput(env, 1, "<tlh-cache lockRefreshes=\"%zu\" cacheRefreshes=\"%zu\" />",
+			                        systemStats->_tlhRefreshLockCount, systemStats->_tlhRefreshCacheCount);
+		}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		if (_extensions->isSegregatedHeap() && (0 != _extensions->allocationCacheMagazineSize)) {
+			writer->formatAndOutput(env, 1, "<cell-magazines regionRefills=\"%zu\" depotRefills=\"%zu\" />",
+			                        systemStats->_magazineRegionRefillCount, systemStats->_magazineDepotRefillCount);
+		}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -948,6 +1014,7 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	}
 	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
+	outputDispatcherStats(env, _manager->getIndentLevel() + 1);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
 }
@@ -1045,6 +1112,35 @@ MM_VerboseHandlerOutput::handleHeapResize(J9HookInterface** hook, uintptr_t even
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutput::handleHeapPretouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapPretouchEvent* event = (MM_HeapPretouchEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uint64_t timeInMicroSeconds = event->timeTaken;
+	uintptr_t coverage = 0;
+	char tagTemplate[200];
+
+	if (0 != event->heapSize) {
+		coverage = (uintptr_t)(((uint64_t)event->pretouchedHeapBytes * 100) / event->heapSize);
+	}
+
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), omrtime_current_time_millis());
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, _manager->getIndentLevel(),
+	                        "<heap-pretouch id=\"%zu\" type=\"%s\" amount=\"%zu\" touched=\"%zu\" "
+	                        "numaBound=\"%zu\" threads=\"%zu\" timems=\"%llu.%03llu\" coverage=\"%zu%%\" %s />",
+	                        _manager->getIdAndIncrement(),
+	                        (HEAP_PRETOUCH_STARTUP == event->pretouchType) ? "startup" : "expand", event->amount,
+	                        event->touchedBytes, event->boundBytes, event->threadCount, timeInMicroSeconds / 1000,
+	                        timeInMicroSeconds % 1000, coverage, tagTemplate);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase* env,
                                               uintptr_t indent,
@@ -1198,3 +1294,9 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 {
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerHeapPretouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleHeapPretouch(hook, eventNum, eventData);
+}
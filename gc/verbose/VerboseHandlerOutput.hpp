@@ -200,6 +200,15 @@ protected:
 
 	virtual bool hasOutputMemoryInfoInnerStanza();
 
+	/**
+	 * Output a stand-alone stanza on how many threads the dispatcher woke for the tasks of the cycle,
+	 * how long they took to wake and to synchronize, and the synchronization point with the slowest arrival.
+	 * Nothing is written if no task was dispatched.
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	void outputDispatcherStats(MM_EnvironmentBase* env, uintptr_t indent);
+
 	virtual void
 	outputMemoryInfoInnerStanza(MM_EnvironmentBase* env, uintptr_t indent, MM_CollectionStatistics* stats);
 
@@ -509,6 +518,14 @@ public:
 
 	void handleHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the verbose stanza for a heap pre-touch.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleHeapPretouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
 	/**
 	 * Write the verbose stanza for the excessive gc raised event.
 	 * @param hook Hook interface used by the JVM.
@@ -29,6 +29,7 @@
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterHook.hpp"
@@ -234,6 +235,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase* env, char* filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->asyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -259,6 +264,12 @@ MM_VerboseManager::configureVerboseGC(OMR_VM* omrVM, char* filename, uintptr_t f
 
 	WriterType type = parseWriterType(&env, filename, fileCount, iterations);
 
+	/* only log files hold the binary format. The format is selected before the writer opens its first file,
+	 * since the file header is written in the format in effect when the file is opened.
+	 */
+	bool binaryFormat = env.getExtensions()->verboseBinaryFormat && isFileWriterType(type);
+	_writerChain->setBinaryFormat(&env, binaryFormat);
+
 	writer = findWriterInChain(type);
 
 	if (NULL != writer) {
@@ -274,11 +285,23 @@ MM_VerboseManager::configureVerboseGC(OMR_VM* omrVM, char* filename, uintptr_t f
 		_writerChain->addWriter(writer);
 	}
 
+	/* a file writer which could not open its file falls back to a stream, which gets text */
+	if (binaryFormat && !isFileWriterType(writer->getType())) {
+		_writerChain->setBinaryFormat(&env, false);
+	}
+
 	writer->isActive(true);
 
 	return true;
 }
 
+bool
+MM_VerboseManager::isFileWriterType(WriterType type)
+{
+	return (VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS == type) || (VERBOSE_WRITER_FILE_LOGGING_BUFFERED == type)
+	       || (VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS == type);
+}
+
 MM_VerboseWriter*
 MM_VerboseManager::createWriter(MM_EnvironmentBase* env,
                                 WriterType type,
@@ -315,6 +338,18 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase* env,
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default: return NULL;
 	}
@@ -94,6 +94,11 @@ protected:
 	virtual WriterType
 	parseWriterType(MM_EnvironmentBase* env, char* filename, uintptr_t fileCount, uintptr_t iterations);
 
+	/**
+	 * @return true if writers of the given type log to files, the only writers which hold the binary format
+	 */
+	static bool isFileWriterType(WriterType type);
+
 public:
 	/* Interface for Dynamic Configuration */
 	virtual bool configureVerboseGC(OMR_VM* vm, char* filename, uintptr_t fileCount, uintptr_t iterations);
@@ -34,7 +34,8 @@ typedef enum
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -68,6 +69,15 @@ public:
 
 	virtual void outputString(MM_EnvironmentBase* env, const char* string) = 0;
 
+	/**
+	 * Output records of the binary verbose format. Only writers to files support the binary format,
+	 * the default implementation discards the records.
+	 * @param env[in] the current thread
+	 * @param bytes[in] the encoded records
+	 * @param length[in] the number of bytes to output
+	 */
+	virtual void outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length) {}
+
 	virtual bool
 	reconfigure(MM_EnvironmentBase* env, const char* filename, uintptr_t fileCount, uintptr_t iterations) = 0;
 
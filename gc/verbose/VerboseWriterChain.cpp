@@ -23,6 +23,7 @@
 #include "VerboseWriterChain.hpp"
 
 #include "GCExtensionsBase.hpp"
+#include "VerboseBinaryEncoder.hpp"
 #include "VerboseBuffer.hpp"
 #include "VerboseWriter.hpp"
 
@@ -33,7 +34,9 @@
 
 #define INDENT_SPACER "  "
 
-MM_VerboseWriterChain::MM_VerboseWriterChain() : MM_Base(), _buffer(NULL), _writers(NULL) {}
+MM_VerboseWriterChain::MM_VerboseWriterChain()
+        : MM_Base(), _buffer(NULL), _writers(NULL), _binaryEncoder(NULL), _binaryFormat(false)
+{}
 
 MM_VerboseWriterChain*
 MM_VerboseWriterChain::newInstance(MM_EnvironmentBase* env)
@@ -58,6 +61,11 @@ MM_VerboseWriterChain::formatAndOutputV(MM_EnvironmentBase* env, uintptr_t inden
 	/* Ensure we have a  buffer. */
 	Assert_VGC_true(NULL != _buffer);
 
+	if (_binaryFormat) {
+		_binaryEncoder->encodeLine(env, _buffer, indent, format, args);
+		return;
+	}
+
 	for (uintptr_t i = 0; i < indent; ++i) {
 		_buffer->add(env, INDENT_SPACER);
 	}
@@ -81,7 +89,11 @@ MM_VerboseWriterChain::flush(MM_EnvironmentBase* env)
 {
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (_binaryFormat) {
+			writer->outputBinary(env, _buffer->contents(), _buffer->currentSize());
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
@@ -101,6 +113,12 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		writer = nextWriter;
 	}
 	_writers = NULL;
+	/* writers closing their files use the encoder, so it goes last */
+	if (NULL != _binaryEncoder) {
+		_binaryEncoder->kill(env);
+		_binaryEncoder = NULL;
+	}
+	_binaryFormat = false;
 }
 
 void
@@ -130,6 +148,20 @@ MM_VerboseWriterChain::addWriter(MM_VerboseWriter* writer)
 	_writers = writer;
 }
 
+bool
+MM_VerboseWriterChain::setBinaryFormat(MM_EnvironmentBase* env, bool binaryFormat)
+{
+	if (binaryFormat && (NULL == _binaryEncoder)) {
+		_binaryEncoder = MM_VerboseBinaryEncoder::newInstance(env);
+		if (NULL == _binaryEncoder) {
+			_binaryFormat = false;
+			return false;
+		}
+	}
+	_binaryFormat = binaryFormat;
+	return true;
+}
+
 void
 MM_VerboseWriterChain::endOfCycle(MM_EnvironmentBase* env)
 {
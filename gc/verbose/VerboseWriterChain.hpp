@@ -29,6 +29,7 @@
 #include "omrcfg.h"
 #include "omrstdarg.h"
 
+class MM_VerboseBinaryEncoder;
 class MM_VerboseBuffer;
 class MM_VerboseWriter;
 
@@ -43,6 +44,8 @@ protected:
 private:
 	MM_VerboseBuffer* _buffer;
 	MM_VerboseWriter* _writers;
+	MM_VerboseBinaryEncoder* _binaryEncoder; /**< created the first time binary output is requested */
+	bool _binaryFormat; /**< true if output is encoded with _binaryEncoder rather than formatted as text */
 
 public:
 	static MM_VerboseWriterChain* newInstance(MM_EnvironmentBase* env);
@@ -71,6 +74,20 @@ public:
 	 */
 	void endOfCycle(MM_EnvironmentBase* env);
 
+	/**
+	 * Select whether output is formatted as text or encoded in the binary verbose format. Must be called
+	 * between stanzas, and only when every active writer supports the selected format.
+	 * @param env[in] the current thread
+	 * @param binaryFormat[in] true to encode output in the binary format
+	 * @return true on success, false if the binary encoder could not be created (output remains text)
+	 */
+	bool setBinaryFormat(MM_EnvironmentBase* env, bool binaryFormat);
+
+	/**
+	 * @return the binary encoder if output is currently encoded in the binary format, NULL otherwise
+	 */
+	MM_VerboseBinaryEncoder* getBinaryEncoder() { return _binaryFormat ? _binaryEncoder : NULL; }
+
 protected:
 	MM_VerboseWriterChain();
 	void tearDown(MM_EnvironmentBase* env);
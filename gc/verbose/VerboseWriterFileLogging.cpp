@@ -25,6 +25,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
 #include "modronapicore.hpp"
 #include <string.h>
 
@@ -43,7 +44,8 @@ MM_VerboseWriterFileLogging::MM_VerboseWriterFileLogging(MM_EnvironmentBase* env
           _currentFile(0),
           _currentCycle(0),
           _tokens(NULL),
-          _manager(manager)
+          _manager(manager),
+          _binaryEncoder(NULL)
 {
 	/* No implementation */
 }
@@ -318,6 +320,12 @@ MM_VerboseWriterFileLogging::endOfCycle(MM_EnvironmentBase* env)
 	}
 }
 
+void
+MM_VerboseWriterFileLogging::selectFileFormat()
+{
+	_binaryEncoder = _manager->getWriterChain()->getBinaryEncoder();
+}
+
 /**
  * Reconfigures the agent according to the parameters passed.
  * Required for Dynamic verbose gc configuration.
@@ -26,6 +26,7 @@
 #include "VerboseWriter.hpp"
 #include "omrcfg.h"
 
+class MM_VerboseBinaryEncoder;
 class MM_VerboseManager;
 
 /**
@@ -49,6 +50,7 @@ protected:
 	J9StringTokens* _tokens; /**< tokens used during filename expansion */
 
 	MM_VerboseManager* _manager; /**< Verbose manager */
+	MM_VerboseBinaryEncoder* _binaryEncoder; /**< encoder the current file is framed with, NULL for a text file */
 private:
 	/*
 	 * Function members
@@ -72,6 +74,12 @@ protected:
 	virtual bool openFile(MM_EnvironmentBase* env) = 0;
 	virtual void closeFile(MM_EnvironmentBase* env) = 0;
 
+	/**
+	 * Latch the output format selected in the writer chain for the file about to be opened.
+	 * Must be called by openFile before writing the header.
+	 */
+	void selectFileFormat();
+
 	intptr_t findInitialFile(MM_EnvironmentBase* env);
 	bool initializeFilename(MM_EnvironmentBase* env, const char* filename);
 	bool initializeTokens(MM_EnvironmentBase* env);
@@ -0,0 +1,512 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "VerboseBinaryEncoder.hpp"
+#include "VerboseManager.hpp"
+#include "modronapicore.hpp"
+#include "omrutil.h"
+#include <string.h>
+
+#define VERBOSE_ASYNC_MINIMUM_BUFFER_SIZE (64 * 1024)
+#define VERBOSE_ASYNC_FLUSH_INTERVAL_MILLIS 100
+
+/* Record header layout: the length of the text above the flag bits. A zero header is an uncommitted record. */
+enum
+{
+	RECORD_COMMITTED = 1,
+	RECORD_END_OF_CYCLE = 2,
+	RECORD_LENGTH_SHIFT = 2
+};
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase* env,
+                                                                                 MM_VerboseManager* manager)
+        : MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS),
+          _omrVM(env->getOmrVM()),
+          _logFileStream(NULL),
+          _buffer(NULL),
+          _bufferSize(0),
+          _reserved(0),
+          _consumed(0),
+          _droppedRecords(0),
+          _droppedBytes(0),
+          _reportedDroppedRecords(0),
+          _reportedDroppedBytes(0),
+          _flushMonitor(NULL),
+          _flushThreadState(STATE_NOT_STARTED)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous*
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase* env,
+                                                     MM_VerboseManager* manager,
+                                                     char* filename,
+                                                     uintptr_t numFiles,
+                                                     uintptr_t numCycles)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous* agent =
+	        (MM_VerboseWriterFileLoggingAsynchronous*)extensions->getForge()->allocate(
+	                sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC,
+	                OMR_GET_CALLSITE());
+	if (agent) {
+		new (agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if (!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance.
+ * The ring buffer and monitor are kept across reconfiguration; the flush thread is restarted.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase* env,
+                                                    const char* filename,
+                                                    uintptr_t numFiles,
+                                                    uintptr_t numCycles)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+
+	if (NULL == _buffer) {
+		_bufferSize = VERBOSE_ASYNC_MINIMUM_BUFFER_SIZE;
+		while (_bufferSize < extensions->asyncLoggingBufferSize) {
+			_bufferSize <<= 1;
+		}
+		_buffer = (char*)extensions->getForge()->allocate(_bufferSize, OMR::GC::AllocationCategory::DIAGNOSTIC,
+		                                                  OMR_GET_CALLSITE());
+		if (NULL == _buffer) {
+			return false;
+		}
+		memset(_buffer, 0, _bufferSize);
+	}
+
+	if (NULL == _flushMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_flushMonitor, 0,
+		                                          "MM_VerboseWriterFileLoggingAsynchronous::_flushMonitor")) {
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLogging::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	startFlushThread(env);
+
+	return true;
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the flush thread and frees the ring buffer.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase* env)
+{
+	stopFlushThread(env);
+
+	if (NULL != _flushMonitor) {
+		omrthread_monitor_destroy(_flushMonitor);
+		_flushMonitor = NULL;
+	}
+
+	env->getExtensions()->getForge()->free(_buffer);
+	_buffer = NULL;
+
+	MM_VerboseWriterFileLogging::tearDown(env);
+}
+
+/**
+ * Opens the file to log output to and prints the header.
+ * @return true on sucess, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::openFile(MM_EnvironmentBase* env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	const char* version = omrgc_get_version(env->getOmrVM());
+
+	selectFileFormat();
+
+	char* filenameToOpen = expandFilename(env, _currentFile);
+	if (NULL == filenameToOpen) {
+		return false;
+	}
+
+	_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (NULL == _logFileStream) {
+		char* cursor = filenameToOpen;
+		/**
+		 * This may have failed due to directories in the path not being available.
+		 * Try to create these directories and attempt to open again before failing.
+		 */
+		while ((cursor = strchr(++cursor, DIR_SEPARATOR)) != NULL) {
+			*cursor = '\0';
+			omrfile_mkdir(filenameToOpen);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		/* Try again */
+		_logFileStream = omrfilestream_open(filenameToOpen, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (NULL == _logFileStream) {
+			_manager->handleFileOpenError(env, filenameToOpen);
+			extensions->getForge()->free(filenameToOpen);
+			return false;
+		}
+	}
+
+	extensions->getForge()->free(filenameToOpen);
+
+	if (NULL != _binaryEncoder) {
+		uintptr_t length = 0;
+		const char* start = _binaryEncoder->encodeFileStart(env, getHeader(env), &length);
+		if (NULL != start) {
+			omrfilestream_write(_logFileStream, start, length);
+		}
+	} else {
+		omrfilestream_printf(_logFileStream, getHeader(env), version);
+	}
+
+	return true;
+}
+
+/**
+ * Prints the footer and closes the file being logged to.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeFile(MM_EnvironmentBase* env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL != _logFileStream) {
+		if (NULL != _binaryEncoder) {
+			writeBinaryText(env, getFooter(env));
+			writeBinaryText(env, "\n");
+		} else {
+			omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)),
+			                         J9STR_CODE_PLATFORM_RAW);
+			omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		}
+		omrfilestream_close(_logFileStream);
+		_logFileStream = NULL;
+	}
+}
+
+/**
+ * Drains any buffered output and closes the agent's output stream.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase* env)
+{
+	stopFlushThread(env);
+	drainBuffer(env);
+	reportDroppedRecords(env);
+	closeFile(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase* env,
+                                                     const char* filename,
+                                                     uintptr_t numFiles,
+                                                     uintptr_t numCycles)
+{
+	/* the flush thread owns the file while it runs, so finish writing everything to the old file first */
+	stopFlushThread(env);
+	drainBuffer(env);
+	return MM_VerboseWriterFileLogging::reconfigure(env, filename, numFiles, numCycles);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase* env, const char* string)
+{
+	outputBytes(env, string, strlen(string));
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length)
+{
+	outputBytes(env, bytes, length);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputBytes(MM_EnvironmentBase* env, const char* string, uintptr_t length)
+{
+	if (STATE_RUNNING == _flushThreadState) {
+		if (!addRecord(string, length, 0)) {
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			MM_AtomicOperations::add(&_droppedBytes, length);
+		}
+	} else {
+		/* no flush thread - write in order behind anything it left in the ring buffer */
+		drainBuffer(env);
+		writeToFile(env, string, length);
+	}
+}
+
+/**
+ * Queue a cycle boundary for the flush thread and wake it up.
+ * The flush thread cycles the output files when it reaches the boundary.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase* env)
+{
+	if (STATE_RUNNING == _flushThreadState) {
+		/* a boundary lost to a full ring buffer only delays file rotation by a cycle */
+		addRecord(NULL, 0, RECORD_END_OF_CYCLE);
+		/* never wait for the monitor - a flush thread holding it sees the records when it next drains */
+		if (0 == omrthread_monitor_try_enter(_flushMonitor)) {
+			omrthread_monitor_notify(_flushMonitor);
+			omrthread_monitor_exit(_flushMonitor);
+		}
+	} else {
+		drainBuffer(env);
+		MM_VerboseWriterFileLogging::endOfCycle(env);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::addRecord(const char* string, uintptr_t length, uintptr_t flags)
+{
+	uintptr_t recordSize = sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+	if (recordSize > _bufferSize) {
+		return false;
+	}
+
+	/* claim space - the check against _consumed may use a stale value, which only makes it more conservative */
+	uintptr_t reserved = 0;
+	do {
+		reserved = _reserved;
+		if ((reserved + recordSize - _consumed) > _bufferSize) {
+			return false;
+		}
+	} while (reserved != MM_AtomicOperations::lockCompareExchange(&_reserved, reserved, reserved + recordSize));
+
+	/* the text may wrap around the end of the ring buffer, the header word never does */
+	uintptr_t mask = _bufferSize - 1;
+	uintptr_t textOffset = (reserved + sizeof(uintptr_t)) & mask;
+	uintptr_t firstPart = OMR_MIN(length, _bufferSize - textOffset);
+	memcpy(_buffer + textOffset, string, firstPart);
+	memcpy(_buffer, string + firstPart, length - firstPart);
+
+	/* the text must be visible before the flush thread can observe the committed header */
+	MM_AtomicOperations::storeSync();
+	volatile uintptr_t* header = (volatile uintptr_t*)(_buffer + (reserved & mask));
+	*header = (length << RECORD_LENGTH_SHIFT) | flags | RECORD_COMMITTED;
+
+	return true;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::drainBuffer(MM_EnvironmentBase* env)
+{
+	if (NULL == _buffer) {
+		return;
+	}
+
+	uintptr_t mask = _bufferSize - 1;
+	uintptr_t consumed = _consumed;
+	while (consumed != _reserved) {
+		uintptr_t header = *(volatile uintptr_t*)(_buffer + (consumed & mask));
+		if (0 == header) {
+			/* the thread which claimed this record is still copying it - records are written in order */
+			break;
+		}
+		MM_AtomicOperations::loadSync();
+
+		uintptr_t length = header >> RECORD_LENGTH_SHIFT;
+		uintptr_t recordSize = sizeof(uintptr_t) + MM_Math::roundToCeiling(sizeof(uintptr_t), length);
+		uintptr_t textOffset = (consumed + sizeof(uintptr_t)) & mask;
+		uintptr_t firstPart = OMR_MIN(length, _bufferSize - textOffset);
+		if (0 != firstPart) {
+			writeToFile(env, _buffer + textOffset, firstPart);
+		}
+		if (length != firstPart) {
+			writeToFile(env, _buffer, length - firstPart);
+		}
+
+		/* a later header may land anywhere in this record, so it must read as uncommitted when reused */
+		uintptr_t recordOffset = consumed & mask;
+		uintptr_t firstClear = OMR_MIN(recordSize, _bufferSize - recordOffset);
+		memset(_buffer + recordOffset, 0, firstClear);
+		memset(_buffer, 0, recordSize - firstClear);
+		MM_AtomicOperations::storeSync();
+		consumed += recordSize;
+		_consumed = consumed;
+
+		if (RECORD_END_OF_CYCLE == (header & RECORD_END_OF_CYCLE)) {
+			OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+			reportDroppedRecords(env);
+			if (NULL != _logFileStream) {
+				omrfilestream_sync(_logFileStream);
+			}
+			MM_VerboseWriterFileLogging::endOfCycle(env);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeToFile(MM_EnvironmentBase* env, const char* string, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		/* we open the file at the end of the cycle so can't have a final empty file at the end of a run */
+		openFile(env);
+	}
+
+	if (NULL != _logFileStream) {
+		if (NULL != _binaryEncoder) {
+			omrfilestream_write(_logFileStream, string, length);
+		} else {
+			omrfilestream_write_text(_logFileStream, string, length, J9STR_CODE_PLATFORM_RAW);
+		}
+	} else if (NULL == _binaryEncoder) {
+		/* binary records are of no use on a terminal, so they are dropped if the file can not be opened */
+		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, length, J9STR_CODE_PLATFORM_RAW);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeBinaryText(MM_EnvironmentBase* env, const char* text)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = 0;
+	const char* record = _binaryEncoder->encodeFileText(env, text, &length);
+
+	if ((NULL != record) && (NULL != _logFileStream)) {
+		omrfilestream_write(_logFileStream, record, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::reportDroppedRecords(MM_EnvironmentBase* env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t droppedRecords = _droppedRecords;
+	uintptr_t droppedBytes = _droppedBytes;
+
+	if (droppedRecords != _reportedDroppedRecords) {
+		char warning[128];
+		uintptr_t length =
+		        omrstr_printf(warning, sizeof(warning),
+		                      "<warning details=\"verbose buffer full, %zu stanzas (%zu bytes) dropped\" />\n",
+		                      droppedRecords - _reportedDroppedRecords, droppedBytes - _reportedDroppedBytes);
+		if (NULL == _logFileStream) {
+			openFile(env);
+		}
+		if (NULL != _binaryEncoder) {
+			writeBinaryText(env, warning);
+		} else {
+			writeToFile(env, warning, length);
+		}
+		_reportedDroppedRecords = droppedRecords;
+		_reportedDroppedBytes = droppedBytes;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::startFlushThread(MM_EnvironmentBase* env)
+{
+	/* hold the monitor over start-up so the thread can not report its state before we wait for it */
+	omrthread_monitor_enter(_flushMonitor);
+	_flushThreadState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(NULL, OMR_OS_STACK_SIZE, J9THREAD_PRIORITY_NORMAL, 0,
+	                                               flush_thread_proc, this, J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _flushThreadState) {
+			omrthread_monitor_wait(_flushMonitor);
+		}
+	} else {
+		_flushThreadState = STATE_NOT_STARTED;
+	}
+	omrthread_monitor_exit(_flushMonitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopFlushThread(MM_EnvironmentBase* env)
+{
+	if ((STATE_NOT_STARTED != _flushThreadState) && (STATE_TERMINATED != _flushThreadState)) {
+		/* tell the flush thread to shut down and then wait for it to exit */
+		omrthread_monitor_enter(_flushMonitor);
+		while (STATE_TERMINATED != _flushThreadState) {
+			_flushThreadState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_flushMonitor);
+			omrthread_monitor_wait(_flushMonitor);
+		}
+		omrthread_monitor_exit(_flushMonitor);
+	}
+	_flushThreadState = STATE_NOT_STARTED;
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::flush_thread_proc(void* info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous* writer = (MM_VerboseWriterFileLoggingAsynchronous*)info;
+	/* This method will NOT return */
+	writer->flushThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flushThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_flushMonitor);
+	_flushThreadState = STATE_RUNNING;
+	omrthread_monitor_notify_all(_flushMonitor);
+
+	while (STATE_RUNNING == _flushThreadState) {
+		omrthread_monitor_exit(_flushMonitor);
+		drainBuffer(&env);
+		omrthread_monitor_enter(_flushMonitor);
+		if (STATE_RUNNING == _flushThreadState) {
+			omrthread_monitor_wait_timed(_flushMonitor, VERBOSE_ASYNC_FLUSH_INTERVAL_MILLIS, 0);
+		}
+	}
+
+	/* termination requested - write out whatever the reporting threads managed to queue */
+	omrthread_monitor_exit(_flushMonitor);
+	drainBuffer(&env);
+	omrthread_monitor_enter(_flushMonitor);
+
+	_flushThreadState = STATE_TERMINATED;
+	omrthread_monitor_notify_all(_flushMonitor);
+	omrthread_exit(_flushMonitor);
+}
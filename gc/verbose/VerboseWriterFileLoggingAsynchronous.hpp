@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "VerboseWriterFileLogging.hpp"
+#include "omrcfg.h"
+#include "omrthread.h"
+
+/**
+ * Output agent which directs verbosegc output to file from a background thread.
+ *
+ * Reporting threads copy each flushed stanza into a bounded ring buffer, claiming space with a single
+ * compare and swap and never waiting on the file system. A dedicated flush thread drains the ring buffer
+ * to the file and performs file rotation. When the ring buffer is full the stanza is dropped and counted;
+ * the counts are reported in the log by the flush thread at the next cycle boundary.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLogging
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum FlushThreadState
+	{
+		STATE_NOT_STARTED = 0, /**< no flush thread, output is written by the reporting thread */
+		STATE_STARTING, /**< flush thread was forked but has not yet reported in */
+		STATE_RUNNING, /**< flush thread is draining the ring buffer */
+		STATE_TERMINATION_REQUESTED, /**< flush thread must drain the ring buffer and exit */
+		STATE_TERMINATED /**< flush thread has exited */
+	};
+
+	OMR_VM* _omrVM; /**< the VM the flush thread reports for */
+	OMRFileStream* _logFileStream; /**< the filestream being written to, owned by the flush thread while it runs */
+
+	char* _buffer; /**< ring buffer of records, each a header word followed by the text padded to a word */
+	uintptr_t _bufferSize; /**< size of the ring buffer in bytes, a power of 2 */
+	volatile uintptr_t _reserved; /**< monotonic offset of the first byte not yet claimed by a reporting thread */
+	volatile uintptr_t _consumed; /**< monotonic offset of the first byte not yet drained by the flush thread */
+
+	volatile uintptr_t _droppedRecords; /**< number of stanzas dropped because the ring buffer was full */
+	volatile uintptr_t _droppedBytes; /**< number of bytes dropped because the ring buffer was full */
+	uintptr_t _reportedDroppedRecords; /**< value of _droppedRecords the last time drops were reported in the log */
+	uintptr_t _reportedDroppedBytes; /**< value of _droppedBytes the last time drops were reported in the log */
+
+	omrthread_monitor_t _flushMonitor; /**< monitor the flush thread waits on between drains */
+	volatile FlushThreadState _flushThreadState; /**< life cycle of the flush thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous* newInstance(MM_EnvironmentBase* env,
+	                                                            MM_VerboseManager* manager,
+	                                                            char* filename,
+	                                                            uintptr_t fileCount,
+	                                                            uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase* env, const char* string);
+	virtual void outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length);
+
+	virtual void endOfCycle(MM_EnvironmentBase* env);
+
+	virtual bool
+	reconfigure(MM_EnvironmentBase* env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void closeStream(MM_EnvironmentBase* env);
+
+	/**
+	 * @return the number of stanzas dropped so far because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+
+	/**
+	 * @return the number of bytes dropped so far because the ring buffer was full
+	 */
+	MMINLINE uintptr_t getDroppedBytes() { return _droppedBytes; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase* env, MM_VerboseManager* manager);
+
+	virtual bool initialize(MM_EnvironmentBase* env, const char* filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase* env);
+
+	bool openFile(MM_EnvironmentBase* env);
+	void closeFile(MM_EnvironmentBase* env);
+
+	/**
+	 * Fork the flush thread and wait for it to report in. If the thread can not be started, output is
+	 * written to the file by the reporting threads instead.
+	 */
+	void startFlushThread(MM_EnvironmentBase* env);
+
+	/**
+	 * Ask the flush thread to drain the ring buffer and exit, and wait for it to do so.
+	 */
+	void stopFlushThread(MM_EnvironmentBase* env);
+
+	static int J9THREAD_PROC flush_thread_proc(void* info);
+	void flushThreadEntryPoint();
+
+	/**
+	 * Copy a record into the ring buffer. May be called by any number of threads concurrently.
+	 * @param string the text of the record
+	 * @param length the length of the text
+	 * @param flags additional header flags for the record
+	 * @return true if the record was added, false if it was dropped because the ring buffer is full
+	 */
+	bool addRecord(const char* string, uintptr_t length, uintptr_t flags);
+
+	/**
+	 * Write every committed record in the ring buffer to the file, rotating files at cycle boundaries.
+	 * Must only be called by the flush thread, or when no flush thread is running.
+	 */
+	void drainBuffer(MM_EnvironmentBase* env);
+
+	/**
+	 * Queue output for the flush thread, or write it directly if there is no flush thread.
+	 */
+	void outputBytes(MM_EnvironmentBase* env, const char* string, uintptr_t length);
+
+	/**
+	 * Write text to the current log file, opening it first if required.
+	 */
+	void writeToFile(MM_EnvironmentBase* env, const char* string, uintptr_t length);
+
+	/**
+	 * Write text framed as a binary record to the current log file.
+	 */
+	void writeBinaryText(MM_EnvironmentBase* env, const char* text);
+
+	/**
+	 * Report in the log any drops which happened since the last report.
+	 */
+	void reportDroppedRecords(MM_EnvironmentBase* env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
@@ -24,6 +24,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "VerboseBinaryEncoder.hpp"
 #include "VerboseManager.hpp"
 #include "modronapicore.hpp"
 #include <string.h>
@@ -96,6 +97,8 @@ MM_VerboseWriterFileLoggingBuffered::openFile(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	const char* version = omrgc_get_version(env->getOmrVM());
 
+	selectFileFormat();
+
 	char* filenameToOpen = expandFilename(env, _currentFile);
 	if (NULL == filenameToOpen) {
 		return false;
@@ -125,7 +128,15 @@ MM_VerboseWriterFileLoggingBuffered::openFile(MM_EnvironmentBase* env)
 
 	extensions->getForge()->free(filenameToOpen);
 
-	omrfilestream_printf(_logFileStream, getHeader(env), version);
+	if (NULL != _binaryEncoder) {
+		uintptr_t length = 0;
+		const char* start = _binaryEncoder->encodeFileStart(env, getHeader(env), &length);
+		if (NULL != start) {
+			omrfilestream_write(_logFileStream, start, length);
+		}
+	} else {
+		omrfilestream_printf(_logFileStream, getHeader(env), version);
+	}
 
 	return true;
 }
@@ -139,9 +150,14 @@ MM_VerboseWriterFileLoggingBuffered::closeFile(MM_EnvironmentBase* env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	if (NULL != _logFileStream) {
-		omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)),
-		                         J9STR_CODE_PLATFORM_RAW);
-		omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		if (NULL != _binaryEncoder) {
+			writeBinaryText(env, getFooter(env));
+			writeBinaryText(env, "\n");
+		} else {
+			omrfilestream_write_text(_logFileStream, getFooter(env), strlen(getFooter(env)),
+			                         J9STR_CODE_PLATFORM_RAW);
+			omrfilestream_write_text(_logFileStream, "\n", strlen("\n"), J9STR_CODE_PLATFORM_RAW);
+		}
 		omrfilestream_close(_logFileStream);
 		_logFileStream = NULL;
 	}
@@ -162,3 +178,30 @@ MM_VerboseWriterFileLoggingBuffered::outputString(MM_EnvironmentBase* env, const
 		omrfilestream_write_text(OMRPORT_STREAM_ERR, string, strlen(string), J9STR_CODE_PLATFORM_RAW);
 	}
 }
+
+void
+MM_VerboseWriterFileLoggingBuffered::outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (NULL == _logFileStream) {
+		openFile(env);
+	}
+
+	/* binary records are of no use on a terminal, so they are dropped if the file can not be opened */
+	if ((NULL != _logFileStream) && (NULL != _binaryEncoder)) {
+		omrfilestream_write(_logFileStream, bytes, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingBuffered::writeBinaryText(MM_EnvironmentBase* env, const char* text)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = 0;
+	const char* record = _binaryEncoder->encodeFileText(env, text, &length);
+
+	if (NULL != record) {
+		omrfilestream_write(_logFileStream, record, length);
+	}
+}
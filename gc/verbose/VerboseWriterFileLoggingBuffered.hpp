@@ -50,6 +50,7 @@ public:
 	                                                        uintptr_t iterations);
 
 	virtual void outputString(MM_EnvironmentBase* env, const char* string);
+	virtual void outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length);
 
 protected:
 	MM_VerboseWriterFileLoggingBuffered(MM_EnvironmentBase* env, MM_VerboseManager* manager);
@@ -61,6 +62,11 @@ private:
 
 	bool openFile(MM_EnvironmentBase* env);
 	void closeFile(MM_EnvironmentBase* env);
+
+	/**
+	 * Write text framed as a binary record to the current file.
+	 */
+	void writeBinaryText(MM_EnvironmentBase* env, const char* text);
 };
 
 #endif /* VERBOSEWRITERFILELOGGINGBUFFERED_HPP_ */
@@ -24,6 +24,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "VerboseBinaryEncoder.hpp"
 #include "VerboseManager.hpp"
 #include "modronapicore.hpp"
 #include <string.h>
@@ -96,6 +97,8 @@ MM_VerboseWriterFileLoggingSynchronous::openFile(MM_EnvironmentBase* env)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 	const char* version = omrgc_get_version(env->getOmrVM());
 
+	selectFileFormat();
+
 	char* filenameToOpen = expandFilename(env, _currentFile);
 	if (NULL == filenameToOpen) {
 		return false;
@@ -127,7 +130,15 @@ MM_VerboseWriterFileLoggingSynchronous::openFile(MM_EnvironmentBase* env)
 
 	extensions->getForge()->free(filenameToOpen);
 
-	omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	if (NULL != _binaryEncoder) {
+		uintptr_t length = 0;
+		const char* start = _binaryEncoder->encodeFileStart(env, getHeader(env), &length);
+		if (NULL != start) {
+			omrfile_write(_logFileDescriptor, start, length);
+		}
+	} else {
+		omrfile_printf(_logFileDescriptor, getHeader(env), version);
+	}
 
 	return true;
 }
@@ -141,8 +152,13 @@ MM_VerboseWriterFileLoggingSynchronous::closeFile(MM_EnvironmentBase* env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
 	if (-1 != _logFileDescriptor) {
-		omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
-		omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		if (NULL != _binaryEncoder) {
+			writeBinaryText(env, getFooter(env));
+			writeBinaryText(env, "\n");
+		} else {
+			omrfile_write_text(_logFileDescriptor, getFooter(env), strlen(getFooter(env)));
+			omrfile_write_text(_logFileDescriptor, "\n", strlen("\n"));
+		}
 		omrfile_close(_logFileDescriptor);
 		_logFileDescriptor = -1;
 	}
@@ -164,3 +180,30 @@ MM_VerboseWriterFileLoggingSynchronous::outputString(MM_EnvironmentBase* env, co
 		omrfile_write_text(OMRPORT_TTY_ERR, string, strlen(string));
 	}
 }
+
+void
+MM_VerboseWriterFileLoggingSynchronous::outputBinary(MM_EnvironmentBase* env, const char* bytes, uintptr_t length)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if (-1 == _logFileDescriptor) {
+		openFile(env);
+	}
+
+	/* binary records are of no use on a terminal, so they are dropped if the file can not be opened */
+	if ((-1 != _logFileDescriptor) && (NULL != _binaryEncoder)) {
+		omrfile_write(_logFileDescriptor, bytes, length);
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingSynchronous::writeBinaryText(MM_EnvironmentBase* env, const char* text)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t length = 0;
+	const char* record = _binaryEncoder->encodeFileText(env, text, &length);
+
+	if (NULL != record) {
+		omrfile_write(_logFileDescriptor, record, length);
+	}
+}
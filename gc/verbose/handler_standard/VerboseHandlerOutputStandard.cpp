@@ -108,6 +108,11 @@ static void
 verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void
+verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 MM_VerboseHandlerOutput*
 MM_VerboseHandlerOutputStandard::newInstance(MM_EnvironmentBase* env, MM_VerboseManager* manager)
 {
@@ -251,6 +256,11 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	        ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END,
 	                                     verboseHandlerConcurrentCardCleaningEnd, OMR_GET_CALLSITE(), (void*)this);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)
+	        ->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP,
+	                                     verboseHandlerCompletedConcurrentSweep, OMR_GET_CALLSITE(), (void*)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)
@@ -356,6 +366,11 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	        ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_COLLECTION_CARD_CLEANING_END,
 	                           verboseHandlerConcurrentCardCleaningEnd, NULL);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)
+	        ->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP,
+	                           verboseHandlerCompletedConcurrentSweep, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	/* Excessive GC */
 	(*_mmOmrHooks)
@@ -448,6 +463,18 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 	                        markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != markStats->_arraySplitCount) {
+		writer->formatAndOutput(env, 1, "<array-split count=\"%zu\" threads=\"%zu\" />",
+		                        markStats->_arraySplitCount, markStats->_arraySplitThreadCount);
+	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->workStealingMarking) {
+		MM_WorkPacketStats* workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-stealing pushedlocal=\"%zu\" poppedlocal=\"%zu\" stolen=\"%zu\" stealattempts=\"%zu\" />",
+		                        workPacketStats->workPacketsPushedLocal, workPacketStats->workPacketsPoppedLocal,
+		                        workPacketStats->workPacketsStolen, workPacketStats->workPacketStealAttempts);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	handleMarkEndInternal(env, eventData);
 
@@ -526,6 +553,30 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 		                        compactStats->_movedObjects, compactStats->_movedBytes,
 		                        getCompactionReasonAsString(compactStats->_compactReason));
+		writer->formatAndOutput(
+		        env, 1,
+		        "<compact-threads count=\"%zu\" movesubareas=\"%zu\" fixupsubareas=\"%zu\" movetotalms=\"%llu.%03.3llu\" "
+		        "movemaxms=\"%llu.%03.3llu\" fixuptotalms=\"%llu.%03.3llu\" fixupmaxms=\"%llu.%03.3llu\" "
+		        "rootfixuptotalms=\"%llu.%03.3llu\" rootfixupmaxms=\"%llu.%03.3llu\">",
+		        compactStats->_compactThreads, compactStats->_movedSubAreas, compactStats->_fixupSubAreas,
+		        compactStats->_moveTime / 1000, compactStats->_moveTime % 1000, compactStats->_maxMoveTime / 1000,
+		        compactStats->_maxMoveTime % 1000, compactStats->_fixupTime / 1000, compactStats->_fixupTime % 1000,
+		        compactStats->_maxFixupTime / 1000, compactStats->_maxFixupTime % 1000,
+		        compactStats->_rootFixupTime / 1000, compactStats->_rootFixupTime % 1000,
+		        compactStats->_maxRootFixupTime / 1000, compactStats->_maxRootFixupTime % 1000);
+		for (uintptr_t slaveID = 0; slaveID < compactStats->_threadStatsCount; slaveID++) {
+			MM_CompactThreadStats* threadStats = &compactStats->_threadStats[slaveID];
+			if (threadStats->_compacted) {
+				writer->formatAndOutput(
+				        env, 2,
+				        "<compact-thread id=\"%zu\" movesubareas=\"%zu\" fixupsubareas=\"%zu\" movems=\"%llu.%03.3llu\" "
+				        "fixupms=\"%llu.%03.3llu\" rootfixupms=\"%llu.%03.3llu\" />",
+				        slaveID, threadStats->_movedSubAreas, threadStats->_fixupSubAreas, threadStats->_moveTime / 1000,
+				        threadStats->_moveTime % 1000, threadStats->_fixupTime / 1000, threadStats->_fixupTime % 1000,
+				        threadStats->_rootFixupTime / 1000, threadStats->_rootFixupTime % 1000);
+			}
+		}
+		writer->formatAndOutput(env, 1, "</compact-threads>");
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />",
 		                        getCompactionReasonAsString(compactStats->_compactReason));
@@ -595,6 +646,31 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		                        scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
 
+	if (0 != extensions->_numaManager.getAffinityLeaderCount()) {
+		writer->formatAndOutput(env, 1, "<scan-lists local=\"%zu\" stolen=\"%zu\" crossnode=\"%zu\" />",
+		                        scavengerStats->_localNodeScanCacheCount, scavengerStats->_scanCacheStealCount,
+		                        scavengerStats->_crossNodeScanCacheStealCount);
+	}
+	if (0 != scavengerStats->_rememberedSetScanTime) {
+		uint64_t scanMicros =
+		        omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<remembered-set-scan timems=\"%llu.%03llu\" duplicates=\"%zu\" />",
+		                        scanMicros / 1000, scanMicros % 1000, scavengerStats->_rememberedSetDuplicates);
+	}
+	for (uintptr_t entity = RootScannerEntity_None + 1; entity < RootScannerEntity_Count; entity++) {
+		uint64_t scanTime = scavengerStats->_rootScannerStats._entityScanTime[entity];
+		if (0 != scanTime) {
+			uint64_t maxThreadScanTime = scavengerStats->_rootScannerStats._entityMaxThreadScanTime[entity];
+			uint64_t totalMicros = omrtime_hires_delta(0, scanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t maxThreadMicros =
+			        omrtime_hires_delta(0, maxThreadScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			writer->formatAndOutput(
+			        env, 1, "<root-scan type=\"%s\" totalms=\"%llu.%03llu\" maxthreadms=\"%llu.%03llu\" />",
+			        getRootScannerEntityAsString((RootScannerEntity)entity), totalMicros / 1000,
+			        totalMicros % 1000, maxThreadMicros / 1000, maxThreadMicros % 1000);
+		}
+	}
+
 	handleScavengeEndInternal(env, eventData);
 
 	if (0 != scavengerStats->_tenureExpandedCount) {
@@ -734,9 +810,11 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	enterAtomicReportingBlock();
 	handleGCOPOuterStanzaStart(env, "card-cleaning", env->_cycleState->_verboseContextID, durationUs, true);
 
-	writer->formatAndOutput(
-	        env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
-	        event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+	writer->formatAndOutput(env, 1,
+	                        "<card-cleaning cardsCleaned=\"%zu\" cardsSkipped=\"%zu\" bytesTraced=\"%zu\" "
+	                        "workStackOverflowCount=\"%zu\" />",
+	                        event->finalcleanedCards, event->finalskippedCards, event->bytesTraced,
+	                        event->workStackOverflowCount);
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -1009,6 +1087,55 @@ MM_VerboseHandlerOutputStandard::handleConcurrentAbortedInternal(MM_EnvironmentB
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandard::handleCompletedConcurrentSweep(J9HookInterface** hook,
+                                                                uintptr_t eventNum,
+                                                                void* eventData)
+{
+	MM_CompletedConcurrentSweep* event = (MM_CompletedConcurrentSweep*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[100];
+
+	const char* reason;
+	switch ((SweepCompletionReason)event->reason) {
+	case ABOUT_TO_GC: reason = "about to gc"; break;
+	case COMPACTION_REQUIRED: reason = "compaction required"; break;
+	case CONTRACTION_REQUIRED: reason = "contraction required"; break;
+	case EXPANSION_REQUIRED: reason = "expansion required"; break;
+	case LOA_RESIZE: reason = "loa resize"; break;
+	case SYSTEM_GC: reason = "system gc"; break;
+	default: reason = "unknown"; break;
+	}
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-end %s reason=\"%s\">", tagTemplate, reason);
+	writer->formatAndOutput(env, 1, "<complete-sweep bytes=\"%zu\" timems=\"%llu.%03.3llu\" />", event->bytesSwept,
+	                        event->timeElapsedSweep / 1000, event->timeElapsedSweep % 1000);
+	writer->formatAndOutput(env, 1, "<complete-connect bytes=\"%zu\" timems=\"%llu.%03.3llu\" />",
+	                        event->bytesConnected, event->timeElapsedConnect / 1000, event->timeElapsedConnect % 1000);
+	writer->formatAndOutput(env, 1, "<published bytes=\"%zu\" timetofirstallocationms=\"%llu.%03.3llu\" />",
+	                        event->bytesPublished, event->timeToFirstAllocation / 1000,
+	                        event->timeToFirstAllocation % 1000);
+	writer->formatAndOutput(env, 0, "</concurrent-sweep-end>");
+	writer->flush(env);
+
+	handleCompletedConcurrentSweepInternal(env, eventData);
+
+	exitAtomicReportingBlock();
+}
+
+void
+MM_VerboseHandlerOutputStandard::handleCompletedConcurrentSweepInternal(MM_EnvironmentBase* env, void* eventData)
+{
+	/* Empty stub */
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 bool
 MM_VerboseHandlerOutputStandard::hasOutputMemoryInfoInnerStanza()
 {
@@ -1324,6 +1451,14 @@ verboseHandlerConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void
 }
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard*)userData)->handleCompletedConcurrentSweep(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 void
 verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
 {
@@ -96,6 +96,9 @@ protected:
 	virtual void handleConcurrentCollectionEndInternal(MM_EnvironmentBase* env, void* eventData);
 	virtual void handleConcurrentAbortedInternal(MM_EnvironmentBase* env, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	virtual void handleCompletedConcurrentSweepInternal(MM_EnvironmentBase* env, void* eventData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 
 	MM_VerboseHandlerOutputStandard(MM_GCExtensionsBase* extensions) : MM_VerboseHandlerOutput(extensions){};
 
@@ -221,6 +224,16 @@ public:
 	 */
 	void handleConcurrentAborted(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/**
+	 * Write verbose stanza for the completion of a concurrent sweep.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleCompletedConcurrentSweep(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARD_HPP_ */
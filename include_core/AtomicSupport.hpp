@@ -194,6 +194,20 @@ public:
 #endif /* !defined(ATOMIC_SUPPORT_STUB) */
     }
 
+    /**
+     * Hints to the processor that the cache line containing address will be read soon.
+     * This is a no-op on compilers which do not provide a prefetch intrinsic.
+     * @param address the address to prefetch, which need not be valid
+     */
+    VMINLINE static void prefetch(const void* address)
+    {
+#if !defined(ATOMIC_SUPPORT_STUB)
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#endif /* __GNUC__ */
+#endif /* !defined(ATOMIC_SUPPORT_STUB) */
+    }
+
     /**
      * Prevents compiler reordering of reads and writes across the barrier.
      * This does not prevent processor reordering.
@@ -158,6 +158,16 @@ uint32_t hashTableRemove(J9HashTable* table, void* entry);
  */
 void* hashTableStartDo(J9HashTable* table, J9HashTableState* handle);
 
+/**
+ * @brief
+ * @param *table
+ * @param *handle
+ * @param startBucket
+ * @param endBucket
+ * @return void *
+ */
+void* hashTableStartDoBuckets(J9HashTable* table, J9HashTableState* handle, uint32_t startBucket, uint32_t endBucket);
+
 #ifdef __cplusplus
 }
 #endif
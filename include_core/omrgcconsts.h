@@ -257,6 +257,8 @@ struct ModronLnrlOptions {
 #define MINIMUM_CONTRACTION_RATIO_MULTIPLIER 10
 
 #define DESIRED_SUBAREA_SIZE ((uintptr_t)(4 * 1024 * 1024))
+#define MINIMUM_SUBAREA_SIZE ((uintptr_t)(256 * 1024))
+#define DESIRED_SUBAREAS_PER_COMPACT_THREAD 8
 
 typedef enum {
     COMPACT_NONE = 0,
@@ -388,6 +390,11 @@ typedef enum {
     HEAP_RELEASE_FREE_PAGES
 } HeapResizeType;
 
+typedef enum {
+    HEAP_PRETOUCH_STARTUP,
+    HEAP_PRETOUCH_EXPAND
+} HeapPretouchType;
+
 typedef enum {
     NO_CONTRACT = 1,
     GC_RATIO_TOO_LOW,
@@ -395,7 +402,8 @@ typedef enum {
     SCAV_RATIO_TOO_LOW,
     HEAP_RESIZE,
     SATISFY_EXPAND,
-    FORCED_NURSERY_CONTRACT
+    FORCED_NURSERY_CONTRACT,
+    SCAV_PAUSE_ABOVE_TARGET
 } ContractReason;
 
 typedef enum {
@@ -406,7 +414,8 @@ typedef enum {
     SATISFY_COLLECTOR,
     EXPAND_DESPERATE,
     FORCED_NURSERY_EXPAND,
-    HINT_PREVIOUS_RUNS
+    HINT_PREVIOUS_RUNS,
+    PROMOTION_HEADROOM
 } ExpandReason;
 
 typedef enum {
@@ -471,6 +480,7 @@ typedef enum { HEAP_REGION_STATE_NONE = 0x0, HEAP_REGION_STATE_COPY_FORWARD = 0x
 #define OMR_SCV_TENURE_RATIO_HIGH 30
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
 #define OMR_SCV_REMSET_SIZE 16384
+#define OMR_SCV_REMSET_FILTER_SIZE 256
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
 
@@ -131,6 +131,7 @@ typedef struct J9HashTable {
 typedef struct J9HashTableState {
     struct J9HashTable* table;
     uint32_t bucketIndex;
+    uint32_t bucketLimit;
     uint32_t didDeleteCurrentNode;
     void** pointerToCurrentNode;
     uintptr_t iterateState;
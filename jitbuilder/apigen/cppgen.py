@@ -556,7 +556,10 @@ class CppGenerator:
                 self.write_arg_setup(writer, parm)
 
             args = self.generate_arg_list(desc.parameters())
-            impl_call = "{impl_cast}->{sname}({args})".format(impl_cast=self.to_impl_cast(class_desc,"_impl"),sname=name,args=args)
+            if desc.is_static():
+                impl_call = "{iname}::{sname}({args})".format(iname=self.get_impl_class_name(class_desc),sname=name,args=args)
+            else:
+                impl_call = "{impl_cast}->{sname}({args})".format(impl_cast=self.to_impl_cast(class_desc,"_impl"),sname=name,args=args)
             if "none" == desc.return_type().name():
                 writer.write(impl_call + ";\n")
                 for parm in desc.parameters():
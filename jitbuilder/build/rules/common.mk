@@ -223,6 +223,8 @@ JITBUILDER_FILES=$(RELEASE_DIR)/Makefile \
              $(RELEASE_SRC)/DotProduct.cpp \
              $(RELEASE_SRC)/IterativeFib.hpp \
              $(RELEASE_SRC)/IterativeFib.cpp \
+             $(RELEASE_SRC)/LargeMethod.hpp \
+             $(RELEASE_SRC)/LargeMethod.cpp \
              $(RELEASE_SRC)/LinkedList.hpp \
              $(RELEASE_SRC)/LinkedList.cpp \
              $(RELEASE_SRC)/Mandelbrot.hpp \
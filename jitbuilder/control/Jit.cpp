@@ -24,6 +24,7 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
@@ -32,6 +33,7 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "optimizer/OptimizationProfiler.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
@@ -159,6 +161,8 @@ bool initializeJitBuilder(TR_RuntimeHelper* helperIDs, void** helperAddresses, i
 // An individual program should link statically against JitBuilder, then call:
 //     initializeJit() or initializeJitWithOptions() to initialize the Jit
 //     compileMethodBuilder() as many times as needed to create compiled code
+//     startCompilationThreads() first to compile in the background with MethodBuilder::CompileAsync()
+//     and MethodBuilder::CompileBatch()
 //     shuwdownJit() when the test is complete
 //
 
@@ -209,8 +213,44 @@ int32_t internal_compileMethodBuilder(TR::MethodBuilder* m, void** entry)
     return rc;
 }
 
+// the compilation threads used by MethodBuilder::CompileAsync() and MethodBuilder::CompileBatch()
+static TR::CompilationQueue* compilationQueue = NULL;
+
+bool internal_startCompilationThreads(uint32_t threadCount)
+{
+    if (NULL != compilationQueue)
+        return false;
+
+    TR::CompilationQueue* queue = new (TR::Compiler->rawAllocator) TR::CompilationQueue(threadCount);
+    if (!queue->start()) {
+        queue->~CompilationQueue();
+        TR::Compiler->rawAllocator.deallocate(queue);
+        return false;
+    }
+
+    compilationQueue = queue;
+    TR::MethodBuilder::setCompilationQueue(queue);
+    return true;
+}
+
+void internal_stopCompilationThreads()
+{
+    if (NULL == compilationQueue)
+        return;
+
+    TR::MethodBuilder::setCompilationQueue(NULL);
+    compilationQueue->shutdown();
+    compilationQueue->~CompilationQueue();
+    TR::Compiler->rawAllocator.deallocate(compilationQueue);
+    compilationQueue = NULL;
+}
+
 void internal_shutdownJit()
 {
+    internal_stopCompilationThreads();
+
+    TR::OptimizationProfiler::shutdown();
+
     auto fe = JitBuilder::FrontEnd::instance();
 
     TR::CodeCacheManager& codeCacheManager = fe->codeCacheManager();
@@ -140,72 +140,59 @@ static const OptimizationStrategy JBwarmStrategyOpts[] = {
     { OMR::endOpts },
 };
 
+static const OptimizationManagerDescriptor jitBuilderOptimizationManagers[] = {
+    // individual optimizations
+    { OMR::trivialDeadBlockRemover, TR_TrivialDeadBlockRemover::create },
+    { OMR::deadTreesElimination, TR::DeadTreesElimination::create },
+    { OMR::treeSimplification, TR::Simplifier::create },
+    { OMR::localCSE, TR::LocalCSE::create },
+    { OMR::basicBlockOrdering, TR_OrderBlocks::create },
+    { OMR::globalCopyPropagation, TR_CopyPropagation::create },
+    { OMR::globalDeadStoreElimination, TR_DeadStoreElimination::create },
+    { OMR::basicBlockHoisting, TR_HoistBlocks::create },
+    { OMR::globalValuePropagation, TR::GlobalValuePropagation::create },
+    { OMR::localValuePropagation, TR::LocalValuePropagation::create },
+    { OMR::trivialDeadTreeRemoval, TR_TrivialDeadTreeRemoval::create },
+    { OMR::generalLoopUnroller, TR_GeneralLoopUnroller::create },
+    { OMR::basicBlockExtension, TR_ExtendBasicBlocks::create },
+    { OMR::redundantGotoElimination, TR_EliminateRedundantGotos::create },
+    { OMR::rematerialization, TR_Rematerialization::create },
+    { OMR::loopCanonicalization, TR_LoopCanonicalizer::create },
+    { OMR::inductionVariableAnalysis, TR_InductionVariableAnalysis::create },
+    { OMR::liveRangeSplitter, TR_LiveRangeSplitter::create },
+    { OMR::tacticalGlobalRegisterAllocator, TR_GlobalRegisterAllocator::create },
+    { OMR::regDepCopyRemoval, TR::RegDepCopyRemoval::create },
+    { OMR::inlining, TR_TrivialInliner::create },
+    { OMR::switchAnalyzer, TR::SwitchAnalyzer::create },
+
+    // optimization groups
+    { OMR::cheapTacticalGlobalRegisterAllocatorGroup, NULL, cheapTacticalGlobalRegisterAllocatorOpts },
+    { OMR::globalDeadStoreGroup, NULL, globalDeadStoreOpts },
+
+    { OMR::endOpts },
+};
+
 namespace JitBuilder {
 
 Optimizer::Optimizer(TR::Compilation* comp, TR::ResolvedMethodSymbol* methodSymbol, bool isIlGen,
     const OptimizationStrategy* strategy, uint16_t VNType)
     : OMR::Optimizer(comp, methodSymbol, isIlGen, strategy, VNType)
 {
-    // Initialize individual optimizations
-    _opts[OMR::trivialDeadBlockRemover] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_TrivialDeadBlockRemover::create, OMR::trivialDeadBlockRemover);
-    _opts[OMR::deadTreesElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::DeadTreesElimination::create, OMR::deadTreesElimination);
-    _opts[OMR::treeSimplification]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR::Simplifier::create, OMR::treeSimplification);
-    _opts[OMR::localCSE] = new (comp->allocator()) TR::OptimizationManager(self(), TR::LocalCSE::create, OMR::localCSE);
-    _opts[OMR::basicBlockOrdering]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_OrderBlocks::create, OMR::basicBlockOrdering);
-    _opts[OMR::globalCopyPropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_CopyPropagation::create, OMR::globalCopyPropagation);
-    _opts[OMR::globalDeadStoreElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_DeadStoreElimination::create, OMR::globalDeadStoreElimination);
-    _opts[OMR::basicBlockHoisting]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_HoistBlocks::create, OMR::basicBlockHoisting);
-    _opts[OMR::globalValuePropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::GlobalValuePropagation::create, OMR::globalValuePropagation);
-    _opts[OMR::localValuePropagation] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::LocalValuePropagation::create, OMR::localValuePropagation);
-    _opts[OMR::trivialDeadTreeRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_TrivialDeadTreeRemoval::create, OMR::trivialDeadTreeRemoval);
-    _opts[OMR::generalLoopUnroller] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_GeneralLoopUnroller::create, OMR::generalLoopUnroller);
-    _opts[OMR::basicBlockExtension] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_ExtendBasicBlocks::create, OMR::basicBlockExtension);
-    _opts[OMR::redundantGotoElimination] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_EliminateRedundantGotos::create, OMR::redundantGotoElimination);
-    _opts[OMR::rematerialization]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_Rematerialization::create, OMR::rematerialization);
-    _opts[OMR::loopCanonicalization] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
-    _opts[OMR::inductionVariableAnalysis] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis);
-    _opts[OMR::liveRangeSplitter]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_LiveRangeSplitter::create, OMR::liveRangeSplitter);
-    _opts[OMR::tacticalGlobalRegisterAllocator] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR_GlobalRegisterAllocator::create, OMR::tacticalGlobalRegisterAllocator);
-    _opts[OMR::regDepCopyRemoval] = new (comp->allocator())
-        TR::OptimizationManager(self(), TR::RegDepCopyRemoval::create, OMR::regDepCopyRemoval);
-    _opts[OMR::inlining]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR_TrivialInliner::create, OMR::inlining);
-    _opts[OMR::switchAnalyzer]
-        = new (comp->allocator()) TR::OptimizationManager(self(), TR::SwitchAnalyzer::create, OMR::switchAnalyzer);
-
-    // Initialize optimization groups
-    _opts[OMR::cheapTacticalGlobalRegisterAllocatorGroup] = new (comp->allocator()) TR::OptimizationManager(
-        self(), NULL, OMR::cheapTacticalGlobalRegisterAllocatorGroup, cheapTacticalGlobalRegisterAllocatorOpts);
-    _opts[OMR::globalDeadStoreGroup]
-        = new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::globalDeadStoreGroup, globalDeadStoreOpts);
+    createOptimizationManagers(jitBuilderOptimizationManagers);
 
     // turn requested on for optimizations/groups
     self()->setRequestOptimization(OMR::cheapTacticalGlobalRegisterAllocatorGroup, true);
     self()->setRequestOptimization(OMR::tacticalGlobalRegisterAllocatorGroup, true);
     self()->setRequestOptimization(OMR::tacticalGlobalRegisterAllocator, true);
+}
+
+const OptimizationStrategy* Optimizer::optimizationStrategy(TR::Compilation* c)
+{
+    if (NULL != mockStrategy())
+        return OMR::Optimizer::optimizationStrategy(c);
 
-    omrCompilationStrategies[noOpt] = JBwarmStrategyOpts;
-    omrCompilationStrategies[cold] = JBwarmStrategyOpts;
-    omrCompilationStrategies[warm] = JBwarmStrategyOpts;
-    omrCompilationStrategies[hot] = JBwarmStrategyOpts;
+    // the same strategy is used at every hotness level
+    return JBwarmStrategyOpts;
 }
 
 inline TR::Optimizer* Optimizer::self()
@@ -61,6 +61,12 @@ public:
     Optimizer(TR::Compilation* comp, TR::ResolvedMethodSymbol* methodSymbol, bool isIlGen,
         const OptimizationStrategy* strategy = NULL, uint16_t VNType = 0);
 
+    /**
+     * The strategy of JitBuilder compilations. Unlike the OMR strategies, it is not looked up in
+     * omrCompilationStrategies, so concurrent compilations do not write to shared tables.
+     */
+    static const OptimizationStrategy* optimizationStrategy(TR::Compilation* c);
+
 private:
     TR::Optimizer* self();
 };
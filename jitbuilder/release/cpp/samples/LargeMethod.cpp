@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include "LargeMethod.hpp"
+
+LargeMethod::LargeMethod(OMR::JitBuilder::TypeDictionary* types, int32_t numLocals, int32_t numBlocks, uint32_t seed)
+    : OMR::JitBuilder::MethodBuilder(types)
+    , _numLocals(numLocals)
+{
+    DefineLine(LINETOSTR(__LINE__));
+    DefineFile(__FILE__);
+
+    DefineName("large_method");
+    DefineParameter("n", Int32);
+    DefineReturnType(Int32);
+
+    for (int32_t l = 0; l < numLocals; l++) {
+        char* name = new char[16];
+        snprintf(name, 16, "v%d", l);
+        _localNames.push_back(name);
+        DefineLocal(name, Int32);
+    }
+
+    // A linear congruential generator keeps the generated method the same for a given seed
+    for (int32_t b = 0; b < numBlocks; b++) {
+        Block block;
+        seed = seed * 1103515245 + 12345;
+        block._conditionLocal = (seed >> 8) % numLocals;
+        seed = seed * 1103515245 + 12345;
+        block._conditionValue = (seed >> 8) % 1024;
+        seed = seed * 1103515245 + 12345;
+        block._thenTarget = (seed >> 8) % numLocals;
+        seed = seed * 1103515245 + 12345;
+        block._thenSource = (seed >> 8) % numLocals;
+        seed = seed * 1103515245 + 12345;
+        block._elseTarget = (seed >> 8) % numLocals;
+        seed = seed * 1103515245 + 12345;
+        block._elseValue = (seed >> 8) % 16;
+        _blocks.push_back(block);
+    }
+}
+
+LargeMethod::~LargeMethod()
+{
+    for (size_t l = 0; l < _localNames.size(); l++)
+        delete[] _localNames[l];
+}
+
+bool LargeMethod::buildIL()
+{
+    for (int32_t l = 0; l < _numLocals; l++)
+        Store(_localNames[l], Add(Load("n"), ConstInt32(l)));
+
+    OMR::JitBuilder::IlBuilder* loop = NULL;
+    ForLoopUp("i", &loop, ConstInt32(0), Load("n"), ConstInt32(1));
+
+    for (size_t b = 0; b < _blocks.size(); b++) {
+        Block& block = _blocks[b];
+        OMR::JitBuilder::IlBuilder* thenPath = NULL;
+        OMR::JitBuilder::IlBuilder* elsePath = NULL;
+        loop->IfThenElse(&thenPath, &elsePath,
+            loop->LessThan(loop->Load(_localNames[block._conditionLocal]), loop->ConstInt32(block._conditionValue)));
+
+        thenPath->Store(_localNames[block._thenTarget],
+            thenPath->Add(
+                thenPath->Load(_localNames[block._thenTarget]), thenPath->Load(_localNames[block._thenSource])));
+
+        elsePath->Store(_localNames[block._elseTarget],
+            elsePath->Sub(elsePath->Load(_localNames[block._elseTarget]), elsePath->ConstInt32(block._elseValue)));
+    }
+
+    OMR::JitBuilder::IlValue* sum = ConstInt32(0);
+    for (int32_t l = 0; l < _numLocals; l++)
+        sum = Add(sum, Load(_localNames[l]));
+    Return(sum);
+
+    return true;
+}
+
+// Compute the result of the generated method. Arithmetic wraps like the compiled code does.
+int32_t LargeMethod::interpret(int32_t n)
+{
+    std::vector<uint32_t> locals(_numLocals);
+    for (int32_t l = 0; l < _numLocals; l++)
+        locals[l] = (uint32_t)n + l;
+
+    for (int32_t i = 0; i < n; i++) {
+        for (size_t b = 0; b < _blocks.size(); b++) {
+            Block& block = _blocks[b];
+            if ((int32_t)locals[block._conditionLocal] < block._conditionValue)
+                locals[block._thenTarget] += locals[block._thenSource];
+            else
+                locals[block._elseTarget] -= block._elseValue;
+        }
+    }
+
+    uint32_t sum = 0;
+    for (int32_t l = 0; l < _numLocals; l++)
+        sum += locals[l];
+    return (int32_t)sum;
+}
+
+// Usage: largemethod [-sparse] [numLocals [numBlocks [numCompilations]]]
+//
+// -sparse lets large bit vectors use the sparse representation, to compare compile times and memory with
+// the default dense bit vectors
+int main(int argc, char* argv[])
+{
+    int32_t arg = 1;
+    bool sparse = argc > arg && strcmp(argv[arg], "-sparse") == 0;
+    if (sparse)
+        arg++;
+    int32_t numLocals = argc > arg ? atoi(argv[arg]) : 64;
+    int32_t numBlocks = argc > arg + 1 ? atoi(argv[arg + 1]) : 200;
+    int32_t numCompilations = argc > arg + 2 ? atoi(argv[arg + 2]) : 1;
+    if (numLocals <= 0 || numBlocks <= 0 || numCompilations <= 0) {
+        fprintf(stderr, "usage: %s [-sparse] [numLocals [numBlocks [numCompilations]]]\n", argv[0]);
+        exit(-1);
+    }
+
+    // Read by the JIT the first time it creates a bit vector
+    static char enableSparseBitVectors[] = "TR_EnableSparseBitVectors=1";
+    if (sparse)
+        putenv(enableSparseBitVectors);
+
+    printf("Step 1: initialize JIT\n");
+    bool initialized = initializeJit();
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        exit(-1);
+    }
+
+    printf("Step 2: define relevant types\n");
+    OMR::JitBuilder::TypeDictionary types;
+
+    printf("Step 3: compile %d method builders with %d locals and %d blocks%s\n", numCompilations, numLocals,
+        numBlocks, sparse ? " with sparse bit vectors" : "");
+    double totalSeconds = 0.0;
+    for (int32_t c = 0; c < numCompilations; c++) {
+        LargeMethod method(&types, numLocals, numBlocks, c + 1);
+        void* entry = 0;
+        clock_t start = clock();
+        int32_t rc = compileMethodBuilder(&method, &entry);
+        double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (rc != 0) {
+            fprintf(stderr, "FAIL: compilation error %d\n", rc);
+            exit(-2);
+        }
+        totalSeconds += seconds;
+        printf("compilation %d took %.3f seconds\n", c, seconds);
+
+        LargeMethodFunctionType* largeMethod = (LargeMethodFunctionType*)entry;
+        for (int32_t n = 0; n < 4; n++) {
+            int32_t expected = method.interpret(n);
+            int32_t result = largeMethod(n);
+            if (result != expected) {
+                fprintf(stderr, "FAIL: large_method(%d) returned %d, expected %d\n", n, result, expected);
+                exit(-3);
+            }
+        }
+    }
+    printf("average compile time: %.3f seconds\n", totalSeconds / numCompilations);
+#if !defined(_WIN32)
+    // The scratch memory of each compilation is released afterwards, so the high water mark of the process
+    // shows the memory of the largest compilation
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if defined(__APPLE__)
+        long peakKB = (long)usage.ru_maxrss / 1024; // bytes on macOS
+#else
+        long peakKB = (long)usage.ru_maxrss;
+#endif
+        printf("peak resident memory: %ld KB\n", peakKB);
+    }
+#endif
+
+    printf("Step 4: shutdown JIT\n");
+    shutdownJit();
+
+    printf("PASS\n");
+}
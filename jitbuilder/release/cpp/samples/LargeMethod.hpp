@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef LARGEMETHOD_INCL
+#define LARGEMETHOD_INCL
+
+#include <vector>
+
+#include "JitBuilder.hpp"
+
+typedef int32_t(LargeMethodFunctionType)(int32_t);
+
+/**
+ * A generated method with many locals and many blocks, used to measure how compile
+ * time grows with method size. The method runs a loop whose body is a chain of
+ * if-then-else blocks, each updating one local from another, and returns the sum of
+ * all the locals. The same program can be interpreted to check the compiled code.
+ */
+class LargeMethod : public OMR::JitBuilder::MethodBuilder {
+private:
+    struct Block {
+        int32_t _conditionLocal;
+        int32_t _conditionValue;
+        int32_t _thenTarget;
+        int32_t _thenSource;
+        int32_t _elseTarget;
+        int32_t _elseValue;
+    };
+
+    int32_t _numLocals;
+    std::vector<Block> _blocks;
+    std::vector<char*> _localNames;
+
+public:
+    LargeMethod(OMR::JitBuilder::TypeDictionary* types, int32_t numLocals, int32_t numBlocks, uint32_t seed);
+    virtual ~LargeMethod();
+    virtual bool buildIL();
+
+    int32_t interpret(int32_t n);
+};
+
+#endif // !defined(LARGEMETHOD_INCL)
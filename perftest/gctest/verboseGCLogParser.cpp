@@ -26,8 +26,10 @@
 #include <iterator>
 #include <numeric>
 #include <stdio.h>
+#include <string>
 
 #include "pugixml.hpp"
+#include "VerboseGCDecoder.hpp"
 
 #include "omr.h"
 #include "omrport.h"
@@ -35,6 +37,7 @@
 
 const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
+const char* XPATH_GET_ALL_SCAVENGE_TIME = "/verbosegc/gc-op[@type='scavenge']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
@@ -42,6 +45,7 @@ const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
 double getAvg(std::vector<double> v);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
+bool loadVerboseGCFile(pugi::xml_document* doc, const char* fileName);
 
 int main(void)
 {
@@ -105,11 +109,13 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
 {
     std::vector<double> mark_values;
     std::vector<double> sweep_values;
+    std::vector<double> scavenge_values;
     std::vector<double> expand_values;
     std::vector<double> gcduration_values;
 
     pugi::xpath_node_set markTimes;
     pugi::xpath_node_set sweepTimes;
+    pugi::xpath_node_set scavengeTimes;
     pugi::xpath_node_set expandTimes;
     pugi::xpath_node_set gcTimes;
 
@@ -121,6 +127,10 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
     double minSweep = 0;
     double avgSweep = 0;
 
+    double maxScavenge = 0;
+    double minScavenge = 0;
+    double avgScavenge = 0;
+
     double maxExpand = 0;
     double minExpand = 0;
     double avgExpand = 0;
@@ -130,7 +140,7 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
     double avgGCDuration = 0;
 
     pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(fileName);
+    bool result = loadVerboseGCFile(&doc, fileName);
 
     OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
     if (!result) {
@@ -154,6 +164,13 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
         sweep_values.push_back(value);
     }
 
+    scavengeTimes = doc.select_nodes(XPATH_GET_ALL_SCAVENGE_TIME);
+    for (pugi::xpath_node_set::const_iterator it = scavengeTimes.begin(); it != scavengeTimes.end(); ++it) {
+        pugi::xpath_node node = *it;
+        double value = node.node().attribute("timems").as_double();
+        scavenge_values.push_back(value);
+    }
+
     expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
     for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
         pugi::xpath_node node = *it;
@@ -180,6 +197,12 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
         avgSweep = getAvg(sweep_values);
     }
 
+    if (!scavenge_values.empty()) {
+        maxScavenge = *std::max_element(scavenge_values.begin(), scavenge_values.end());
+        minScavenge = *std::min_element(scavenge_values.begin(), scavenge_values.end());
+        avgScavenge = getAvg(scavenge_values);
+    }
+
     if (!expand_values.empty()) {
         maxExpand = *std::max_element(expand_values.begin(), expand_values.end());
         minExpand = *std::min_element(expand_values.begin(), expand_values.end());
@@ -192,11 +215,48 @@ void analyze(char* fileName, OMRPortLibrary portLibrary)
         avgGCDuration = getAvg(gcduration_values);
     }
 
-    omrtty_printf("            Mark           Sweep          Expand        GCDuration\n");
-    omrtty_printf("-------------------------------------------------------------------\n");
-    omrtty_printf("Max     : %f        %f        %f        %f\n", maxMark, maxSweep, maxExpand, maxGCDuration);
+    omrtty_printf("            Mark           Sweep          Scavenge       Expand        GCDuration\n");
+    omrtty_printf("----------------------------------------------------------------------------------\n");
+    omrtty_printf("Max     : %f        %f        %f        %f        %f\n", maxMark, maxSweep, maxScavenge, maxExpand,
+        maxGCDuration);
+
+    omrtty_printf("Min     : %f        %f        %f        %f        %f\n", minMark, minSweep, minScavenge, minExpand,
+        minGCDuration);
+
+    omrtty_printf("Average : %f        %f        %f        %f        %f\n\n", avgMark, avgSweep, avgScavenge, avgExpand,
+        avgGCDuration);
+}
 
-    omrtty_printf("Min     : %f        %f        %f        %f\n", minMark, minSweep, minExpand, minGCDuration);
+static void appendDecodedText(void* userData, const char* text, uintptr_t length)
+{
+    ((std::string*)userData)->append(text, length);
+}
+
+/* Load a verbose GC file, decoding it first if it was written with -Xgc:verboseBinaryFormat */
+bool loadVerboseGCFile(pugi::xml_document* doc, const char* fileName)
+{
+    FILE* file = fopen(fileName, "rb");
+    if (NULL == file) {
+        return false;
+    }
+
+    std::string contents;
+    char chunk[64 * 1024];
+    size_t length = 0;
+    while (0 < (length = fread(chunk, 1, sizeof(chunk), file))) {
+        contents.append(chunk, length);
+    }
+    fclose(file);
+
+    if (VerboseGCDecoder::isBinaryFormat((const uint8_t*)contents.data(), contents.size())) {
+        std::string text;
+        VerboseGCDecoder decoder(appendDecodedText, &text);
+        if (!decoder.decode((const uint8_t*)contents.data(), contents.size()) || !decoder.finish()) {
+            fprintf(stderr, "Failed to decode %s: %s\n", fileName, decoder.getError());
+            return false;
+        }
+        contents.swap(text);
+    }
 
-    omrtty_printf("Average : %f        %f        %f        %f\n\n", avgMark, avgSweep, avgExpand, avgGCDuration);
+    return (bool)doc->load_buffer(contents.data(), contents.size());
 }
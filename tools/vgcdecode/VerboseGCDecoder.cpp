@@ -0,0 +1,443 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "VerboseGCDecoder.hpp"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "VerboseBinaryFormat.hpp"
+
+/* Largest format string id accepted, to bound the memory a corrupt file can make us allocate */
+#define MAXIMUM_FORMAT_ID (1024 * 1024)
+
+/* Longest conversion specification rebuilt for snprintf: '%', flags, two numbers, "ll" and the conversion */
+#define MAXIMUM_SPECIFICATION_LENGTH 64
+
+static bool
+ensureCapacity(void** buffer, uintptr_t* capacity, uintptr_t needed, uintptr_t elementSize)
+{
+    if (needed > *capacity) {
+        uintptr_t newCapacity = (0 == *capacity) ? 256 : *capacity;
+        while (newCapacity < needed) {
+            newCapacity *= 2;
+        }
+        void* newBuffer = realloc(*buffer, newCapacity * elementSize);
+        if (NULL == newBuffer) {
+            return false;
+        }
+        memset((uint8_t*)newBuffer + (*capacity * elementSize), 0, (newCapacity - *capacity) * elementSize);
+        *buffer = newBuffer;
+        *capacity = newCapacity;
+    }
+    return true;
+}
+
+VerboseGCDecoder::VerboseGCDecoder(OutputFunction output, void* userData)
+    : _output(output)
+    , _userData(userData)
+    , _pending(NULL)
+    , _pendingLength(0)
+    , _pendingCapacity(0)
+    , _headerDecoded(false)
+    , _pointerSize(sizeof(void*))
+    , _formats(NULL)
+    , _formatCapacity(0)
+    , _line(NULL)
+    , _lineLength(0)
+    , _lineCapacity(0)
+    , _error(NULL)
+{}
+
+VerboseGCDecoder::~VerboseGCDecoder()
+{
+    for (uintptr_t id = 0; id < _formatCapacity; id++) {
+        free(_formats[id]);
+    }
+    free(_formats);
+    free(_pending);
+    free(_line);
+}
+
+bool
+VerboseGCDecoder::isBinaryFormat(const uint8_t* bytes, uintptr_t length)
+{
+    return (length >= VERBOSE_BINARY_MAGIC_LENGTH)
+        && (0 == memcmp(bytes, VERBOSE_BINARY_MAGIC, VERBOSE_BINARY_MAGIC_LENGTH));
+}
+
+bool
+VerboseGCDecoder::fail(const char* error)
+{
+    if (NULL == _error) {
+        _error = error;
+    }
+    return false;
+}
+
+bool
+VerboseGCDecoder::decode(const uint8_t* bytes, uintptr_t length)
+{
+    if (NULL != _error) {
+        return false;
+    }
+
+    if (!ensureCapacity((void**)&_pending, &_pendingCapacity, _pendingLength + length, 1)) {
+        return fail("out of memory");
+    }
+    memcpy(_pending + _pendingLength, bytes, length);
+    _pendingLength += length;
+
+    uintptr_t offset = 0;
+    if (!_headerDecoded) {
+        if (_pendingLength < VERBOSE_BINARY_FILE_HEADER_LENGTH) {
+            return true;
+        }
+        if (!isBinaryFormat(_pending, _pendingLength)) {
+            return fail("not a binary verbose GC file");
+        }
+        if (VERBOSE_BINARY_VERSION != _pending[VERBOSE_BINARY_MAGIC_LENGTH]) {
+            return fail("unsupported binary verbose GC version");
+        }
+        _pointerSize = _pending[VERBOSE_BINARY_MAGIC_LENGTH + 1];
+        _headerDecoded = true;
+        offset = VERBOSE_BINARY_FILE_HEADER_LENGTH;
+    }
+
+    bool result = true;
+    while (result && (offset < _pendingLength)) {
+        uint64_t recordLength = 0;
+        uintptr_t available = _pendingLength - offset;
+        uintptr_t lengthSize = verboseBinaryDecodeVarint(_pending + offset, available, &recordLength);
+        if (0 == lengthSize) {
+            if (available >= VERBOSE_BINARY_MAXIMUM_VARINT_LENGTH) {
+                result = fail("malformed record length");
+            }
+            break;
+        }
+        if (0 == recordLength) {
+            result = fail("empty record");
+            break;
+        }
+        if (recordLength > (available - lengthSize)) {
+            /* wait for the rest of the record */
+            break;
+        }
+        result = decodeRecord(_pending + offset + lengthSize, (uintptr_t)recordLength);
+        offset += lengthSize + (uintptr_t)recordLength;
+    }
+
+    _pendingLength -= offset;
+    memmove(_pending, _pending + offset, _pendingLength);
+
+    return result;
+}
+
+bool
+VerboseGCDecoder::finish()
+{
+    if (NULL != _error) {
+        return false;
+    }
+    if (!_headerDecoded) {
+        return fail("not a binary verbose GC file");
+    }
+    if (0 != _pendingLength) {
+        return fail("file ends part way through a record");
+    }
+    return true;
+}
+
+bool
+VerboseGCDecoder::decodeRecord(const uint8_t* body, uintptr_t length)
+{
+    const uint8_t* cursor = body + 1;
+    const uint8_t* end = body + length;
+    uint64_t indent = 0;
+    uint64_t id = 0;
+    uintptr_t consumed = 0;
+
+    switch (body[0]) {
+    case VERBOSE_BINARY_RECORD_TEXT:
+        _output(_userData, (const char*)cursor, end - cursor);
+        break;
+    case VERBOSE_BINARY_RECORD_LITERAL:
+        consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &indent);
+        if (0 == consumed) {
+            return fail("malformed literal record");
+        }
+        cursor += consumed;
+        _lineLength = 0;
+        if (!appendIndent(indent) || !append((const char*)cursor, end - cursor) || !append("\n", 1)) {
+            return fail("out of memory");
+        }
+        _output(_userData, _line, _lineLength);
+        break;
+    case VERBOSE_BINARY_RECORD_FORMAT:
+        consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &id);
+        if (0 == consumed) {
+            return fail("malformed format record");
+        }
+        cursor += consumed;
+        return defineFormat(id, cursor, end - cursor);
+    case VERBOSE_BINARY_RECORD_LINE:
+        consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &indent);
+        if (0 == consumed) {
+            return fail("malformed line record");
+        }
+        cursor += consumed;
+        consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &id);
+        if (0 == consumed) {
+            return fail("malformed line record");
+        }
+        cursor += consumed;
+        if ((id >= _formatCapacity) || (NULL == _formats[id])) {
+            return fail("line refers to an undefined format string");
+        }
+        return renderLine(indent, _formats[id], cursor, end);
+    default:
+        /* records of types added by later versions of the format carry nothing this decoder can show */
+        break;
+    }
+
+    return true;
+}
+
+bool
+VerboseGCDecoder::defineFormat(uint64_t id, const uint8_t* text, uintptr_t length)
+{
+    if (id >= MAXIMUM_FORMAT_ID) {
+        return fail("format string id out of range");
+    }
+    if (!ensureCapacity((void**)&_formats, &_formatCapacity, (uintptr_t)id + 1, sizeof(char*))) {
+        return fail("out of memory");
+    }
+
+    char* format = (char*)malloc(length + 1);
+    if (NULL == format) {
+        return fail("out of memory");
+    }
+    memcpy(format, text, length);
+    format[length] = '\0';
+
+    /* every file of a rotating log repeats the definitions it uses, so redefinitions are expected */
+    free(_formats[id]);
+    _formats[id] = format;
+    return true;
+}
+
+bool
+VerboseGCDecoder::renderLine(uint64_t indent, const char* format, const uint8_t* cursor, const uint8_t* end)
+{
+    _lineLength = 0;
+    if (!appendIndent(indent)) {
+        return fail("out of memory");
+    }
+
+    const char* text = format;
+    while ('\0' != *text) {
+        const char* percent = strchr(text, '%');
+        if (NULL == percent) {
+            percent = text + strlen(text);
+        }
+        if (!append(text, percent - text)) {
+            return fail("out of memory");
+        }
+        if ('\0' == *percent) {
+            break;
+        }
+
+        VerboseBinaryConversion conversion;
+        uintptr_t kind = verboseBinaryParseConversion(percent, &conversion);
+        text = percent + conversion.length;
+        if (VERBOSE_BINARY_ARGUMENT_INVALID == kind) {
+            return fail("format string has a conversion which can not be decoded");
+        }
+        if (VERBOSE_BINARY_ARGUMENT_NONE == kind) {
+            if (!append("%", 1)) {
+                return fail("out of memory");
+            }
+            continue;
+        }
+
+        /* rebuild the specification with the width and precision inline and a length modifier of our own */
+        char specification[MAXIMUM_SPECIFICATION_LENGTH];
+        uintptr_t specificationLength = 0;
+        uint64_t value = 0;
+        uintptr_t consumed = 0;
+
+        if ((conversion.flagsLength + conversion.widthLength + conversion.precisionLength)
+            > (MAXIMUM_SPECIFICATION_LENGTH - 32)) {
+            return fail("format string has a conversion which can not be decoded");
+        }
+        specification[specificationLength++] = '%';
+        memcpy(specification + specificationLength, percent + 1, conversion.flagsLength);
+        specificationLength += conversion.flagsLength;
+        if (conversion.widthFromArgument) {
+            consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &value);
+            if (0 == consumed) {
+                return fail("line record is missing a value");
+            }
+            cursor += consumed;
+            specificationLength += sprintf(specification + specificationLength, "%d",
+                (int)verboseBinaryUnzigzag(value));
+        } else {
+            memcpy(specification + specificationLength, percent + conversion.widthOffset, conversion.widthLength);
+            specificationLength += conversion.widthLength;
+        }
+        int precision = -1;
+        if (conversion.hasPrecision) {
+            if (conversion.precisionFromArgument) {
+                consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &value);
+                if (0 == consumed) {
+                    return fail("line record is missing a value");
+                }
+                cursor += consumed;
+                precision = (int)verboseBinaryUnzigzag(value);
+            } else {
+                precision = atoi(percent + conversion.precisionOffset);
+            }
+        }
+        if ((0 <= precision) && (VERBOSE_BINARY_ARGUMENT_STRING != kind)) {
+            specificationLength += sprintf(specification + specificationLength, ".%d", precision);
+        }
+
+        bool result = true;
+        switch (kind) {
+        case VERBOSE_BINARY_ARGUMENT_SIGNED:
+        case VERBOSE_BINARY_ARGUMENT_UNSIGNED:
+        case VERBOSE_BINARY_ARGUMENT_POINTER:
+            consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &value);
+            if (0 == consumed) {
+                return fail("line record is missing a value");
+            }
+            cursor += consumed;
+            if (VERBOSE_BINARY_ARGUMENT_POINTER == kind) {
+                /* the port library prints pointers as zero padded upper case hex without a prefix */
+                result = appendFormatted("%0*llX", (int)(_pointerSize * 2), (unsigned long long)value);
+            } else if ('c' == conversion.conversion) {
+                specification[specificationLength++] = 'c';
+                specification[specificationLength] = '\0';
+                result = appendFormatted(specification, (int)value);
+            } else {
+                specification[specificationLength++] = 'l';
+                specification[specificationLength++] = 'l';
+                specification[specificationLength++] = conversion.conversion;
+                specification[specificationLength] = '\0';
+                if (VERBOSE_BINARY_ARGUMENT_SIGNED == kind) {
+                    result = appendFormatted(specification, (long long)verboseBinaryUnzigzag(value));
+                } else {
+                    result = appendFormatted(specification, (unsigned long long)value);
+                }
+            }
+            break;
+        case VERBOSE_BINARY_ARGUMENT_STRING: {
+            consumed = verboseBinaryDecodeVarint(cursor, end - cursor, &value);
+            if ((0 == consumed) || ((value > 0) && ((value - 1) > (uint64_t)(end - cursor - consumed)))) {
+                return fail("line record is missing a value");
+            }
+            cursor += consumed;
+            const char* string = "<NULL>";
+            int stringLength = 6;
+            if (0 != value) {
+                string = (const char*)cursor;
+                stringLength = (int)(value - 1);
+                cursor += stringLength;
+            }
+            if ((0 <= precision) && (precision < stringLength)) {
+                stringLength = precision;
+            }
+            memcpy(specification + specificationLength, ".*s", 4);
+            result = appendFormatted(specification, stringLength, string);
+            break;
+        }
+        default: {
+            if ((end - cursor) < 8) {
+                return fail("line record is missing a value");
+            }
+            uint64_t bits = 0;
+            for (uintptr_t byte = 0; byte < 8; byte++) {
+                bits |= (uint64_t)cursor[byte] << (8 * byte);
+            }
+            cursor += 8;
+            double number = 0;
+            memcpy(&number, &bits, sizeof(number));
+            specification[specificationLength++] = conversion.conversion;
+            specification[specificationLength] = '\0';
+            result = appendFormatted(specification, number);
+            break;
+        }
+        }
+        if (!result) {
+            return fail("out of memory");
+        }
+    }
+
+    if (!append("\n", 1)) {
+        return fail("out of memory");
+    }
+    _output(_userData, _line, _lineLength);
+    return true;
+}
+
+bool
+VerboseGCDecoder::appendIndent(uint64_t indent)
+{
+    for (uint64_t i = 0; i < indent; i++) {
+        if (!append("  ", 2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool
+VerboseGCDecoder::append(const char* text, uintptr_t length)
+{
+    if (!ensureCapacity((void**)&_line, &_lineCapacity, _lineLength + length + 1, 1)) {
+        return false;
+    }
+    memcpy(_line + _lineLength, text, length);
+    _lineLength += length;
+    _line[_lineLength] = '\0';
+    return true;
+}
+
+bool
+VerboseGCDecoder::appendFormatted(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if ((length < 0) || !ensureCapacity((void**)&_line, &_lineCapacity, _lineLength + length + 1, 1)) {
+        return false;
+    }
+
+    va_start(args, format);
+    vsnprintf(_line + _lineLength, length + 1, format, args);
+    va_end(args);
+    _lineLength += length;
+    return true;
+}
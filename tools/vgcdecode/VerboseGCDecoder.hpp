@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef VERBOSEGCDECODER_HPP_
+#define VERBOSEGCDECODER_HPP_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * Streaming decoder of binary verbose GC files (see gc/verbose/VerboseBinaryFormat.hpp).
+ *
+ * Bytes are fed to decode() in chunks of any size; the text they decode to is passed to the output function
+ * as soon as each record is complete. The output is the text the verbose GC file writers would have written.
+ */
+class VerboseGCDecoder {
+    /*
+     * Data members
+     */
+public:
+    typedef void (*OutputFunction)(void* userData, const char* text, uintptr_t length);
+
+private:
+    OutputFunction _output; /**< receives the decoded text */
+    void* _userData; /**< passed to _output */
+
+    uint8_t* _pending; /**< bytes received but not yet decoded */
+    uintptr_t _pendingLength;
+    uintptr_t _pendingCapacity;
+
+    bool _headerDecoded; /**< true once the file header has been checked */
+    uintptr_t _pointerSize; /**< size of a pointer on the platform which wrote the file */
+
+    char** _formats; /**< format strings indexed by id, NULL where undefined */
+    uintptr_t _formatCapacity;
+
+    char* _line; /**< line being rendered */
+    uintptr_t _lineLength;
+    uintptr_t _lineCapacity;
+
+    const char* _error; /**< description of the first error, NULL if there is none */
+
+    /*
+     * Function members
+     */
+public:
+    VerboseGCDecoder(OutputFunction output, void* userData);
+    ~VerboseGCDecoder();
+
+    /**
+     * @return true if the bytes start with the header of a binary verbose GC file
+     */
+    static bool isBinaryFormat(const uint8_t* bytes, uintptr_t length);
+
+    /**
+     * Decode the next chunk of a file.
+     * @return false if the file is malformed, see getError()
+     */
+    bool decode(const uint8_t* bytes, uintptr_t length);
+
+    /**
+     * Signal the end of the file.
+     * @return false if the file is malformed or ends part way through a record, see getError()
+     */
+    bool finish();
+
+    /**
+     * @return the description of the first error, NULL if there is none
+     */
+    const char* getError() { return _error; }
+
+private:
+    bool fail(const char* error);
+    bool decodeRecord(const uint8_t* body, uintptr_t length);
+    bool defineFormat(uint64_t id, const uint8_t* text, uintptr_t length);
+    bool renderLine(uint64_t indent, const char* format, const uint8_t* cursor, const uint8_t* end);
+    bool appendIndent(uint64_t indent);
+    bool append(const char* text, uintptr_t length);
+    bool appendFormatted(const char* format, ...);
+};
+
+#endif /* VERBOSEGCDECODER_HPP_ */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * vgcdecode <input> [<output>]
+ *
+ * Decodes a binary verbose GC file (written with -Xgc:verboseBinaryFormat) to the XML text the verbose GC file
+ * writers would have written. The output goes to stdout if no output file is given.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "VerboseGCDecoder.hpp"
+
+#define READ_CHUNK_SIZE (64 * 1024)
+
+static void
+writeOutput(void* userData, const char* text, uintptr_t length)
+{
+    fwrite(text, 1, length, (FILE*)userData);
+}
+
+int
+main(int argc, char** argv)
+{
+    if ((argc < 2) || (argc > 3)) {
+        fprintf(stderr, "usage: %s <binary verbose GC file> [<output file>]\n", argv[0]);
+        return -1;
+    }
+
+    FILE* input = fopen(argv[1], "rb");
+    if (NULL == input) {
+        fprintf(stderr, "Failed to open %s for reading\n", argv[1]);
+        return -1;
+    }
+
+    FILE* output = stdout;
+    if (3 == argc) {
+        output = fopen(argv[2], "wb");
+        if (NULL == output) {
+            fprintf(stderr, "Failed to open %s for writing\n", argv[2]);
+            fclose(input);
+            return -1;
+        }
+    }
+
+    VerboseGCDecoder decoder(writeOutput, output);
+    uint8_t* chunk = (uint8_t*)malloc(READ_CHUNK_SIZE);
+    bool result = (NULL != chunk);
+
+    while (result) {
+        size_t length = fread(chunk, 1, READ_CHUNK_SIZE, input);
+        if (0 == length) {
+            result = !ferror(input) && decoder.finish();
+            break;
+        }
+        result = decoder.decode(chunk, length);
+    }
+
+    if (!result) {
+        const char* error = (NULL == chunk) ? "out of memory" : decoder.getError();
+        fprintf(stderr, "Failed to decode %s: %s\n", argv[1], (NULL == error) ? "read error" : error);
+    }
+
+    free(chunk);
+    fclose(input);
+    if (stdout != output) {
+        fclose(output);
+    }
+    return result ? 0 : -1;
+}
@@ -961,21 +961,44 @@ static void rebuildFromPools(J9HashTable* table, uint32_t newSize, void** newNod
  *	Pass in a pointer to an empty J9HashTableState and it will be filled in.
  */
 void* hashTableStartDo(J9HashTable* table, J9HashTableState* handle)
+{
+    return hashTableStartDoBuckets(table, handle, 0, table->tableSize);
+}
+
+/**
+ * \brief       Begin an iteration over the nodes in a range of buckets of a hash-table.
+ * \ingroup     hash_table
+ *
+ *
+ * @param table
+ * @param handle used by hashTableNextDo to keep track of state
+ * @param startBucket the first bucket to iterate
+ * @param endBucket the bucket after the last one to iterate, at most table->tableSize
+ * @return            NULL if  no more nodes; otherwise a the address of the node
+ *
+ *	Iterations over consecutive ranges of buckets which together cover [0, table->tableSize) return every node of the
+ *	table exactly once, so that several threads can share a walk of a table which is not being modified. Nodes held
+ *	in AVL trees are not in any bucket and are returned by the iteration whose range ends at the last bucket.
+ */
+void* hashTableStartDoBuckets(J9HashTable* table, J9HashTableState* handle, uint32_t startBucket, uint32_t endBucket)
 {
     void* result = NULL;
     uint32_t numberOfListNodes = table->numberOfNodes - table->numberOfTreeNodes;
     HASHTABLE_DEBUG_PORT(table->portLibrary);
 
+    Assert_hashTable_true((startBucket <= endBucket) && (endBucket <= table->tableSize));
+
     memset(handle, 0, sizeof(J9HashTableState));
     handle->table = table;
-    handle->bucketIndex = 0;
-    handle->pointerToCurrentNode = &table->nodes[0];
+    handle->bucketIndex = startBucket;
+    handle->bucketLimit = endBucket;
+    handle->pointerToCurrentNode = &table->nodes[startBucket];
     handle->didDeleteCurrentNode = FALSE;
     handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
 
     if (NULL == table->listNodePool) {
         /* find the first non-empty bucket */
-        while (handle->bucketIndex < table->tableSize) {
+        while (handle->bucketIndex < handle->bucketLimit) {
             void** node = &table->nodes[handle->bucketIndex];
             if (NULL != *node) {
                 result = node;
@@ -988,17 +1011,16 @@ void* hashTableStartDo(J9HashTable* table, J9HashTableState* handle)
          * supported, so we just have to iterate the treeNode pool
          */
         if (numberOfListNodes > 0) {
-            while ((handle->bucketIndex < table->tableSize)
+            while ((handle->bucketIndex < handle->bucketLimit)
                 && ((NULL == *handle->pointerToCurrentNode) || AVL_TREE_TAGGED(*handle->pointerToCurrentNode))) {
                 handle->bucketIndex += 1;
                 handle->pointerToCurrentNode = &table->nodes[handle->bucketIndex];
             }
-            /* Had to have found a listNode in the table unless numberOfListNodes was incorrect */
-            HASHTABLE_ASSERT(
-                !(NULL == *handle->pointerToCurrentNode) || AVL_TREE_TAGGED(*handle->pointerToCurrentNode));
+        }
+        if ((numberOfListNodes > 0) && (handle->bucketIndex < handle->bucketLimit)) {
             result = *handle->pointerToCurrentNode;
             handle->iterateState = J9HASH_TABLE_ITERATE_STATE_LIST_NODES;
-        } else if (table->numberOfTreeNodes > 0) {
+        } else if ((table->numberOfTreeNodes > 0) && (table->tableSize == handle->bucketLimit)) {
             handle->pointerToCurrentNode = pool_startDo(table->treeNodePool, &handle->poolState);
             HASHTABLE_ASSERT(NULL != handle->pointerToCurrentNode);
             result = AVL_NODE_TO_DATA(handle->pointerToCurrentNode);
@@ -1034,7 +1056,7 @@ void* hashTableNextDo(J9HashTableState* handle)
     if (NULL == table->listNodePool) {
         /* space optimized hashTable - advance to the next bucket */
         handle->bucketIndex += 1;
-        while (handle->bucketIndex < table->tableSize) {
+        while (handle->bucketIndex < handle->bucketLimit) {
             void** node = &table->nodes[handle->bucketIndex];
             if (NULL != *node) {
                 result = node;
@@ -1054,15 +1076,15 @@ void* hashTableNextDo(J9HashTableState* handle)
             }
             handle->didDeleteCurrentNode = FALSE;
 
-            while ((handle->bucketIndex < table->tableSize)
+            while ((handle->bucketIndex < handle->bucketLimit)
                 && ((NULL == *handle->pointerToCurrentNode) || AVL_TREE_TAGGED(*handle->pointerToCurrentNode))) {
                 handle->bucketIndex += 1;
                 handle->pointerToCurrentNode = &table->nodes[handle->bucketIndex];
             }
-            if (handle->bucketIndex < table->tableSize) {
+            if (handle->bucketIndex < handle->bucketLimit) {
                 result = *handle->pointerToCurrentNode;
             } else {
-                if (table->numberOfTreeNodes > 0) {
+                if ((table->numberOfTreeNodes > 0) && (table->tableSize == handle->bucketLimit)) {
                     handle->pointerToCurrentNode = pool_startDo(table->treeNodePool, &handle->poolState);
                     result = AVL_NODE_TO_DATA(handle->pointerToCurrentNode);
                     /* iterate more tree nodes at next iteration */